@@ -32,6 +32,7 @@
 #include "benchmarks/benchmark_utilities/Rand.h"
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/Indexer.h"
+#include "open3d/core/LazyTensor.h"
 #include "open3d/core/ParallelFor.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/utility/Logging.h"
@@ -207,5 +208,48 @@ ENUM_BM_TENSOR_WTIH_BOOL(BinaryEW, Le)
 ENUM_BM_TENSOR_WTIH_BOOL(BinaryEW, Eq)
 ENUM_BM_TENSOR_WTIH_BOOL(BinaryEW, Neq)
 
+// Evaluates the chain (a - b) * c + d, either with one kernel per operator
+// and materialized intermediates or fused into a single pass.
+void BinaryEWChain(benchmark::State& state,
+                   int size,
+                   bool fused,
+                   const Dtype& dtype,
+                   const Device& device) {
+    Tensor a = benchmarks::Rand({1, size}, 1, {1, 127}, dtype, device);
+    Tensor b = benchmarks::Rand({1, size}, 2, {1, 127}, dtype, device);
+    Tensor c = benchmarks::Rand({1, size}, 3, {1, 127}, dtype, device);
+    Tensor d = benchmarks::Rand({1, size}, 4, {1, 127}, dtype, device);
+    LazyTensor expr = (LazyTensor(a) - b) * c + d;
+
+    Tensor result = fused ? expr.Eval() : expr.EvalUnfused();
+    benchmark::DoNotOptimize(result);
+
+    for (auto _ : state) {
+        Tensor result = fused ? expr.Eval() : expr.EvalUnfused();
+        benchmark::DoNotOptimize(result);
+
+        cuda::Synchronize(device);
+    }
+}
+
+#define ENUM_BM_CHAIN(DTYPE)                                                  \
+    BENCHMARK_CAPTURE(BinaryEWChain, Unfused__CPU_##DTYPE##__100000, 100000, \
+                      false, DTYPE, Device("CPU:0"))                          \
+            ->Unit(benchmark::kMillisecond);                                  \
+    BENCHMARK_CAPTURE(BinaryEWChain, Fused__CPU_##DTYPE##__100000, 100000,   \
+                      true, DTYPE, Device("CPU:0"))                           \
+            ->Unit(benchmark::kMillisecond);                                  \
+    BENCHMARK_CAPTURE(BinaryEWChain, Unfused__CPU_##DTYPE##__100000000,      \
+                      100000000, false, DTYPE, Device("CPU:0"))               \
+            ->Unit(benchmark::kMillisecond);                                  \
+    BENCHMARK_CAPTURE(BinaryEWChain, Fused__CPU_##DTYPE##__100000000,        \
+                      100000000, true, DTYPE, Device("CPU:0"))                \
+            ->Unit(benchmark::kMillisecond);
+
+ENUM_BM_CHAIN(Int32)
+ENUM_BM_CHAIN(Int64)
+ENUM_BM_CHAIN(Float32)
+ENUM_BM_CHAIN(Float64)
+
 }  // namespace core
 }  // namespace open3d
@@ -29,11 +29,14 @@
 #include <benchmark/benchmark.h>
 
 #include "open3d/core/CUDAUtils.h"
+#include "open3d/core/MemoryManagerStatistic.h"
+#include "open3d/core/ScopedArena.h"
+#include "open3d/core/Tensor.h"
 
 namespace open3d {
 namespace core {
 
-enum class MemoryManagerBackend { Direct, Cached };
+enum class MemoryManagerBackend { Direct, Cached, Pooled };
 
 std::shared_ptr<DeviceMemoryManager> MakeMemoryManager(
         const Device& device, const MemoryManagerBackend& backend) {
@@ -61,6 +64,9 @@ std::shared_ptr<DeviceMemoryManager> MakeMemoryManager(
         case MemoryManagerBackend::Cached:
             return std::make_shared<CachedMemoryManager>(device_mm);
 
+        case MemoryManagerBackend::Pooled:
+            return std::make_shared<PooledMemoryManager>(device_mm);
+
         default:
             utility::LogError("Unimplemented backend");
             break;
@@ -151,16 +157,112 @@ void Free(benchmark::State& state,
 #define ENUM_BM_BACKEND(FN)                                                \
     ENUM_BM_SIZE(FN, Device("CPU:0"), CPU, MemoryManagerBackend::Direct)   \
     ENUM_BM_SIZE(FN, Device("CPU:0"), CPU, MemoryManagerBackend::Cached)   \
+    ENUM_BM_SIZE(FN, Device("CPU:0"), CPU, MemoryManagerBackend::Pooled)   \
     ENUM_BM_SIZE(FN, Device("CUDA:0"), CUDA, MemoryManagerBackend::Direct) \
     ENUM_BM_SIZE(FN, Device("CUDA:0"), CUDA, MemoryManagerBackend::Cached)
 #else
 #define ENUM_BM_BACKEND(FN)                                              \
     ENUM_BM_SIZE(FN, Device("CPU:0"), CPU, MemoryManagerBackend::Direct) \
-    ENUM_BM_SIZE(FN, Device("CPU:0"), CPU, MemoryManagerBackend::Cached)
+    ENUM_BM_SIZE(FN, Device("CPU:0"), CPU, MemoryManagerBackend::Cached) \
+    ENUM_BM_SIZE(FN, Device("CPU:0"), CPU, MemoryManagerBackend::Pooled)
 #endif
 
 ENUM_BM_BACKEND(Malloc)
 ENUM_BM_BACKEND(Free)
 
+// Simulates the short-lived temporaries of a per-frame pipeline: a mix of
+// small tensors is created and destroyed on all threads in each iteration.
+void TensorTemporaries(benchmark::State& state, bool pooled) {
+    const Device device("CPU:0");
+    bool old_enabled = MemoryManager::IsCPUMemoryPoolEnabled();
+    MemoryManager::SetCPUMemoryPoolEnabled(pooled);
+
+    const std::vector<int64_t> num_points = {1, 3, 100, 1000, 10000, 50000};
+    auto run = [&]() {
+#pragma omp parallel for schedule(static)
+        for (int i = 0; i < 256; ++i) {
+            int64_t n = num_points[i % num_points.size()];
+            Tensor a = Tensor::Empty({n, 3}, core::Float32, device);
+            Tensor b = Tensor::Empty({n}, core::Int64, device);
+            Tensor c = Tensor::Empty({n, 3, 3}, core::Float64, device);
+        }
+    };
+
+    // Warmup.
+    run();
+
+    for (auto _ : state) {
+        run();
+    }
+
+    MemoryManager::SetCPUMemoryPoolEnabled(old_enabled);
+}
+
+BENCHMARK_CAPTURE(TensorTemporaries, Direct, false)
+        ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(TensorTemporaries, Pooled, true)
+        ->Unit(benchmark::kMicrosecond);
+
+// Mimics the per-iteration temporaries of a point-to-point ICP step and
+// reports the number of memory manager allocations per iteration.
+void ArenaIteration(benchmark::State& state,
+                    const Device& device,
+                    bool use_arena) {
+    const int64_t n = 100000;
+    Tensor source = Tensor::Ones({n, 3}, core::Float32, device);
+    Tensor target = Tensor::Ones({n, 3}, core::Float32, device);
+    Tensor weights = Tensor::Ones({n, 1}, core::Float32, device);
+    const size_t arena_byte_size = 64 << 20;
+
+    auto iteration = [&]() {
+        Tensor diff = (source - target) * weights;
+        Tensor residual = (diff * diff).Sum({1});
+        Tensor centroid = diff.Mean({0});
+        Tensor error = residual.Sum({0});
+        (void)centroid;
+        (void)error;
+    };
+
+    // Warmup.
+    if (use_arena) {
+        ScopedArena arena(device, arena_byte_size);
+        iteration();
+    } else {
+        iteration();
+    }
+    cuda::Synchronize(device);
+
+    auto& statistic = MemoryManagerStatistic::GetInstance();
+    int64_t num_iterations = 0;
+    int64_t count_malloc = statistic.GetMallocCount(device);
+    for (auto _ : state) {
+        if (use_arena) {
+            ScopedArena arena(device, arena_byte_size);
+            iteration();
+        } else {
+            iteration();
+        }
+        cuda::Synchronize(device);
+        ++num_iterations;
+    }
+    state.counters["allocs_per_iteration"] =
+            static_cast<double>(statistic.GetMallocCount(device) -
+                                count_malloc) /
+            std::max<int64_t>(num_iterations, 1);
+
+    ScopedArena::ReleaseCache();
+}
+
+BENCHMARK_CAPTURE(ArenaIteration, Direct_CPU, Device("CPU:0"), false)
+        ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(ArenaIteration, Arena_CPU, Device("CPU:0"), true)
+        ->Unit(benchmark::kMicrosecond);
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(ArenaIteration, Direct_CUDA, Device("CUDA:0"), false)
+        ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(ArenaIteration, Arena_CUDA, Device("CUDA:0"), true)
+        ->Unit(benchmark::kMicrosecond);
+#endif
+
 }  // namespace core
 }  // namespace open3d
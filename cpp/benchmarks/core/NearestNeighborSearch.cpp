@@ -0,0 +1,235 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include "benchmarks/benchmark_utilities/Rand.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/nns/DynamicGridIndex.h"
+#include "open3d/core/nns/FixedRadiusIndex.h"
+#include "open3d/core/nns/NanoFlannIndex.h"
+
+namespace open3d {
+namespace core {
+
+static constexpr double kVoxelSize = 0.02;
+
+// Streaming update: every frame, the oldest num_changed points are replaced
+// by new ones. Compares rebuilding an index from scratch against updating a
+// DynamicGridIndex in place.
+void NNSRebuildNanoFlann(benchmark::State& state) {
+    const int64_t num_points = state.range(0);
+    const int64_t num_changed = state.range(1);
+    Tensor points = benchmarks::Rand({num_points, 3}, 1, {0.0, 1.0}, Float32);
+    Tensor new_points =
+            benchmarks::Rand({num_changed, 3}, 2, {0.0, 1.0}, Float32);
+    nns::NanoFlannIndex index;
+    for (auto _ : state) {
+        points.Slice(0, 0, num_changed) = new_points;
+        index.SetTensorData(points);
+    }
+}
+
+void NNSRebuildDynamicGrid(benchmark::State& state) {
+    const int64_t num_points = state.range(0);
+    const int64_t num_changed = state.range(1);
+    Tensor points = benchmarks::Rand({num_points, 3}, 1, {0.0, 1.0}, Float32);
+    Tensor new_points =
+            benchmarks::Rand({num_changed, 3}, 2, {0.0, 1.0}, Float32);
+    nns::DynamicGridIndex index;
+    for (auto _ : state) {
+        points.Slice(0, 0, num_changed) = new_points;
+        index.SetTensorData(points, kVoxelSize);
+    }
+}
+
+void NNSUpdateDynamicGrid(benchmark::State& state) {
+    const int64_t num_points = state.range(0);
+    const int64_t num_changed = state.range(1);
+    Tensor points = benchmarks::Rand({num_points, 3}, 1, {0.0, 1.0}, Float32);
+    Tensor new_points =
+            benchmarks::Rand({num_changed, 3}, 2, {0.0, 1.0}, Float32);
+    nns::DynamicGridIndex index(points, kVoxelSize);
+    // Indices of the live points, oldest first. Removed indices are reused
+    // by the index, so track the ones returned by InsertPoints.
+    Tensor slots = Tensor::Arange(0, num_points, 1, Int32);
+    int64_t oldest = 0;
+    for (auto _ : state) {
+        if (oldest + num_changed > num_points) {
+            oldest = 0;
+        }
+        Tensor batch = slots.Slice(0, oldest, oldest + num_changed);
+        index.RemovePoints(batch);
+        batch.AsRvalue() = index.InsertPoints(new_points);
+        oldest += num_changed;
+    }
+}
+
+enum class NNSIndexType { KdTree, HashGrid, DynamicGrid };
+
+static std::unique_ptr<nns::NNSIndex> CreateIndex(NNSIndexType type,
+                                                  const Tensor& points,
+                                                  double radius) {
+    std::unique_ptr<nns::NNSIndex> index;
+    switch (type) {
+        case NNSIndexType::KdTree:
+            index.reset(new nns::NanoFlannIndex(points));
+            break;
+        case NNSIndexType::HashGrid:
+            index.reset(new nns::FixedRadiusIndex(points, radius));
+            break;
+        case NNSIndexType::DynamicGrid:
+            index.reset(new nns::DynamicGridIndex(points, radius));
+            break;
+    }
+    return index;
+}
+
+void NNSBuild(benchmark::State& state, NNSIndexType type) {
+    const int64_t num_points = state.range(0);
+    Tensor points = benchmarks::Rand({num_points, 3}, 1, {0.0, 1.0}, Float32);
+    for (auto _ : state) {
+        auto index = CreateIndex(type, points, kVoxelSize);
+        benchmark::DoNotOptimize(index);
+    }
+}
+
+void NNSRadiusSearch(benchmark::State& state, NNSIndexType type) {
+    const int64_t num_points = state.range(0);
+    Tensor points = benchmarks::Rand({num_points, 3}, 1, {0.0, 1.0}, Float32);
+    Tensor queries = benchmarks::Rand({10000, 3}, 3, {0.0, 1.0}, Float32);
+    auto index = CreateIndex(type, points, kVoxelSize);
+    for (auto _ : state) {
+        auto result = index->SearchRadius(queries, kVoxelSize, true);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+void NNSHybridSearch(benchmark::State& state, NNSIndexType type) {
+    const int64_t num_points = state.range(0);
+    Tensor points = benchmarks::Rand({num_points, 3}, 1, {0.0, 1.0}, Float32);
+    Tensor queries = benchmarks::Rand({10000, 3}, 3, {0.0, 1.0}, Float32);
+    auto index = CreateIndex(type, points, kVoxelSize);
+    for (auto _ : state) {
+        auto result = index->SearchHybrid(queries, kVoxelSize, 30);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+// Batched KNN over batch_size clouds of cloud_size points each, with one query
+// per point. Compares one batched index built and searched in a single pass
+// against building and searching one index per cloud.
+void NNSKnnBatchLoop(benchmark::State& state) {
+    const int64_t batch_size = state.range(0);
+    const int64_t cloud_size = state.range(1);
+    Tensor points = benchmarks::Rand({batch_size * cloud_size, 3}, 1,
+                                     {0.0, 1.0}, Float32);
+    for (auto _ : state) {
+        for (int64_t b = 0; b < batch_size; ++b) {
+            Tensor cloud =
+                    points.Slice(0, b * cloud_size, (b + 1) * cloud_size);
+            nns::NanoFlannIndex index(cloud);
+            auto result = index.SearchKnn(cloud, 16);
+            benchmark::DoNotOptimize(result);
+        }
+    }
+}
+
+void NNSKnnBatch(benchmark::State& state) {
+    const int64_t batch_size = state.range(0);
+    const int64_t cloud_size = state.range(1);
+    Tensor points = benchmarks::Rand({batch_size * cloud_size, 3}, 1,
+                                     {0.0, 1.0}, Float32);
+    Tensor row_splits =
+            Tensor::Arange(0, batch_size * cloud_size + 1, cloud_size, Int64);
+    for (auto _ : state) {
+        nns::NanoFlannIndex index;
+        index.SetTensorData(points, row_splits);
+        auto result = index.SearchKnn(points, row_splits, 16);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+BENCHMARK(NNSRebuildNanoFlann)
+        ->Args({100000, 2000})
+        ->Args({1000000, 2000})
+        ->Args({1000000, 20000})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(NNSRebuildDynamicGrid)
+        ->Args({100000, 2000})
+        ->Args({1000000, 2000})
+        ->Args({1000000, 20000})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(NNSUpdateDynamicGrid)
+        ->Args({100000, 2000})
+        ->Args({1000000, 2000})
+        ->Args({1000000, 20000})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(NNSBuild, KdTree, NNSIndexType::KdTree)
+        ->Arg(100000)
+        ->Arg(1000000)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(NNSBuild, HashGrid, NNSIndexType::HashGrid)
+        ->Arg(100000)
+        ->Arg(1000000)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(NNSBuild, DynamicGrid, NNSIndexType::DynamicGrid)
+        ->Arg(100000)
+        ->Arg(1000000)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(NNSRadiusSearch, KdTree, NNSIndexType::KdTree)
+        ->Arg(100000)
+        ->Arg(1000000)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(NNSRadiusSearch, HashGrid, NNSIndexType::HashGrid)
+        ->Arg(100000)
+        ->Arg(1000000)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(NNSRadiusSearch, DynamicGrid, NNSIndexType::DynamicGrid)
+        ->Arg(100000)
+        ->Arg(1000000)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(NNSHybridSearch, KdTree, NNSIndexType::KdTree)
+        ->Arg(100000)
+        ->Arg(1000000)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(NNSHybridSearch, HashGrid, NNSIndexType::HashGrid)
+        ->Arg(100000)
+        ->Arg(1000000)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(NNSHybridSearch, DynamicGrid, NNSIndexType::DynamicGrid)
+        ->Arg(100000)
+        ->Arg(1000000)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(NNSKnnBatchLoop)
+        ->ArgsProduct({{1, 16, 256}, {1000, 10000}})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(NNSKnnBatch)
+        ->ArgsProduct({{1, 16, 256}, {1000, 10000}})
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace core
+}  // namespace open3d
@@ -28,6 +28,7 @@
 
 #include <benchmark/benchmark.h>
 
+#include <cmath>
 #include <vector>
 
 #ifdef BUILD_ISPC_MODULE
@@ -104,5 +105,65 @@ void ParallelForVectorized(benchmark::State& state, int size) {
 ENUM_BM_SIZE(ParallelForScalar)
 ENUM_BM_SIZE(ParallelForVectorized)
 
+enum class WorkloadType { Balanced, Skewed };
+
+// Runs a workload where the cost of each item is either constant (Balanced) or
+// grows quadratically with the index (Skewed), mimicking e.g. hybrid search
+// with variable neighbor counts. The outer loop is optionally nested inside
+// another ParallelFor.
+void ParallelForBackends(benchmark::State& state,
+                         int size,
+                         ParallelForBackend backend,
+                         WorkloadType workload,
+                         bool nested) {
+    const ParallelForBackend old_backend = GetParallelForBackend();
+    SetParallelForBackend(backend);
+
+    const int64_t num_outer = nested ? 8 : 1;
+    std::vector<float> output(num_outer * size);
+    auto inner_loop = [&](int64_t outer) {
+        core::ParallelFor(core::Device("CPU:0"), size, [&](int64_t idx) {
+            int64_t num_steps = 16;
+            if (workload == WorkloadType::Skewed) {
+                num_steps = 1 + 48 * idx / size * idx / size;
+            }
+            float x = static_cast<float>(idx);
+            for (int64_t k = 0; k < num_steps; ++k) {
+                x = std::sqrt(x * x + 1.0f);
+            }
+            output[outer * size + idx] = x;
+        });
+    };
+    auto run = [&]() {
+        if (nested) {
+            core::ParallelFor(core::Device("CPU:0"), num_outer, inner_loop);
+        } else {
+            inner_loop(0);
+        }
+    };
+
+    // Warmup.
+    run();
+
+    for (auto _ : state) {
+        run();
+    }
+
+    SetParallelForBackend(old_backend);
+}
+
+#define ENUM_BM_BACKEND(WORKLOAD, NESTED, NAME)                              \
+    BENCHMARK_CAPTURE(ParallelForBackends, OpenMP_##NAME##_CPU1000000,       \
+                      1000000, ParallelForBackend::OpenMP, WORKLOAD, NESTED) \
+            ->Unit(benchmark::kMicrosecond);                                 \
+    BENCHMARK_CAPTURE(ParallelForBackends, TBB_##NAME##_CPU1000000, 1000000, \
+                      ParallelForBackend::TBB, WORKLOAD, NESTED)             \
+            ->Unit(benchmark::kMicrosecond);
+
+ENUM_BM_BACKEND(WorkloadType::Balanced, false, Balanced)
+ENUM_BM_BACKEND(WorkloadType::Skewed, false, Skewed)
+ENUM_BM_BACKEND(WorkloadType::Balanced, true, BalancedNested)
+ENUM_BM_BACKEND(WorkloadType::Skewed, true, SkewedNested)
+
 }  // namespace core
 }  // namespace open3d
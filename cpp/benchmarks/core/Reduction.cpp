@@ -57,5 +57,76 @@ BENCHMARK_CAPTURE(Reduction, CUDA, Device("CUDA:0"))
         ->Unit(benchmark::kMillisecond);
 #endif
 
+enum class PointCloudReduction {
+    SumAll,
+    MinBound,
+    MaxBound,
+    ArgMax,
+    ArgMaxAll
+};
+
+// Reductions over an (N, 3) tensor as used for bounds and centers of point
+// clouds.
+void ReductionPointCloud(benchmark::State& state,
+                         const Device& device,
+                         const Dtype& dtype,
+                         PointCloudReduction reduction) {
+    int64_t num_points = state.range(0);
+    Tensor src = Tensor::Ones({num_points, 3}, dtype, device);
+    auto run = [&]() -> Tensor {
+        switch (reduction) {
+            case PointCloudReduction::SumAll:
+                return src.Sum({0, 1});
+            case PointCloudReduction::MinBound:
+                return src.Min({0});
+            case PointCloudReduction::MaxBound:
+                return src.Max({0});
+            case PointCloudReduction::ArgMax:
+                return src.ArgMax({0});
+            default:
+                return src.ArgMax({0, 1});
+        }
+    };
+    Tensor warm_up = run();
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = run();
+        cuda::Synchronize(device);
+    }
+}
+
+#define ENUM_BM_POINT_CLOUD_REDUCTION(DEVICE_NAME, DEVICE)                  \
+    BENCHMARK_CAPTURE(ReductionPointCloud, SumAll##DEVICE_NAME, DEVICE,     \
+                      core::Float32, PointCloudReduction::SumAll)           \
+            ->Arg(1 << 20)                                                  \
+            ->Arg(1 << 24)                                                  \
+            ->Unit(benchmark::kMillisecond);                                \
+    BENCHMARK_CAPTURE(ReductionPointCloud, MinBound##DEVICE_NAME, DEVICE,   \
+                      core::Float32, PointCloudReduction::MinBound)         \
+            ->Arg(1 << 20)                                                  \
+            ->Arg(1 << 24)                                                  \
+            ->Unit(benchmark::kMillisecond);                                \
+    BENCHMARK_CAPTURE(ReductionPointCloud, MaxBound##DEVICE_NAME, DEVICE,   \
+                      core::Float64, PointCloudReduction::MaxBound)         \
+            ->Arg(1 << 20)                                                  \
+            ->Arg(1 << 24)                                                  \
+            ->Unit(benchmark::kMillisecond);                                \
+    BENCHMARK_CAPTURE(ReductionPointCloud, ArgMax##DEVICE_NAME, DEVICE,     \
+                      core::Float32, PointCloudReduction::ArgMax)           \
+            ->Arg(1 << 20)                                                  \
+            ->Arg(1 << 24)                                                  \
+            ->Unit(benchmark::kMillisecond);                                \
+    BENCHMARK_CAPTURE(ReductionPointCloud, ArgMaxAll##DEVICE_NAME, DEVICE,  \
+                      core::Float32, PointCloudReduction::ArgMaxAll)        \
+            ->Arg(1 << 20)                                                  \
+            ->Arg(1 << 24)                                                  \
+            ->Unit(benchmark::kMillisecond);
+
+ENUM_BM_POINT_CLOUD_REDUCTION(CPU, Device("CPU:0"))
+
+#ifdef BUILD_CUDA_MODULE
+ENUM_BM_POINT_CLOUD_REDUCTION(CUDA, Device("CUDA:0"))
+#endif
+
 }  // namespace core
 }  // namespace open3d
@@ -0,0 +1,54 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/PointCloud.h"
+
+#include <benchmark/benchmark.h>
+
+#include "benchmarks/benchmark_utilities/Rand.h"
+#include "open3d/core/EigenConverter.h"
+
+namespace open3d {
+namespace benchmarks {
+
+static void LegacyFarthestPointDownSample(benchmark::State& state) {
+    const int64_t num_points = state.range(0);
+    const size_t num_samples = static_cast<size_t>(state.range(1));
+    geometry::PointCloud pcd(core::eigen_converter::TensorToEigenVector3dVector(
+            Rand({num_points, 3}, 0, {-1.0, 1.0}, core::Float64)));
+
+    for (auto _ : state) {
+        pcd.FarthestPointDownSample(num_samples);
+    }
+}
+
+BENCHMARK(LegacyFarthestPointDownSample)
+        ->Args({200000, 1024})
+        ->Args({2000000, 1024})
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
@@ -0,0 +1,94 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/data/Dataset.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/io/PointCloudIO.h"
+#include "open3d/pipelines/registration/Feature.h"
+
+namespace open3d {
+namespace pipelines {
+namespace registration {
+
+static const double voxel_size = 0.01;
+
+static std::tuple<std::shared_ptr<Feature>, std::shared_ptr<Feature>>
+LoadFeatures() {
+    data::DemoICPPointClouds demo_icp_pointclouds;
+    std::shared_ptr<Feature> features[2];
+    for (int i = 0; i < 2; ++i) {
+        geometry::PointCloud pcd;
+        io::ReadPointCloud(demo_icp_pointclouds.GetPaths(i), pcd,
+                           {"auto", false, false, true});
+        pcd = *pcd.VoxelDownSample(voxel_size);
+        pcd.EstimateNormals(
+                geometry::KDTreeSearchParamHybrid(voxel_size * 2, 30));
+        features[i] = ComputeFPFHFeature(
+                pcd, geometry::KDTreeSearchParamHybrid(voxel_size * 5, 100));
+    }
+    return std::make_tuple(features[0], features[1]);
+}
+
+// Matches source FPFH features against target FPFH features. The recall
+// counter is the fraction of source features whose match equals the exact
+// nearest neighbor.
+static void BenchmarkFeatureMatching(benchmark::State& state,
+                                     bool approximate) {
+    std::shared_ptr<Feature> source, target;
+    std::tie(source, target) = LoadFeatures();
+    const std::vector<int> exact = FindNearestFeatures(*source, *target);
+
+    const FeatureMatchingOption option(approximate, /*num_trees=*/4,
+                                       /*max_checks=*/int(state.range(0)),
+                                       /*seed=*/0);
+    std::vector<int> nearest;
+    for (auto _ : state) {
+        nearest = FindNearestFeatures(*source, *target, option);
+        benchmark::DoNotOptimize(nearest);
+    }
+
+    int num_hits = 0;
+    for (size_t i = 0; i < exact.size(); ++i) {
+        num_hits += nearest[i] == exact[i];
+    }
+    state.counters["recall"] = double(num_hits) / double(exact.size());
+}
+
+BENCHMARK_CAPTURE(BenchmarkFeatureMatching, Exact, false)
+        ->Arg(0)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BenchmarkFeatureMatching, Approximate, true)
+        ->Arg(16)
+        ->Arg(64)
+        ->Arg(256)
+        ->Arg(1024)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace open3d
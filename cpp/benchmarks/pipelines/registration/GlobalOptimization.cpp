@@ -0,0 +1,111 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/pipelines/registration/GlobalOptimization.h"
+
+#include <benchmark/benchmark.h>
+
+#include <Eigen/Dense>
+#include <random>
+
+#include "open3d/pipelines/registration/GlobalOptimizationConvergenceCriteria.h"
+#include "open3d/pipelines/registration/GlobalOptimizationMethod.h"
+#include "open3d/pipelines/registration/PoseGraph.h"
+#include "open3d/utility/Eigen.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace pipelines {
+namespace registration {
+
+/// Creates a drifting trajectory of \p num_nodes poses with odometry edges and
+/// a loop closure every 5 nodes, similar to a fragment pose graph.
+static PoseGraph CreateSyntheticPoseGraph(int num_nodes) {
+    std::mt19937 rng(0);
+    std::normal_distribution<double> noise(0.0, 0.01);
+    Eigen::Vector6d motion;
+    motion << 0.02, -0.01, 0.03, 0.1, 0.05, 0.02;
+    const Eigen::Matrix4d step = utility::TransformVector6dToMatrix4d(motion);
+    const Eigen::Matrix6d information = Eigen::Matrix6d::Identity() * 100.0;
+
+    PoseGraph pose_graph;
+    Eigen::Matrix4d drift = Eigen::Matrix4d::Identity();
+    Eigen::Matrix4d pose = Eigen::Matrix4d::Identity();
+    for (int i = 0; i < num_nodes; i++) {
+        pose_graph.nodes_.push_back(PoseGraphNode(drift * pose));
+        Eigen::Vector6d perturbation;
+        for (int k = 0; k < 6; k++) perturbation(k) = noise(rng);
+        drift = utility::TransformVector6dToMatrix4d(perturbation) * drift;
+        pose = step * pose;
+    }
+    for (int i = 0; i + 1 < num_nodes; i++) {
+        pose_graph.edges_.push_back(PoseGraphEdge(i, i + 1, step.inverse(),
+                                                  information, false));
+    }
+    Eigen::Matrix4d loop = Eigen::Matrix4d::Identity();
+    for (int k = 0; k < 10; k++) loop = step * loop;
+    for (int i = 0; i + 10 < num_nodes; i += 5) {
+        pose_graph.edges_.push_back(PoseGraphEdge(i, i + 10, loop.inverse(),
+                                                  information, true));
+    }
+    return pose_graph;
+}
+
+static void BenchmarkGlobalOptimization(benchmark::State& state,
+                                       const GlobalOptimizationMethod& method) {
+    utility::SetVerbosityLevel(utility::VerbosityLevel::Error);
+    const PoseGraph pose_graph_init =
+            CreateSyntheticPoseGraph(static_cast<int>(state.range(0)));
+    const GlobalOptimizationConvergenceCriteria criteria;
+    const GlobalOptimizationOption option;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        PoseGraph pose_graph = pose_graph_init;
+        state.ResumeTiming();
+        GlobalOptimization(pose_graph, method, criteria, option);
+    }
+    state.counters["edges"] =
+            static_cast<double>(pose_graph_init.edges_.size());
+}
+
+BENCHMARK_CAPTURE(BenchmarkGlobalOptimization,
+                  LevenbergMarquardt,
+                  GlobalOptimizationLevenbergMarquardt())
+        ->RangeMultiplier(10)
+        ->Range(100, 20000)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(BenchmarkGlobalOptimization,
+                  GaussNewton,
+                  GlobalOptimizationGaussNewton())
+        ->RangeMultiplier(10)
+        ->Range(100, 20000)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace open3d
@@ -28,6 +28,9 @@
 
 #include <benchmark/benchmark.h>
 
+#include <string>
+
+#include "benchmarks/benchmark_utilities/Rand.h"
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/data/Dataset.h"
@@ -104,6 +107,62 @@ void VoxelDownSample(benchmark::State& state,
     }
 }
 
+// Random points with normals and colors, so that every attribute is reduced.
+static PointCloud RandomPointCloud(const core::Device& device,
+                                   int64_t num_points) {
+    PointCloud pcd(benchmarks::Rand({num_points, 3}, 0, {-1.0, 1.0},
+                                    core::Float32, device));
+    pcd.SetPointNormals(benchmarks::Rand({num_points, 3}, 1, {-1.0, 1.0},
+                                         core::Float32, device));
+    pcd.SetPointColors(benchmarks::Rand({num_points, 3}, 2, {0.0, 1.0},
+                                        core::Float32, device));
+    return pcd;
+}
+
+void LegacyVoxelDownSampleRandom(benchmark::State& state,
+                                 int64_t num_points,
+                                 double voxel_size) {
+    open3d::geometry::PointCloud pcd =
+            RandomPointCloud(core::Device("CPU:0"), num_points).ToLegacy();
+    for (auto _ : state) {
+        pcd.VoxelDownSample(voxel_size);
+    }
+}
+
+void VoxelDownSampleReduction(benchmark::State& state,
+                              const core::Device& device,
+                              int64_t num_points,
+                              double voxel_size,
+                              const std::string& reduction) {
+    PointCloud pcd = RandomPointCloud(device, num_points);
+
+    // Warm up.
+    pcd.VoxelDownSample(voxel_size, core::HashBackendType::Default, reduction);
+
+    for (auto _ : state) {
+        pcd.VoxelDownSample(voxel_size, core::HashBackendType::Default,
+                            reduction);
+        core::cuda::Synchronize(device);
+    }
+}
+
+void FarthestPointDownSample(benchmark::State& state,
+                             const core::Device& device,
+                             const core::Dtype& dtype,
+                             int64_t num_points,
+                             size_t num_samples) {
+    PointCloud pcd(benchmarks::Rand({num_points, 3}, 0, {-1.0, 1.0}, dtype,
+                                    device));
+
+    // Warm up.
+    pcd.FarthestPointDownSample(num_samples);
+
+    for (auto _ : state) {
+        pcd.FarthestPointDownSample(num_samples);
+        core::cuda::Synchronize(device);
+    }
+}
+
 void Transform(benchmark::State& state, const core::Device& device) {
     PointCloud pcd;
     t::io::ReadPointCloud(path, pcd, {"auto", false, false, false});
@@ -148,6 +207,96 @@ void EstimateNormals(benchmark::State& state,
     }
 }
 
+void ClusterDBSCAN(benchmark::State& state,
+                   const core::Device& device,
+                   int64_t num_points,
+                   double eps,
+                   size_t min_points) {
+    PointCloud pcd(benchmarks::Rand({num_points, 3}, 0, {-1.0, 1.0},
+                                    core::Float32, device));
+
+    // Warm up.
+    pcd.ClusterDBSCAN(eps, min_points);
+
+    for (auto _ : state) {
+        pcd.ClusterDBSCAN(eps, min_points);
+        core::cuda::Synchronize(device);
+    }
+}
+
+void LegacyClusterDBSCAN(benchmark::State& state,
+                         int64_t num_points,
+                         double eps,
+                         size_t min_points) {
+    open3d::geometry::PointCloud pcd =
+            PointCloud(benchmarks::Rand({num_points, 3}, 0, {-1.0, 1.0},
+                                        core::Float32, core::Device("CPU:0")))
+                    .ToLegacy();
+    for (auto _ : state) {
+        pcd.ClusterDBSCAN(eps, min_points);
+    }
+}
+
+void RemoveRadiusOutliers(benchmark::State& state,
+                          const core::Device& device,
+                          int64_t num_points,
+                          size_t nb_points,
+                          double search_radius) {
+    PointCloud pcd(benchmarks::Rand({num_points, 3}, 0, {-1.0, 1.0},
+                                    core::Float32, device));
+
+    // Warm up.
+    pcd.RemoveRadiusOutliers(nb_points, search_radius);
+
+    for (auto _ : state) {
+        pcd.RemoveRadiusOutliers(nb_points, search_radius);
+        core::cuda::Synchronize(device);
+    }
+}
+
+void LegacyRemoveRadiusOutliers(benchmark::State& state,
+                                int64_t num_points,
+                                size_t nb_points,
+                                double search_radius) {
+    open3d::geometry::PointCloud pcd =
+            PointCloud(benchmarks::Rand({num_points, 3}, 0, {-1.0, 1.0},
+                                        core::Float32, core::Device("CPU:0")))
+                    .ToLegacy();
+    for (auto _ : state) {
+        pcd.RemoveRadiusOutliers(nb_points, search_radius);
+    }
+}
+
+void RemoveStatisticalOutliers(benchmark::State& state,
+                               const core::Device& device,
+                               int64_t num_points,
+                               size_t nb_neighbors,
+                               double std_ratio) {
+    PointCloud pcd(benchmarks::Rand({num_points, 3}, 0, {-1.0, 1.0},
+                                    core::Float32, device));
+
+    // Warm up.
+    pcd.RemoveStatisticalOutliers(nb_neighbors, std_ratio);
+
+    for (auto _ : state) {
+        pcd.RemoveStatisticalOutliers(nb_neighbors, std_ratio);
+        core::cuda::Synchronize(device);
+    }
+}
+
+void LegacyRemoveStatisticalOutliers(benchmark::State& state,
+                                     int64_t num_points,
+                                     size_t nb_neighbors,
+                                     double std_ratio) {
+    open3d::geometry::PointCloud pcd =
+            PointCloud(benchmarks::Rand({num_points, 3}, 0, {-1.0, 1.0},
+                                        core::Float32, core::Device("CPU:0")))
+                    .ToLegacy();
+    for (auto _ : state) {
+        pcd.RemoveStatisticalOutliers(nb_neighbors, std_ratio);
+    }
+}
+
 void LegacyEstimateNormals(
         benchmark::State& state,
         const double voxel_size,
@@ -217,6 +366,51 @@ BENCHMARK_CAPTURE(LegacyVoxelDownSample, Legacy_0_32, 0.32)
         ->Unit(benchmark::kMillisecond);
 ENUM_VOXELDOWNSAMPLE_BACKEND()
 
+#define ENUM_VOXELDOWNSAMPLE_REDUCTION(DEVICE, DEVICE_NAME)                  \
+    BENCHMARK_CAPTURE(VoxelDownSampleReduction, DEVICE_NAME##_Mean, DEVICE,  \
+                      1000000, 0.02, "mean")                                 \
+            ->Unit(benchmark::kMillisecond);                                 \
+    BENCHMARK_CAPTURE(VoxelDownSampleReduction, DEVICE_NAME##_Min, DEVICE,   \
+                      1000000, 0.02, "min")                                  \
+            ->Unit(benchmark::kMillisecond);                                 \
+    BENCHMARK_CAPTURE(VoxelDownSampleReduction, DEVICE_NAME##_Max, DEVICE,   \
+                      1000000, 0.02, "max")                                  \
+            ->Unit(benchmark::kMillisecond);                                 \
+    BENCHMARK_CAPTURE(VoxelDownSampleReduction, DEVICE_NAME##_First, DEVICE, \
+                      1000000, 0.02, "first")                                \
+            ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(LegacyVoxelDownSampleRandom, Legacy_Mean, 1000000, 0.02)
+        ->Unit(benchmark::kMillisecond);
+ENUM_VOXELDOWNSAMPLE_REDUCTION(core::Device("CPU:0"), CPU)
+#ifdef BUILD_CUDA_MODULE
+ENUM_VOXELDOWNSAMPLE_REDUCTION(core::Device("CUDA:0"), CUDA)
+#endif
+
+BENCHMARK_CAPTURE(FarthestPointDownSample,
+                  CPU F32 200K,
+                  core::Device("CPU:0"),
+                  core::Float32,
+                  200000,
+                  1024)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(FarthestPointDownSample,
+                  CPU F32 2M,
+                  core::Device("CPU:0"),
+                  core::Float32,
+                  2000000,
+                  1024)
+        ->Unit(benchmark::kMillisecond);
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(FarthestPointDownSample,
+                  CUDA F32 2M,
+                  core::Device("CUDA:0"),
+                  core::Float32,
+                  2000000,
+                  1024)
+        ->Unit(benchmark::kMillisecond);
+#endif
+
 BENCHMARK_CAPTURE(Transform, CPU, core::Device("CPU:0"))
         ->Unit(benchmark::kMillisecond);
 
@@ -304,6 +498,42 @@ BENCHMARK_CAPTURE(LegacyEstimateNormals,
                   open3d::geometry::KDTreeSearchParamKNN(30))
         ->Unit(benchmark::kMillisecond);
 
+BENCHMARK_CAPTURE(ClusterDBSCAN, CPU 100K, core::Device("CPU:0"), 100000, 0.1,
+                  10)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ClusterDBSCAN, CPU 1M, core::Device("CPU:0"), 1000000, 0.05,
+                  10)
+        ->Unit(benchmark::kMillisecond);
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(ClusterDBSCAN, CUDA 1M, core::Device("CUDA:0"), 1000000,
+                  0.05, 10)
+        ->Unit(benchmark::kMillisecond);
+#endif
+BENCHMARK_CAPTURE(LegacyClusterDBSCAN, Legacy 100K, 100000, 0.1, 10)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(RemoveRadiusOutliers, CPU 1M, core::Device("CPU:0"), 1000000,
+                  10, 0.03)
+        ->Unit(benchmark::kMillisecond);
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(RemoveRadiusOutliers, CUDA 1M, core::Device("CUDA:0"),
+                  1000000, 10, 0.03)
+        ->Unit(benchmark::kMillisecond);
+#endif
+BENCHMARK_CAPTURE(LegacyRemoveRadiusOutliers, Legacy 1M, 1000000, 10, 0.03)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(RemoveStatisticalOutliers, CPU 1M, core::Device("CPU:0"),
+                  1000000, 20, 2.0)
+        ->Unit(benchmark::kMillisecond);
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(RemoveStatisticalOutliers, CUDA 1M, core::Device("CUDA:0"),
+                  1000000, 20, 2.0)
+        ->Unit(benchmark::kMillisecond);
+#endif
+BENCHMARK_CAPTURE(LegacyRemoveStatisticalOutliers, Legacy 1M, 1000000, 20, 2.0)
+        ->Unit(benchmark::kMillisecond);
+
 }  // namespace geometry
 }  // namespace t
 }  // namespace open3d
@@ -0,0 +1,127 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/TriangleMesh.h"
+
+#include <benchmark/benchmark.h>
+
+#include <limits>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/geometry/TriangleMesh.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+// A sphere with resolution 500 has about 0.5M vertices and 1M triangles.
+static const int kSphereResolution = 500;
+
+void SimplifyVertexClustering(benchmark::State& state,
+                              const core::Device& device,
+                              double voxel_size) {
+    TriangleMesh mesh = TriangleMesh::FromLegacy(
+            *open3d::geometry::TriangleMesh::CreateSphere(1.0,
+                                                          kSphereResolution),
+            core::Float32, core::Int64, device);
+
+    // Warm up.
+    TriangleMesh mesh_simple = mesh.SimplifyVertexClustering(voxel_size);
+    (void)mesh_simple;
+
+    for (auto _ : state) {
+        mesh_simple = mesh.SimplifyVertexClustering(voxel_size);
+        core::cuda::Synchronize(device);
+    }
+}
+
+void LegacySimplifyVertexClustering(benchmark::State& state,
+                                    double voxel_size) {
+    auto mesh = open3d::geometry::TriangleMesh::CreateSphere(
+            1.0, kSphereResolution);
+    for (auto _ : state) {
+        auto mesh_simple = mesh->SimplifyVertexClustering(voxel_size);
+    }
+}
+
+void SimplifyQuadricDecimation(benchmark::State& state,
+                               const core::Device& device,
+                               double target_reduction) {
+    TriangleMesh mesh = TriangleMesh::FromLegacy(
+            *open3d::geometry::TriangleMesh::CreateSphere(1.0,
+                                                          kSphereResolution),
+            core::Float32, core::Int64, device);
+    const int64_t target_number_of_triangles = static_cast<int64_t>(
+            mesh.GetTriangleIndices().GetLength() * (1 - target_reduction));
+
+    for (auto _ : state) {
+        TriangleMesh mesh_simple =
+                mesh.SimplifyQuadricDecimation(target_number_of_triangles);
+        core::cuda::Synchronize(device);
+    }
+}
+
+void LegacySimplifyQuadricDecimation(benchmark::State& state,
+                                     double target_reduction) {
+    auto mesh = open3d::geometry::TriangleMesh::CreateSphere(
+            1.0, kSphereResolution);
+    const int target_number_of_triangles =
+            static_cast<int>(mesh->triangles_.size() * (1 - target_reduction));
+    for (auto _ : state) {
+        auto mesh_simple = mesh->SimplifyQuadricDecimation(
+                target_number_of_triangles,
+                std::numeric_limits<double>::infinity(), 1.0);
+    }
+}
+
+BENCHMARK_CAPTURE(SimplifyVertexClustering, CPU, core::Device("CPU:0"), 0.01)
+        ->Unit(benchmark::kMillisecond);
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(SimplifyVertexClustering, CUDA, core::Device("CUDA:0"), 0.01)
+        ->Unit(benchmark::kMillisecond);
+#endif
+BENCHMARK_CAPTURE(LegacySimplifyVertexClustering, Legacy, 0.01)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(SimplifyQuadricDecimation,
+                  CPU 90%,
+                  core::Device("CPU:0"),
+                  0.9)
+        ->Unit(benchmark::kMillisecond);
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(SimplifyQuadricDecimation,
+                  CUDA 90%,
+                  core::Device("CUDA:0"),
+                  0.9)
+        ->Unit(benchmark::kMillisecond);
+#endif
+BENCHMARK_CAPTURE(LegacySimplifyQuadricDecimation, Legacy 90%, 0.9)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
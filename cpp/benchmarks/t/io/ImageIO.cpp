@@ -0,0 +1,108 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/ImageIO.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/Image.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+// Throughput of reading an image sequence one by one and in a batch. Run
+// with: ./bin/benchmarks --benchmark_filter=".*ReadImage.*"
+
+static const int kNumImages = 64;
+
+static std::vector<std::string> WriteSyntheticImages(
+        const std::string& extension) {
+    std::vector<std::string> filenames;
+    for (int i = 0; i < kNumImages; ++i) {
+        core::Tensor pixels =
+                core::Tensor::Arange(0, 480 * 640 * 3, 1, core::Int64)
+                        .Add(i)
+                        .To(core::UInt8)
+                        .Reshape({480, 640, 3});
+        filenames.push_back("read_images_" + std::to_string(i) + "." +
+                            extension);
+        WriteImage(filenames.back(), geometry::Image(pixels));
+    }
+    return filenames;
+}
+
+static void RemoveSyntheticImages(const std::vector<std::string>& filenames) {
+    for (const std::string& filename : filenames) {
+        std::remove(filename.c_str());
+    }
+}
+
+void ReadImageSerial(benchmark::State& state, const std::string& extension) {
+    const std::vector<std::string> filenames = WriteSyntheticImages(extension);
+    for (auto _ : state) {
+        std::vector<geometry::Image> images(filenames.size());
+        for (size_t i = 0; i < filenames.size(); ++i) {
+            ReadImage(filenames[i], images[i]);
+        }
+        benchmark::DoNotOptimize(images);
+    }
+    state.SetItemsProcessed(state.iterations() * kNumImages);
+    RemoveSyntheticImages(filenames);
+}
+
+void ReadImageBatch(benchmark::State& state, const std::string& extension) {
+    const std::vector<std::string> filenames = WriteSyntheticImages(extension);
+    for (auto _ : state) {
+        std::vector<geometry::Image> images;
+        ReadImages(filenames, images);
+        benchmark::DoNotOptimize(images);
+    }
+    state.SetItemsProcessed(state.iterations() * kNumImages);
+    RemoveSyntheticImages(filenames);
+}
+
+BENCHMARK_CAPTURE(ReadImageSerial, PNG, "png")
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+BENCHMARK_CAPTURE(ReadImageBatch, PNG, "png")
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+BENCHMARK_CAPTURE(ReadImageSerial, JPG, "jpg")
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+BENCHMARK_CAPTURE(ReadImageBatch, JPG, "jpg")
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -28,8 +28,13 @@
 
 #include <benchmark/benchmark.h>
 
+#include <cstdio>
+#include <string>
+#include <vector>
+
 #include "open3d/core/Tensor.h"
 #include "open3d/data/Dataset.h"
+#include "open3d/io/ASCIIParser.h"
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/io/PointCloudIO.h"
 
@@ -143,9 +148,97 @@ void IOReadTensorPointCloud(benchmark::State& state,
             std::string("pcd_bin_compressed") + std::string(EXTENSION),        \
             BINARY_COMPRESSED, false, true)
 
+#define ENUM_BM_IO_ASCII_EXTENSION(EXTENSION_NAME, EXTENSION)        \
+    ENUM_BM_IO_EXTENSION_FORMAT(                                     \
+            EXTENSION_NAME, std::string("ascii") + std::string(EXTENSION), \
+            ASCII_UNCOMPRESSED, true, false)
+
 ENUM_BM_IO_EXTENSION(PCD, ".pcd")
 ENUM_BM_IO_EXTENSION(PLY, ".ply")
 ENUM_BM_IO_EXTENSION(PTS, ".pts")
+ENUM_BM_IO_ASCII_EXTENSION(XYZ, ".xyz")
+ENUM_BM_IO_ASCII_EXTENSION(XYZN, ".xyzn")
+ENUM_BM_IO_ASCII_EXTENSION(XYZRGB, ".xyzrgb")
+
+// Parses `num_points` lines of "x y z i" as written by the XYZI writer.
+void IOParseASCIIRows(benchmark::State& state, int64_t num_points) {
+    std::string text;
+    char line[128];
+    for (int64_t i = 0; i < num_points; ++i) {
+        snprintf(line, sizeof(line), "%.10f %.10f %.10f %.10f\n", i * 1e-3,
+                 i * -2e-3, i * 1.5, static_cast<double>(i % 256));
+        text += line;
+    }
+
+    std::vector<double> values;
+    auto allocate = [&](int64_t num_rows) {
+        values.resize(num_rows * 4);
+        return values.data();
+    };
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(open3d::io::ParseASCIIRows(
+                text.data(), text.size(), 4, allocate));
+    }
+    state.SetBytesProcessed(int64_t(state.iterations()) * text.size());
+}
+
+BENCHMARK_CAPTURE(IOParseASCIIRows, 1M, 1000000)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(IOParseASCIIRows, 10M, 10000000)
+        ->Unit(benchmark::kMillisecond);
+
+// A structured point cloud with normals, colors and a label per point, which
+// compresses roughly like a scan.
+static PointCloud MakeSyntheticPointCloud(int64_t num_points) {
+    PointCloud pcd(core::Tensor::Arange(0, num_points * 3, 1, core::Float32)
+                           .Reshape({num_points, 3})
+                           .Div(1000));
+    pcd.SetPointNormals(pcd.GetPointPositions().Sin());
+    pcd.SetPointColors(core::Tensor::Arange(0, num_points * 3, 1, core::Int32)
+                               .Reshape({num_points, 3})
+                               .To(core::UInt8));
+    pcd.SetPointAttr("labels", core::Tensor::Arange(0, num_points, 1,
+                                                     core::Int32)
+                                       .Div(64)
+                                       .Reshape({num_points, 1}));
+    return pcd;
+}
+
+void IOWriteTensorPCD(benchmark::State& state,
+                      int64_t num_points,
+                      const bool write_compressed) {
+    const PointCloud pcd = MakeSyntheticPointCloud(num_points);
+    const std::string filename = "tensor_pcd_synthetic.pcd";
+    for (auto _ : state) {
+        t::io::WritePointCloud(filename, pcd,
+                               open3d::io::WritePointCloudOption(
+                                       false, write_compressed, false, {}));
+    }
+    std::remove(filename.c_str());
+}
+
+void IOReadTensorPCD(benchmark::State& state,
+                     int64_t num_points,
+                     const bool write_compressed) {
+    const std::string filename = "tensor_pcd_synthetic.pcd";
+    t::io::WritePointCloud(filename, MakeSyntheticPointCloud(num_points),
+                           open3d::io::WritePointCloudOption(
+                                   false, write_compressed, false, {}));
+    PointCloud pcd;
+    for (auto _ : state) {
+        t::io::ReadPointCloud(filename, pcd, {"auto", false, false, false});
+    }
+    std::remove(filename.c_str());
+}
+
+BENCHMARK_CAPTURE(IOWriteTensorPCD, BINARY_5M, 5000000, false)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(IOWriteTensorPCD, BINARY_COMPRESSED_5M, 5000000, true)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(IOReadTensorPCD, BINARY_5M, 5000000, false)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(IOReadTensorPCD, BINARY_COMPRESSED_5M, 5000000, true)
+        ->Unit(benchmark::kMillisecond);
 
 }  // namespace geometry
 }  // namespace t
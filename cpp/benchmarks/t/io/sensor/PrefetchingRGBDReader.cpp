@@ -0,0 +1,134 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/sensor/PrefetchingRGBDReader.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/Image.h"
+#include "open3d/t/geometry/RGBDImage.h"
+#include "open3d/t/io/ImageIO.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+// Frames per second of reading a VGA PNG sequence and uploading it to the
+// device, synchronously and with prefetching. Run with:
+// ./bin/benchmarks --benchmark_filter=".*RGBD.*"
+
+static const int kNumFrames = 32;
+
+static void WriteSyntheticSequence(std::vector<std::string>& color_files,
+                                   std::vector<std::string>& depth_files) {
+    for (int i = 0; i < kNumFrames; ++i) {
+        core::Tensor color = core::Tensor::Full(
+                {480, 640, 3}, static_cast<uint8_t>(i), core::UInt8);
+        core::Tensor depth = core::Tensor::Arange(0, 480 * 640, 1, core::Int64)
+                                     .Add(i)
+                                     .To(core::UInt16)
+                                     .Reshape({480, 640, 1});
+        color_files.push_back("rgbd_prefetch_color_" + std::to_string(i) +
+                              ".png");
+        depth_files.push_back("rgbd_prefetch_depth_" + std::to_string(i) +
+                              ".png");
+        WriteImage(color_files.back(), geometry::Image(color));
+        WriteImage(depth_files.back(), geometry::Image(depth));
+    }
+}
+
+static void RemoveSyntheticSequence(
+        const std::vector<std::string>& color_files,
+        const std::vector<std::string>& depth_files) {
+    for (size_t i = 0; i < color_files.size(); ++i) {
+        std::remove(color_files[i].c_str());
+        std::remove(depth_files[i].c_str());
+    }
+}
+
+void ReadRGBDSequential(benchmark::State& state, const core::Device& device) {
+    std::vector<std::string> color_files, depth_files;
+    WriteSyntheticSequence(color_files, depth_files);
+    for (auto _ : state) {
+        for (int i = 0; i < kNumFrames; ++i) {
+            geometry::Image color, depth;
+            ReadImage(color_files[i], color);
+            ReadImage(depth_files[i], depth);
+            geometry::RGBDImage frame =
+                    geometry::RGBDImage(color, depth).To(device);
+            benchmark::DoNotOptimize(frame);
+        }
+    }
+    state.counters["FPS"] = benchmark::Counter(
+            kNumFrames, benchmark::Counter::kIsIterationInvariantRate);
+    RemoveSyntheticSequence(color_files, depth_files);
+}
+
+void ReadRGBDPrefetched(benchmark::State& state,
+                        const core::Device& device,
+                        int num_threads) {
+    std::vector<std::string> color_files, depth_files;
+    WriteSyntheticSequence(color_files, depth_files);
+    for (auto _ : state) {
+        PrefetchingRGBDReader reader(color_files, depth_files, device, 8,
+                                     num_threads);
+        while (!reader.IsEOF()) {
+            geometry::RGBDImage frame = reader.NextFrame();
+            benchmark::DoNotOptimize(frame);
+        }
+    }
+    state.counters["FPS"] = benchmark::Counter(
+            kNumFrames, benchmark::Counter::kIsIterationInvariantRate);
+    RemoveSyntheticSequence(color_files, depth_files);
+}
+
+BENCHMARK_CAPTURE(ReadRGBDSequential, CPU, core::Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+BENCHMARK_CAPTURE(ReadRGBDPrefetched, CPU_1, core::Device("CPU:0"), 1)
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+BENCHMARK_CAPTURE(ReadRGBDPrefetched, CPU_4, core::Device("CPU:0"), 4)
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(ReadRGBDSequential, CUDA, core::Device("CUDA:0"))
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+BENCHMARK_CAPTURE(ReadRGBDPrefetched, CUDA_4, core::Device("CUDA:0"), 4)
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+#endif
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,106 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/registration/Feature.h"
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/data/Dataset.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/io/PointCloudIO.h"
+#include "open3d/pipelines/registration/Feature.h"
+#include "open3d/t/geometry/PointCloud.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace registration {
+
+// Neighbor search parameters.
+static const double voxel_size = 0.01;
+static const double radius = 0.05;
+static const int max_nn = 100;
+
+static open3d::geometry::PointCloud LoadLegacyPointCloud() {
+    data::PCDPointCloud pcd_fragment;
+    open3d::geometry::PointCloud pcd;
+    open3d::io::ReadPointCloud(pcd_fragment.GetPath(), pcd);
+    pcd = *pcd.VoxelDownSample(voxel_size);
+    pcd.EstimateNormals();
+    return pcd;
+}
+
+static void LegacyComputeFPFHFeature(benchmark::State& state) {
+    utility::SetVerbosityLevel(utility::VerbosityLevel::Error);
+    const open3d::geometry::PointCloud pcd = LoadLegacyPointCloud();
+
+    // Warm up.
+    auto fpfh = open3d::pipelines::registration::ComputeFPFHFeature(
+            pcd, open3d::geometry::KDTreeSearchParamHybrid(radius, max_nn));
+
+    for (auto _ : state) {
+        fpfh = open3d::pipelines::registration::ComputeFPFHFeature(
+                pcd, open3d::geometry::KDTreeSearchParamHybrid(radius, max_nn));
+    }
+}
+
+static void ComputeFPFHFeature(benchmark::State& state,
+                               const core::Device& device,
+                               const core::Dtype& dtype) {
+    utility::SetVerbosityLevel(utility::VerbosityLevel::Error);
+    const geometry::PointCloud pcd = geometry::PointCloud::FromLegacy(
+            LoadLegacyPointCloud(), dtype, device);
+
+    // Warm up.
+    core::Tensor fpfh = ComputeFPFHFeature(pcd, max_nn, radius);
+
+    for (auto _ : state) {
+        fpfh = ComputeFPFHFeature(pcd, max_nn, radius);
+        core::cuda::Synchronize(device);
+    }
+}
+
+BENCHMARK(LegacyComputeFPFHFeature)->Unit(benchmark::kMillisecond);
+
+#define ENUM_FPFH_DEVICE(DEVICE)                                     \
+    BENCHMARK_CAPTURE(ComputeFPFHFeature, DEVICE Float32,           \
+                      core::Device(DEVICE), core::Float32)          \
+            ->Unit(benchmark::kMillisecond);                        \
+    BENCHMARK_CAPTURE(ComputeFPFHFeature, DEVICE Float64,           \
+                      core::Device(DEVICE), core::Float64)          \
+            ->Unit(benchmark::kMillisecond);
+
+ENUM_FPFH_DEVICE("CPU:0")
+
+#ifdef BUILD_CUDA_MODULE
+ENUM_FPFH_DEVICE("CUDA:0")
+#endif
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -32,6 +32,7 @@
 
 #include "open3d/core/Device.h"
 #include "open3d/core/MemoryManager.h"
+#include "open3d/core/ScopedArena.h"
 
 namespace open3d {
 namespace core {
@@ -57,12 +58,19 @@ class Blob {
 public:
     /// Construct Blob on a specified device.
     ///
+    /// If the calling thread has an open ScopedArena on \p device, the memory
+    /// is taken from the arena. Otherwise, it is allocated by MemoryManager.
+    ///
     /// \param byte_size Size of the blob in bytes.
     /// \param device Device where the blob resides.
     Blob(int64_t byte_size, const Device& device)
         : deleter_(nullptr),
-          data_ptr_(MemoryManager::Malloc(byte_size, device)),
-          device_(device) {}
+          data_ptr_(ScopedArena::Malloc(byte_size, device, deleter_)),
+          device_(device) {
+        if (data_ptr_ == nullptr) {
+            data_ptr_ = MemoryManager::Malloc(byte_size, device);
+        }
+    }
 
     /// Construct Blob with externally managed memory.
     ///
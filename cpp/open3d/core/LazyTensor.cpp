@@ -0,0 +1,219 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/LazyTensor.h"
+
+#include <algorithm>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Indexer.h"
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+
+LazyTensor::LazyTensor(const Tensor& tensor) {
+    auto node = std::make_shared<Node>();
+    node->op_code_ = kernel::FusedEWOpCode::Load;
+    node->tensor_ = tensor;
+    node_ = node;
+}
+
+LazyTensor LazyTensor::Constant(Scalar value) {
+    auto node = std::make_shared<Node>();
+    node->op_code_ = kernel::FusedEWOpCode::Const;
+    node->value_ = value;
+    return LazyTensor(node);
+}
+
+LazyTensor LazyTensor::Unary(kernel::FusedEWOpCode op_code) const {
+    auto node = std::make_shared<Node>();
+    node->op_code_ = op_code;
+    node->lhs_ = node_;
+    return LazyTensor(node);
+}
+
+LazyTensor LazyTensor::Binary(kernel::FusedEWOpCode op_code,
+                              const LazyTensor& value) const {
+    auto node = std::make_shared<Node>();
+    node->op_code_ = op_code;
+    node->lhs_ = node_;
+    node->rhs_ = value.node_;
+    return LazyTensor(node);
+}
+
+LazyTensor LazyTensor::Add(const LazyTensor& value) const {
+    return Binary(kernel::FusedEWOpCode::Add, value);
+}
+
+LazyTensor LazyTensor::Sub(const LazyTensor& value) const {
+    return Binary(kernel::FusedEWOpCode::Sub, value);
+}
+
+LazyTensor LazyTensor::Mul(const LazyTensor& value) const {
+    return Binary(kernel::FusedEWOpCode::Mul, value);
+}
+
+LazyTensor LazyTensor::Div(const LazyTensor& value) const {
+    return Binary(kernel::FusedEWOpCode::Div, value);
+}
+
+void LazyTensor::CollectLeaves(const std::shared_ptr<const Node>& node,
+                               std::vector<const Node*>& leaves) {
+    if (node->op_code_ == kernel::FusedEWOpCode::Load) {
+        // The same leaf may be referenced multiple times, e.g. in a * a.
+        if (std::find(leaves.begin(), leaves.end(), node.get()) ==
+            leaves.end()) {
+            leaves.push_back(node.get());
+        }
+        return;
+    }
+    if (node->lhs_ != nullptr) {
+        CollectLeaves(node->lhs_, leaves);
+    }
+    if (node->rhs_ != nullptr) {
+        CollectLeaves(node->rhs_, leaves);
+    }
+}
+
+int64_t LazyTensor::Compile(const std::shared_ptr<const Node>& node,
+                            const std::vector<const Node*>& leaves,
+                            std::vector<kernel::FusedEWInstruction>& program) {
+    kernel::FusedEWInstruction instruction;
+    instruction.op_code_ = node->op_code_;
+    if (node->op_code_ == kernel::FusedEWOpCode::Load) {
+        instruction.lhs_ =
+                std::find(leaves.begin(), leaves.end(), node.get()) -
+                leaves.begin();
+    } else if (node->op_code_ == kernel::FusedEWOpCode::Const) {
+        instruction.value_ = node->value_;
+    } else {
+        instruction.lhs_ = Compile(node->lhs_, leaves, program);
+        if (node->rhs_ != nullptr) {
+            instruction.rhs_ = Compile(node->rhs_, leaves, program);
+        }
+    }
+    program.push_back(instruction);
+    return static_cast<int64_t>(program.size()) - 1;
+}
+
+Tensor LazyTensor::EvalEager(const std::shared_ptr<const Node>& node,
+                             Dtype dtype,
+                             const Device& device) {
+    switch (node->op_code_) {
+        case kernel::FusedEWOpCode::Load:
+            return node->tensor_;
+        case kernel::FusedEWOpCode::Const: {
+            Tensor constant;
+            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype, [&]() {
+                constant = Tensor::Full({}, node->value_.To<scalar_t>(), dtype,
+                                        device);
+            });
+            return constant;
+        }
+        case kernel::FusedEWOpCode::Neg:
+            return EvalEager(node->lhs_, dtype, device).Neg();
+        case kernel::FusedEWOpCode::Abs:
+            return EvalEager(node->lhs_, dtype, device).Abs();
+        case kernel::FusedEWOpCode::Sqrt:
+            return EvalEager(node->lhs_, dtype, device).Sqrt();
+        case kernel::FusedEWOpCode::Exp:
+            return EvalEager(node->lhs_, dtype, device).Exp();
+        case kernel::FusedEWOpCode::Sin:
+            return EvalEager(node->lhs_, dtype, device).Sin();
+        case kernel::FusedEWOpCode::Cos:
+            return EvalEager(node->lhs_, dtype, device).Cos();
+        case kernel::FusedEWOpCode::Add:
+            return EvalEager(node->lhs_, dtype, device)
+                    .Add(EvalEager(node->rhs_, dtype, device));
+        case kernel::FusedEWOpCode::Sub:
+            return EvalEager(node->lhs_, dtype, device)
+                    .Sub(EvalEager(node->rhs_, dtype, device));
+        case kernel::FusedEWOpCode::Mul:
+            return EvalEager(node->lhs_, dtype, device)
+                    .Mul(EvalEager(node->rhs_, dtype, device));
+        case kernel::FusedEWOpCode::Div:
+            return EvalEager(node->lhs_, dtype, device)
+                    .Div(EvalEager(node->rhs_, dtype, device));
+        default:
+            utility::LogError("Unimplemented op_code for LazyTensor.");
+    }
+    return Tensor();
+}
+
+Tensor LazyTensor::EvalUnfused() const {
+    std::vector<const Node*> leaves;
+    CollectLeaves(node_, leaves);
+    if (leaves.empty()) {
+        utility::LogError("LazyTensor: Expression does not contain a tensor.");
+    }
+    return EvalEager(node_, leaves[0]->tensor_.GetDtype(),
+                     leaves[0]->tensor_.GetDevice());
+}
+
+Tensor LazyTensor::Eval() const {
+    std::vector<const Node*> leaves;
+    CollectLeaves(node_, leaves);
+    if (leaves.empty()) {
+        utility::LogError("LazyTensor: Expression does not contain a tensor.");
+    }
+
+    const Dtype dtype = leaves[0]->tensor_.GetDtype();
+    const Device device = leaves[0]->tensor_.GetDevice();
+    bool fusable = device.GetType() == Device::DeviceType::CPU &&
+                   dtype != core::Bool &&
+                   static_cast<int64_t>(leaves.size()) <= MAX_INPUTS;
+    SizeVector shape = leaves[0]->tensor_.GetShape();
+    for (const Node* leaf : leaves) {
+        // Mismatches are reported by the eager ops.
+        if (leaf->tensor_.GetDtype() != dtype ||
+            leaf->tensor_.GetDevice() != device ||
+            !shape_util::IsCompatibleBroadcastShape(
+                    shape, leaf->tensor_.GetShape())) {
+            fusable = false;
+            break;
+        }
+        shape = shape_util::BroadcastedShape(shape, leaf->tensor_.GetShape());
+    }
+    if (!fusable) {
+        return EvalEager(node_, dtype, device);
+    }
+
+    std::vector<Tensor> inputs;
+    for (const Node* leaf : leaves) {
+        inputs.push_back(leaf->tensor_);
+    }
+    std::vector<kernel::FusedEWInstruction> program;
+    Compile(node_, leaves, program);
+
+    Tensor dst(shape, dtype, device);
+    kernel::FusedEW(inputs, program, dst);
+    return dst;
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,188 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "open3d/core/Scalar.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/FusedEW.h"
+
+namespace open3d {
+namespace core {
+
+/// Deferred elementwise expression over Tensors.
+///
+/// Arithmetic on a LazyTensor does not launch any kernel. Instead, an
+/// expression graph is recorded and evaluated by Eval(), which fuses the whole
+/// graph into a single pass over the output. No intermediate tensors are
+/// materialized, e.g.
+///
+/// \code{.cpp}
+/// core::Tensor r = ((core::LazyTensor(a) - b) * c + d).Eval();
+/// \endcode
+///
+/// reads a, b, c, d once and writes r once, where the eager `(a - b) * c + d`
+/// launches three kernels and writes two temporaries.
+///
+/// All tensors of an expression must share dtype and device and must be
+/// broadcastable to a common shape. Fusion is done on CPU for expressions
+/// with up to MAX_INPUTS distinct tensors. Otherwise, Eval() falls back to
+/// eager evaluation with identical results.
+class LazyTensor {
+public:
+    /// Wraps \p tensor as a leaf of an expression. The tensor is captured by
+    /// reference semantics, i.e. in-place changes before Eval() are visible.
+    LazyTensor(const Tensor& tensor);
+
+    LazyTensor Neg() const { return Unary(kernel::FusedEWOpCode::Neg); }
+    LazyTensor Abs() const { return Unary(kernel::FusedEWOpCode::Abs); }
+    LazyTensor Sqrt() const { return Unary(kernel::FusedEWOpCode::Sqrt); }
+    LazyTensor Exp() const { return Unary(kernel::FusedEWOpCode::Exp); }
+    LazyTensor Sin() const { return Unary(kernel::FusedEWOpCode::Sin); }
+    LazyTensor Cos() const { return Unary(kernel::FusedEWOpCode::Cos); }
+
+    LazyTensor operator-() const { return Neg(); }
+
+    LazyTensor Add(const LazyTensor& value) const;
+    LazyTensor Sub(const LazyTensor& value) const;
+    LazyTensor Mul(const LazyTensor& value) const;
+    LazyTensor Div(const LazyTensor& value) const;
+
+    /// Evaluates the expression into a new tensor.
+    Tensor Eval() const;
+
+    /// Evaluates the expression without fusion, launching one kernel per
+    /// operation. Mainly useful for testing and benchmarking.
+    Tensor EvalUnfused() const;
+
+    /// Creates a constant leaf with the dtype of the expression it is
+    /// combined with.
+    static LazyTensor Constant(Scalar value);
+
+protected:
+    struct Node {
+        kernel::FusedEWOpCode op_code_;
+        Tensor tensor_;
+        Scalar value_ = Scalar(0);
+        std::shared_ptr<const Node> lhs_;
+        std::shared_ptr<const Node> rhs_;
+    };
+
+    explicit LazyTensor(const std::shared_ptr<const Node>& node)
+        : node_(node) {}
+
+    LazyTensor Unary(kernel::FusedEWOpCode op_code) const;
+    LazyTensor Binary(kernel::FusedEWOpCode op_code,
+                      const LazyTensor& value) const;
+
+    /// Collects the distinct tensor leaves in evaluation order.
+    static void CollectLeaves(const std::shared_ptr<const Node>& node,
+                              std::vector<const Node*>& leaves);
+
+    /// Appends the instructions computing \p node to \p program and returns
+    /// the register holding its result.
+    static int64_t Compile(const std::shared_ptr<const Node>& node,
+                           const std::vector<const Node*>& leaves,
+                           std::vector<kernel::FusedEWInstruction>& program);
+
+    static Tensor EvalEager(const std::shared_ptr<const Node>& node,
+                            Dtype dtype,
+                            const Device& device);
+
+    std::shared_ptr<const Node> node_;
+};
+
+inline LazyTensor operator+(const LazyTensor& lhs, const LazyTensor& rhs) {
+    return lhs.Add(rhs);
+}
+inline LazyTensor operator-(const LazyTensor& lhs, const LazyTensor& rhs) {
+    return lhs.Sub(rhs);
+}
+inline LazyTensor operator*(const LazyTensor& lhs, const LazyTensor& rhs) {
+    return lhs.Mul(rhs);
+}
+inline LazyTensor operator/(const LazyTensor& lhs, const LazyTensor& rhs) {
+    return lhs.Div(rhs);
+}
+
+// Overloads for mixed operands. These take precedence over the templated
+// scalar operators declared in Tensor.h.
+inline LazyTensor operator+(const LazyTensor& lhs, const Tensor& rhs) {
+    return lhs.Add(rhs);
+}
+inline LazyTensor operator-(const LazyTensor& lhs, const Tensor& rhs) {
+    return lhs.Sub(rhs);
+}
+inline LazyTensor operator*(const LazyTensor& lhs, const Tensor& rhs) {
+    return lhs.Mul(rhs);
+}
+inline LazyTensor operator/(const LazyTensor& lhs, const Tensor& rhs) {
+    return lhs.Div(rhs);
+}
+inline LazyTensor operator+(const Tensor& lhs, const LazyTensor& rhs) {
+    return LazyTensor(lhs).Add(rhs);
+}
+inline LazyTensor operator-(const Tensor& lhs, const LazyTensor& rhs) {
+    return LazyTensor(lhs).Sub(rhs);
+}
+inline LazyTensor operator*(const Tensor& lhs, const LazyTensor& rhs) {
+    return LazyTensor(lhs).Mul(rhs);
+}
+inline LazyTensor operator/(const Tensor& lhs, const LazyTensor& rhs) {
+    return LazyTensor(lhs).Div(rhs);
+}
+
+inline LazyTensor operator+(const LazyTensor& lhs, Scalar rhs) {
+    return lhs.Add(LazyTensor::Constant(rhs));
+}
+inline LazyTensor operator-(const LazyTensor& lhs, Scalar rhs) {
+    return lhs.Sub(LazyTensor::Constant(rhs));
+}
+inline LazyTensor operator*(const LazyTensor& lhs, Scalar rhs) {
+    return lhs.Mul(LazyTensor::Constant(rhs));
+}
+inline LazyTensor operator/(const LazyTensor& lhs, Scalar rhs) {
+    return lhs.Div(LazyTensor::Constant(rhs));
+}
+
+inline LazyTensor operator+(Scalar lhs, const LazyTensor& rhs) {
+    return LazyTensor::Constant(lhs).Add(rhs);
+}
+inline LazyTensor operator-(Scalar lhs, const LazyTensor& rhs) {
+    return LazyTensor::Constant(lhs).Sub(rhs);
+}
+inline LazyTensor operator*(Scalar lhs, const LazyTensor& rhs) {
+    return LazyTensor::Constant(lhs).Mul(rhs);
+}
+inline LazyTensor operator/(Scalar lhs, const LazyTensor& rhs) {
+    return LazyTensor::Constant(lhs).Div(rhs);
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -99,6 +99,24 @@ void MemoryManager::MemcpyToHost(void* host_ptr,
     Memcpy(host_ptr, Device("CPU:0"), src_ptr, src_device, num_bytes);
 }
 
+void MemoryManager::SetCPUMemoryPoolEnabled(bool enabled) {
+    GetCPUPooledMemoryManager()->SetEnabled(enabled);
+}
+
+bool MemoryManager::IsCPUMemoryPoolEnabled() {
+    return GetCPUPooledMemoryManager()->IsEnabled();
+}
+
+void MemoryManager::ReleaseCPUMemoryPool() {
+    GetCPUPooledMemoryManager()->ReleasePool();
+}
+
+std::shared_ptr<PooledMemoryManager>
+MemoryManager::GetCPUPooledMemoryManager() {
+    return std::static_pointer_cast<PooledMemoryManager>(
+            GetDeviceMemoryManager(Device("CPU:0")));
+}
+
 std::shared_ptr<DeviceMemoryManager> MemoryManager::GetDeviceMemoryManager(
         const Device& device) {
     static std::unordered_map<Device::DeviceType,
@@ -106,7 +124,9 @@ std::shared_ptr<DeviceMemoryManager> MemoryManager::GetDeviceMemoryManager(
                               utility::hash_enum_class>
             map_device_type_to_memory_manager = {
                     {Device::DeviceType::CPU,
-                     std::make_shared<CPUMemoryManager>()},
+                     std::make_shared<PooledMemoryManager>(
+                             std::make_shared<CPUMemoryManager>(),
+                             /*enabled=*/false)},
 #ifdef BUILD_CUDA_MODULE
 #ifdef BUILD_CACHED_CUDA_MANAGER
                     {Device::DeviceType::CUDA,
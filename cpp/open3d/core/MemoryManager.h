@@ -38,6 +38,7 @@ namespace open3d {
 namespace core {
 
 class DeviceMemoryManager;
+class PooledMemoryManager;
 
 /// Top-level memory interface. Calls to any of the member functions will
 /// automatically dispatch the appropriate DeviceMemoryManager instance based on
@@ -45,7 +46,8 @@ class DeviceMemoryManager;
 ///
 /// The memory managers are dispatched as follows:
 ///
-/// DeviceType = CPU : CPUMemoryManager
+/// DeviceType = CPU : PooledMemoryManager w/ CPUMemoryManager
+///   (pooling is disabled by default, see \p SetCPUMemoryPoolEnabled)
 /// DeviceType = CUDA :
 ///   BUILD_CACHED_CUDA_MANAGER = ON : CachedMemoryManager w/ CUDAMemoryManager
 ///   Otherwise :                      CUDAMemoryManager
@@ -79,10 +81,23 @@ public:
                              const Device& src_device,
                              size_t num_bytes);
 
+    /// Enables or disables pooling of small host allocations. Blocks which
+    /// were allocated before the switch are always freed correctly.
+    static void SetCPUMemoryPoolEnabled(bool enabled);
+
+    /// Returns true if small host allocations are served from the pool.
+    static bool IsCPUMemoryPoolEnabled();
+
+    /// Frees all host memory blocks currently held by the pool.
+    static void ReleaseCPUMemoryPool();
+
 protected:
     /// Internally dispatches the appropriate DeviceMemoryManager instance.
     static std::shared_ptr<DeviceMemoryManager> GetDeviceMemoryManager(
             const Device& device);
+
+    /// Returns the pooled memory manager used for host memory.
+    static std::shared_ptr<PooledMemoryManager> GetCPUPooledMemoryManager();
 };
 
 /// Interface for all concrete memory manager classses.
@@ -155,6 +170,68 @@ protected:
     std::shared_ptr<DeviceMemoryManager> device_mm_;
 };
 
+class MemoryPool;
+
+/// Pooled memory manager for host memory. This class can be used to speed-up
+/// frequent allocations and deallocations of small, short-lived buffers.
+///
+/// - Requests up to \p kMaxPooledByteSize bytes are rounded up to power-of-two
+/// size classes. Larger requests are forwarded to the direct memory manager.
+///
+/// - Freed blocks are kept in a thread-local free list of their size class.
+/// Overflowing thread-local lists are spilled into a shared free list which
+/// also serves as fallback for threads with empty local lists.
+///
+/// - Every block carries a small header recording its size class, so pooling
+/// can be enabled or disabled at any time without tracking live allocations.
+///
+/// - Pooled blocks are only returned to the direct memory manager when
+/// \p ReleasePool is called, the owning thread exits, or at program end.
+///
+class PooledMemoryManager : public DeviceMemoryManager {
+public:
+    /// Largest allocation size (including the block header) that is served
+    /// from the pool.
+    static constexpr size_t kMaxPooledByteSize = size_t(1) << 22;
+
+    /// Constructs a pooled memory manager instance that wraps the existing
+    /// direct memory manager \p device_mm.
+    explicit PooledMemoryManager(
+            const std::shared_ptr<DeviceMemoryManager>& device_mm,
+            bool enabled = true);
+
+    /// Allocates memory of \p byte_size bytes on device \p device and returns a
+    /// pointer to the beginning of the allocated memory block.
+    void* Malloc(size_t byte_size, const Device& device) override;
+
+    /// Frees previously allocated memory at address \p ptr on device \p device.
+    void Free(void* ptr, const Device& device) override;
+
+    /// Copies \p num_bytes bytes of memory at address \p src_ptr on device
+    /// \p src_device to address \p dst_ptr on device \p dst_device.
+    void Memcpy(void* dst_ptr,
+                const Device& dst_device,
+                const void* src_ptr,
+                const Device& src_device,
+                size_t num_bytes) override;
+
+public:
+    /// Enables or disables serving allocations from the pool.
+    void SetEnabled(bool enabled);
+
+    /// Returns true if allocations are served from the pool.
+    bool IsEnabled() const;
+
+    /// Frees all blocks held by the shared free lists and by the free lists of
+    /// the calling thread. Free lists of other threads are released when the
+    /// respective thread exits.
+    void ReleasePool();
+
+protected:
+    std::shared_ptr<DeviceMemoryManager> device_mm_;
+    std::shared_ptr<MemoryPool> pool_;
+};
+
 /// Direct memory manager which performs allocations and deallocations on the
 /// CPU via \p std::malloc and \p std::free.
 class CPUMemoryManager : public DeviceMemoryManager {
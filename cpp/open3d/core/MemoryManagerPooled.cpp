@@ -0,0 +1,277 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "open3d/core/MemoryManager.h"
+#include "open3d/core/MemoryManagerStatistic.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+
+// Smallest size class is 2^kMinSizeClassShift bytes, the largest one is
+// PooledMemoryManager::kMaxPooledByteSize bytes.
+static constexpr size_t kMinSizeClassShift = 6;
+static constexpr size_t kMaxSizeClassShift = 22;
+static constexpr size_t kNumSizeClasses =
+        kMaxSizeClassShift - kMinSizeClassShift + 1;
+static_assert(size_t(1) << kMaxSizeClassShift ==
+                      PooledMemoryManager::kMaxPooledByteSize,
+              "Largest size class must match kMaxPooledByteSize.");
+
+// Marks blocks which were allocated directly and must never be pooled.
+static constexpr uint32_t kUnpooled = 0xFFFFFFFF;
+
+// Thread-local free lists hold at most this many blocks per size class.
+// Overflowing lists spill half of their blocks into the shared free list.
+static constexpr size_t kMaxLocalBlocks = 32;
+
+// Number of blocks fetched at once from the shared free list.
+static constexpr size_t kRefillBlocks = 8;
+
+/// Header stored in front of each block. Its size preserves the alignment
+/// guarantees of the direct memory manager.
+struct alignas(16) BlockHeader {
+    uint32_t size_class_;
+};
+static_assert(sizeof(BlockHeader) == 16, "Unexpected block header size.");
+
+static inline uint32_t SizeClassOf(size_t internal_byte_size) {
+    uint32_t size_class = 0;
+    while ((size_t(1) << (size_class + kMinSizeClassShift)) <
+           internal_byte_size) {
+        ++size_class;
+    }
+    return size_class;
+}
+
+static inline size_t ByteSizeOf(uint32_t size_class) {
+    return size_t(1) << (size_class + kMinSizeClassShift);
+}
+
+using FreeLists = std::array<std::vector<void*>, kNumSizeClasses>;
+
+/// Shared fallback free lists of one PooledMemoryManager instance. Instances
+/// are kept alive by the thread-local caches referring to them, so blocks
+/// spilled by exiting threads always find their way back.
+class MemoryPool {
+public:
+    explicit MemoryPool(const std::shared_ptr<DeviceMemoryManager>& device_mm)
+        : device_mm_(device_mm) {}
+
+    MemoryPool(const MemoryPool&) = delete;
+    MemoryPool& operator=(const MemoryPool&) = delete;
+
+    ~MemoryPool() { Release(); }
+
+    /// Moves up to \p max_count blocks of \p size_class into \p blocks.
+    void Take(uint32_t size_class,
+              std::vector<void*>& blocks,
+              size_t max_count) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto& free_blocks = free_lists_[size_class];
+        while (!free_blocks.empty() && max_count > 0) {
+            blocks.push_back(free_blocks.back());
+            free_blocks.pop_back();
+            --max_count;
+        }
+    }
+
+    /// Moves the last \p count blocks of \p blocks into the shared list.
+    void Put(uint32_t size_class, std::vector<void*>& blocks, size_t count) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto& free_blocks = free_lists_[size_class];
+        free_blocks.insert(free_blocks.end(), blocks.end() - count,
+                           blocks.end());
+        blocks.resize(blocks.size() - count);
+    }
+
+    /// Returns all blocks in \p free_lists to the direct memory manager.
+    void FreeBlocks(FreeLists& free_lists) {
+        for (auto& free_blocks : free_lists) {
+            for (void* block : free_blocks) {
+                device_mm_->Free(block, Device("CPU:0"));
+            }
+            free_blocks.clear();
+        }
+    }
+
+    /// Returns all shared blocks to the direct memory manager.
+    void Release() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        FreeBlocks(free_lists_);
+    }
+
+    const std::shared_ptr<DeviceMemoryManager>& GetDeviceMemoryManager() {
+        return device_mm_;
+    }
+
+    std::atomic<bool> enabled_{true};
+
+private:
+    std::shared_ptr<DeviceMemoryManager> device_mm_;
+    FreeLists free_lists_;
+    std::mutex mutex_;
+};
+
+/// Free lists of the calling thread for every pool it has used. Blocks are
+/// spilled into the shared free lists when the thread exits.
+class ThreadCache {
+public:
+    static ThreadCache& GetInstance() {
+        static thread_local ThreadCache instance;
+        return instance;
+    }
+
+    ~ThreadCache() {
+        for (auto& entry : caches_) {
+            for (uint32_t size_class = 0; size_class < kNumSizeClasses;
+                 ++size_class) {
+                auto& blocks = entry.second[size_class];
+                entry.first->Put(size_class, blocks, blocks.size());
+            }
+        }
+    }
+
+    FreeLists& GetFreeLists(const std::shared_ptr<MemoryPool>& pool) {
+        // Linear search, there is typically only a single pool.
+        for (auto& entry : caches_) {
+            if (entry.first == pool) {
+                return entry.second;
+            }
+        }
+        caches_.emplace_back(pool, FreeLists());
+        return caches_.back().second;
+    }
+
+private:
+    ThreadCache() = default;
+
+    std::vector<std::pair<std::shared_ptr<MemoryPool>, FreeLists>> caches_;
+};
+
+PooledMemoryManager::PooledMemoryManager(
+        const std::shared_ptr<DeviceMemoryManager>& device_mm, bool enabled)
+    : device_mm_(device_mm), pool_(std::make_shared<MemoryPool>(device_mm)) {
+    if (std::dynamic_pointer_cast<PooledMemoryManager>(device_mm_) != nullptr ||
+        std::dynamic_pointer_cast<CachedMemoryManager>(device_mm_) != nullptr) {
+        utility::LogError(
+                "An instance of type PooledMemoryManager or "
+                "CachedMemoryManager as the underlying non-pooled manager is "
+                "forbidden.");
+    }
+    SetEnabled(enabled);
+}
+
+void* PooledMemoryManager::Malloc(size_t byte_size, const Device& device) {
+    if (byte_size == 0) {
+        return nullptr;
+    }
+    if (device.GetType() != Device::DeviceType::CPU) {
+        utility::LogError("PooledMemoryManager only supports CPU, but got {}.",
+                          device.ToString());
+    }
+
+    size_t internal_byte_size = byte_size + sizeof(BlockHeader);
+    void* block = nullptr;
+    uint32_t size_class = kUnpooled;
+
+    if (IsEnabled() && internal_byte_size <= kMaxPooledByteSize) {
+        size_class = SizeClassOf(internal_byte_size);
+        internal_byte_size = ByteSizeOf(size_class);
+
+        auto& blocks = ThreadCache::GetInstance().GetFreeLists(
+                pool_)[size_class];
+        if (blocks.empty()) {
+            pool_->Take(size_class, blocks, kRefillBlocks);
+        }
+        if (!blocks.empty()) {
+            block = blocks.back();
+            blocks.pop_back();
+            MemoryManagerStatistic::GetInstance().CountPoolHit(device);
+        } else {
+            MemoryManagerStatistic::GetInstance().CountPoolMiss(device);
+        }
+    }
+
+    if (block == nullptr) {
+        block = device_mm_->Malloc(internal_byte_size, device);
+    }
+
+    static_cast<BlockHeader*>(block)->size_class_ = size_class;
+    return static_cast<char*>(block) + sizeof(BlockHeader);
+}
+
+void PooledMemoryManager::Free(void* ptr, const Device& device) {
+    if (ptr == nullptr) {
+        return;
+    }
+
+    void* block = static_cast<char*>(ptr) - sizeof(BlockHeader);
+    uint32_t size_class = static_cast<BlockHeader*>(block)->size_class_;
+
+    if (size_class == kUnpooled || !IsEnabled()) {
+        device_mm_->Free(block, device);
+        return;
+    }
+
+    auto& blocks = ThreadCache::GetInstance().GetFreeLists(pool_)[size_class];
+    blocks.push_back(block);
+    if (blocks.size() > kMaxLocalBlocks) {
+        pool_->Put(size_class, blocks, kMaxLocalBlocks / 2);
+    }
+}
+
+void PooledMemoryManager::Memcpy(void* dst_ptr,
+                                 const Device& dst_device,
+                                 const void* src_ptr,
+                                 const Device& src_device,
+                                 size_t num_bytes) {
+    device_mm_->Memcpy(dst_ptr, dst_device, src_ptr, src_device, num_bytes);
+}
+
+void PooledMemoryManager::SetEnabled(bool enabled) {
+    pool_->enabled_ = enabled;
+    if (!enabled) {
+        ReleasePool();
+    }
+}
+
+bool PooledMemoryManager::IsEnabled() const { return pool_->enabled_; }
+
+void PooledMemoryManager::ReleasePool() {
+    pool_->FreeBlocks(ThreadCache::GetInstance().GetFreeLists(pool_));
+    pool_->Release();
+}
+
+}  // namespace core
+}  // namespace open3d
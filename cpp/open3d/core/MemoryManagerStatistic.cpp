@@ -120,6 +120,12 @@ void MemoryManagerStatistic::Print() const {
             utility::LogInfo("{}: {} {}", device.ToString(),
                              statistics.count_malloc_, statistics.count_free_);
         }
+
+        if (statistics.count_pool_hit_ + statistics.count_pool_miss_ > 0) {
+            utility::LogInfo("{}: pool hits {}, pool misses {}",
+                             device.ToString(), statistics.count_pool_hit_,
+                             statistics.count_pool_miss_);
+        }
     }
     utility::LogInfo("---------------------------------------------");
 
@@ -188,6 +194,34 @@ void MemoryManagerStatistic::CountFree(void* ptr, const Device& device) {
     }
 }
 
+void MemoryManagerStatistic::CountPoolHit(const Device& device) {
+    std::lock_guard<std::mutex> lock(statistics_mutex_);
+    statistics_[device].count_pool_hit_++;
+}
+
+void MemoryManagerStatistic::CountPoolMiss(const Device& device) {
+    std::lock_guard<std::mutex> lock(statistics_mutex_);
+    statistics_[device].count_pool_miss_++;
+}
+
+int64_t MemoryManagerStatistic::GetMallocCount(const Device& device) const {
+    std::lock_guard<std::mutex> lock(statistics_mutex_);
+    auto it = statistics_.find(device);
+    return it == statistics_.end() ? 0 : it->second.count_malloc_;
+}
+
+int64_t MemoryManagerStatistic::GetPoolHitCount(const Device& device) const {
+    std::lock_guard<std::mutex> lock(statistics_mutex_);
+    auto it = statistics_.find(device);
+    return it == statistics_.end() ? 0 : it->second.count_pool_hit_;
+}
+
+int64_t MemoryManagerStatistic::GetPoolMissCount(const Device& device) const {
+    std::lock_guard<std::mutex> lock(statistics_mutex_);
+    auto it = statistics_.find(device);
+    return it == statistics_.end() ? 0 : it->second.count_pool_miss_;
+}
+
 void MemoryManagerStatistic::Reset() {
     std::lock_guard<std::mutex> lock(statistics_mutex_);
     statistics_.clear();
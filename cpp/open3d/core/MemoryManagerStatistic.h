@@ -81,6 +81,25 @@ public:
     /// consistency.
     void CountFree(void* ptr, const Device& device);
 
+    /// Adds an allocation served from a memory pool to the statistics.
+    void CountPoolHit(const Device& device);
+
+    /// Adds an allocation that could not be served from a memory pool and
+    /// was forwarded to the underlying memory manager to the statistics.
+    void CountPoolMiss(const Device& device);
+
+    /// Returns the number of allocations recorded on \p device since the last
+    /// reset.
+    int64_t GetMallocCount(const Device& device) const;
+
+    /// Returns the number of allocations served from a memory pool on
+    /// \p device since the last reset.
+    int64_t GetPoolHitCount(const Device& device) const;
+
+    /// Returns the number of pool allocations on \p device since the last
+    /// reset that required a direct allocation.
+    int64_t GetPoolMissCount(const Device& device) const;
+
     /// Resets the statistics.
     void Reset();
 
@@ -92,6 +111,8 @@ private:
 
         int64_t count_malloc_ = 0;
         int64_t count_free_ = 0;
+        int64_t count_pool_hit_ = 0;
+        int64_t count_pool_miss_ = 0;
         std::unordered_map<void*, size_t> active_allocations_;
     };
 
@@ -105,7 +126,7 @@ private:
     /// Print at each malloc and free, disabled by default.
     bool print_at_malloc_free_ = false;
 
-    std::mutex statistics_mutex_;
+    mutable std::mutex statistics_mutex_;
     std::map<Device, MemoryStatistics> statistics_;
 };
 
@@ -0,0 +1,87 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/ParallelFor.h"
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_arena.h>
+
+#include <atomic>
+
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace core {
+
+static std::atomic<int> s_parallel_for_backend(
+        static_cast<int>(ParallelForBackend::OpenMP));
+static std::atomic<int64_t> s_parallel_for_grain_size(0);
+
+void SetParallelForBackend(ParallelForBackend backend) {
+    s_parallel_for_backend = static_cast<int>(backend);
+}
+
+ParallelForBackend GetParallelForBackend() {
+    return static_cast<ParallelForBackend>(s_parallel_for_backend.load());
+}
+
+void SetParallelForGrainSize(int64_t grain_size) {
+    if (grain_size < 0) {
+        utility::LogError("Grain size must be non-negative, but got {}.",
+                          grain_size);
+    }
+    s_parallel_for_grain_size = grain_size;
+}
+
+int64_t GetParallelForGrainSize() { return s_parallel_for_grain_size.load(); }
+
+void ParallelForTBB_(int64_t n,
+                     const std::function<void(int64_t, int64_t)>& range_func) {
+    // The arena limits the concurrency to the same number of threads as the
+    // OpenMP backend. Nested calls from tasks of the arena are executed by
+    // the same workers instead of spawning additional threads.
+    static tbb::task_arena arena(utility::EstimateMaxThreads());
+
+    auto body = [&range_func](const tbb::blocked_range<int64_t>& range) {
+        range_func(range.begin(), range.end());
+    };
+
+    int64_t grain_size = GetParallelForGrainSize();
+    arena.execute([&]() {
+        if (grain_size > 0) {
+            tbb::parallel_for(tbb::blocked_range<int64_t>(0, n, grain_size),
+                              body, tbb::simple_partitioner());
+        } else {
+            tbb::parallel_for(tbb::blocked_range<int64_t>(0, n), body,
+                              tbb::auto_partitioner());
+        }
+    });
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -27,6 +27,7 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <type_traits>
 
 #include "open3d/core/Device.h"
@@ -45,6 +46,34 @@
 namespace open3d {
 namespace core {
 
+/// Backend used by ParallelFor for CPU devices.
+enum class ParallelForBackend {
+    /// Static scheduling with `#pragma omp parallel for`. Best for uniform
+    /// workloads that are not nested in other parallel regions.
+    OpenMP = 0,
+    /// Work-stealing scheduling in a TBB task arena. Best for imbalanced
+    /// workloads and nested parallelism.
+    TBB = 1,
+};
+
+/// Selects the backend used by ParallelFor for CPU devices.
+void SetParallelForBackend(ParallelForBackend backend);
+
+/// Returns the backend used by ParallelFor for CPU devices.
+ParallelForBackend GetParallelForBackend();
+
+/// Sets the minimum number of workloads per task of the TBB backend. With the
+/// default grain size of 0, the range is split adaptively.
+void SetParallelForGrainSize(int64_t grain_size);
+
+/// Returns the minimum number of workloads per task of the TBB backend.
+int64_t GetParallelForGrainSize();
+
+/// Runs \p range_func on disjoint subranges [start, end) of [0, n) with the
+/// TBB backend. Internal helper of ParallelFor.
+void ParallelForTBB_(int64_t n,
+                     const std::function<void(int64_t, int64_t)>& range_func);
+
 #ifdef __CUDACC__
 
 static constexpr int64_t OPEN3D_PARFOR_BLOCK = 128;
@@ -98,6 +127,15 @@ void ParallelForCPU_(const Device& device, int64_t n, const func_t& func) {
         return;
     }
 
+    if (GetParallelForBackend() == ParallelForBackend::TBB) {
+        ParallelForTBB_(n, [&func](int64_t start, int64_t end) {
+            for (int64_t i = start; i < end; ++i) {
+                func(i);
+            }
+        });
+        return;
+    }
+
 #pragma omp parallel for num_threads(utility::EstimateMaxThreads())
     for (int64_t i = 0; i < n; ++i) {
         func(i);
@@ -113,8 +151,9 @@ void ParallelForCPU_(const Device& device, int64_t n, const func_t& func) {
 /// \param func The function to be executed in parallel. The function should
 /// take an int64_t workload index and returns void, i.e., `void func(int64_t)`.
 ///
-/// \note This is optimized for uniform work items, i.e. where each call to \p
-/// func takes the same time.
+/// \note With the default OpenMP backend, this is optimized for uniform work
+/// items, i.e. where each call to \p func takes the same time. Select the TBB
+/// backend via SetParallelForBackend() for imbalanced work items.
 /// \note If you use a lambda function, capture only the required variables
 /// instead of all to prevent accidental race conditions. If you want the
 /// kernel to be used on both CPU and CUDA, capture the variables by value.
@@ -137,8 +176,9 @@ void ParallelFor(const Device& device, int64_t n, const func_t& func) {
 /// function should be provided using the OPEN3D_VECTORIZED macro, e.g.,
 /// `OPEN3D_VECTORIZED(MyISPCKernel, some_used_variable)`.
 ///
-/// \note This is optimized for uniform work items, i.e. where each call to \p
-/// func takes the same time.
+/// \note With the default OpenMP backend, this is optimized for uniform work
+/// items, i.e. where each call to \p func takes the same time. Select the TBB
+/// backend via SetParallelForBackend() for imbalanced work items.
 /// \note If you use a lambda function, capture only the required variables
 /// instead of all to prevent accidental race conditions. If you want the
 /// kernel to be used on both CPU and CUDA, capture the variables by value.
@@ -183,6 +223,17 @@ void ParallelFor(const Device& device,
 #ifdef __CUDACC__
     ParallelForCUDA_(device, n, func);
 #else
+    if (GetParallelForBackend() == ParallelForBackend::TBB) {
+        if (device.GetType() != Device::DeviceType::CPU) {
+            utility::LogError("ParallelFor for CPU cannot run on device {}.",
+                              device.ToString());
+        }
+        if (n > 0) {
+            ParallelForTBB_(n, vec_func);
+        }
+        return;
+    }
+
     int num_threads = utility::EstimateMaxThreads();
     ParallelForCPU_(device, num_threads, [&](int64_t i) {
         int64_t start = n * i / num_threads;
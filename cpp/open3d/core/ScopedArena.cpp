@@ -0,0 +1,171 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/ScopedArena.h"
+
+#include <cstdint>
+#include <vector>
+
+#include "open3d/core/MemoryManager.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+
+/// Alignment of all allocations served from a region.
+static constexpr size_t kArenaAlignment = 64;
+
+/// Contiguous memory region which is handed out by advancing an offset.
+class ArenaRegion {
+public:
+    /// The memory manager only guarantees a smaller alignment, so the region
+    /// is over-allocated and its start is rounded up to kArenaAlignment.
+    ArenaRegion(const Device& device, size_t byte_size)
+        : device_(device),
+          byte_size_(byte_size),
+          raw_ptr_(MemoryManager::Malloc(byte_size + kArenaAlignment - 1,
+                                         device)) {
+        const uintptr_t address = reinterpret_cast<uintptr_t>(raw_ptr_);
+        ptr_ = reinterpret_cast<char*>((address + kArenaAlignment - 1) /
+                                       kArenaAlignment * kArenaAlignment);
+    }
+
+    ~ArenaRegion() { MemoryManager::Free(raw_ptr_, device_); }
+
+    ArenaRegion(const ArenaRegion&) = delete;
+    ArenaRegion& operator=(const ArenaRegion&) = delete;
+
+    void* Malloc(size_t byte_size) {
+        size_t aligned_byte_size =
+                (byte_size + kArenaAlignment - 1) / kArenaAlignment *
+                kArenaAlignment;
+        if (aligned_byte_size > byte_size_ - offset_) {
+            return nullptr;
+        }
+        void* ptr = ptr_ + offset_;
+        offset_ += aligned_byte_size;
+        return ptr;
+    }
+
+    void Reset() { offset_ = 0; }
+
+    Device device_;
+    size_t byte_size_ = 0;
+    size_t offset_ = 0;
+    void* raw_ptr_ = nullptr;
+    char* ptr_ = nullptr;
+};
+
+/// Per-thread state: the innermost open arena and idle regions for reuse.
+struct ArenaThreadState {
+    ScopedArena* current_ = nullptr;
+    std::vector<std::shared_ptr<ArenaRegion>> cached_regions_;
+
+    static ArenaThreadState& GetInstance() {
+        static thread_local ArenaThreadState instance;
+        return instance;
+    }
+};
+
+ScopedArena::ScopedArena(const Device& device, size_t byte_size)
+    : device_(device) {
+    auto& state = ArenaThreadState::GetInstance();
+    auto& regions = state.cached_regions_;
+
+    // Reuse the first idle region that is large enough. A region is idle if
+    // no Blob allocated from it is alive anymore.
+    for (auto it = regions.begin(); it != regions.end(); ++it) {
+        if ((*it)->device_ == device && (*it)->byte_size_ >= byte_size &&
+            it->use_count() == 1) {
+            region_ = *it;
+            regions.erase(it);
+            break;
+        }
+    }
+    if (region_ == nullptr) {
+        region_ = std::make_shared<ArenaRegion>(device, byte_size);
+    }
+    region_->Reset();
+
+    parent_ = state.current_;
+    state.current_ = this;
+}
+
+ScopedArena::~ScopedArena() {
+    auto& state = ArenaThreadState::GetInstance();
+    if (state.current_ != this) {
+        utility::LogError(
+                "ScopedArena must be destroyed in reverse order of creation.");
+    }
+    state.current_ = parent_;
+
+    // Blobs that outlive the arena keep the region alive until they are
+    // destroyed, only then it will be picked up for reuse.
+    state.cached_regions_.push_back(std::move(region_));
+}
+
+size_t ScopedArena::GetUsedByteSize() const { return region_->offset_; }
+
+size_t ScopedArena::GetByteSize() const { return region_->byte_size_; }
+
+void* ScopedArena::Malloc(size_t byte_size,
+                          const Device& device,
+                          std::function<void(void*)>& deleter) {
+    if (byte_size == 0) {
+        return nullptr;
+    }
+
+    ScopedArena* arena = ArenaThreadState::GetInstance().current_;
+    while (arena != nullptr && arena->device_ != device) {
+        arena = arena->parent_;
+    }
+    if (arena == nullptr) {
+        return nullptr;
+    }
+
+    void* ptr = arena->region_->Malloc(byte_size);
+    if (ptr != nullptr) {
+        // The allocation is released together with the arena, the deleter
+        // only keeps the region alive.
+        std::shared_ptr<ArenaRegion> region = arena->region_;
+        deleter = [region](void*) {};
+    }
+    return ptr;
+}
+
+void ScopedArena::ReleaseCache() {
+    auto& regions = ArenaThreadState::GetInstance().cached_regions_;
+    std::vector<std::shared_ptr<ArenaRegion>> busy_regions;
+    for (auto& region : regions) {
+        if (region.use_count() > 1) {
+            busy_regions.push_back(std::move(region));
+        }
+    }
+    regions = std::move(busy_regions);
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,96 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+#include "open3d/core/Device.h"
+
+namespace open3d {
+namespace core {
+
+class ArenaRegion;
+
+/// Scoped bump allocator for temporaries. While a ScopedArena is alive, every
+/// Blob (and thus every Tensor) created by the same thread on the arena's
+/// device is allocated from a single pre-allocated region by advancing an
+/// offset. Allocations that do not fit into the region fall back to the
+/// MemoryManager.
+///
+/// Destroying the arena releases all its allocations in O(1). The region is
+/// kept in a per-thread cache, so re-opening an arena of the same or smaller
+/// size on the same device does not call the MemoryManager again:
+///
+/// \code{.cpp}
+/// for (int i = 0; i < max_iterations; ++i) {
+///     core::ScopedArena arena(device, 64 << 20);
+///     // Temporaries of this iteration are bump-allocated.
+/// }
+/// \endcode
+///
+/// Blobs which outlive the arena stay valid: each of them keeps the region
+/// alive, and a region is only recycled once all of its Blobs are gone.
+/// Arenas may be nested, allocations go to the innermost arena of the device.
+class ScopedArena {
+public:
+    /// Opens an arena of \p byte_size bytes on \p device for the calling
+    /// thread.
+    ScopedArena(const Device& device, size_t byte_size);
+
+    /// Closes the arena and releases all its allocations.
+    ~ScopedArena();
+
+    ScopedArena(const ScopedArena&) = delete;
+    ScopedArena& operator=(const ScopedArena&) = delete;
+
+    /// Returns the number of bytes allocated from the region so far.
+    size_t GetUsedByteSize() const;
+
+    /// Returns the capacity of the region in bytes.
+    size_t GetByteSize() const;
+
+    /// Tries to allocate \p byte_size bytes from the innermost arena of the
+    /// calling thread on \p device. On success, returns the pointer and sets
+    /// \p deleter to a function releasing the allocation. Returns nullptr if
+    /// there is no open arena on \p device or if the arena is exhausted.
+    static void* Malloc(size_t byte_size,
+                        const Device& device,
+                        std::function<void(void*)>& deleter);
+
+    /// Frees all regions cached by the calling thread which are not in use.
+    static void ReleaseCache();
+
+private:
+    Device device_;
+    std::shared_ptr<ArenaRegion> region_;
+    ScopedArena* parent_ = nullptr;
+};
+
+}  // namespace core
+}  // namespace open3d
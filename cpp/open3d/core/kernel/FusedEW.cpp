@@ -0,0 +1,88 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/FusedEW.h"
+
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+void FusedEW(const std::vector<Tensor>& inputs,
+             const std::vector<FusedEWInstruction>& program,
+             Tensor& dst) {
+    if (program.empty()) {
+        utility::LogError("FusedEW: Empty program.");
+    }
+    for (const Tensor& input : inputs) {
+        if (input.GetDevice() != dst.GetDevice()) {
+            utility::LogError("Device mismatch {} != {}.",
+                              input.GetDevice().ToString(),
+                              dst.GetDevice().ToString());
+        }
+        if (input.GetDtype() != dst.GetDtype()) {
+            utility::LogError("Dtype mismatch {} != {}.",
+                              input.GetDtype().ToString(),
+                              dst.GetDtype().ToString());
+        }
+        if (!shape_util::CanBeBrocastedToShape(input.GetShape(),
+                                               dst.GetShape())) {
+            utility::LogError("Shape {} can not be broadcasted to {}.",
+                              input.GetShape(), dst.GetShape());
+        }
+    }
+    for (size_t i = 0; i < program.size(); ++i) {
+        const FusedEWInstruction& instruction = program[i];
+        if (instruction.op_code_ == FusedEWOpCode::Load) {
+            if (instruction.lhs_ < 0 ||
+                instruction.lhs_ >= static_cast<int64_t>(inputs.size())) {
+                utility::LogError("FusedEW: Invalid input index {}.",
+                                  instruction.lhs_);
+            }
+        } else if (instruction.op_code_ != FusedEWOpCode::Const) {
+            if (instruction.lhs_ < 0 ||
+                instruction.lhs_ >= static_cast<int64_t>(i) ||
+                instruction.rhs_ >= static_cast<int64_t>(i)) {
+                utility::LogError("FusedEW: Invalid operand in instruction {}.",
+                                  i);
+            }
+        }
+    }
+
+    Device::DeviceType device_type = dst.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        FusedEWCPU(inputs, program, dst);
+    } else {
+        utility::LogError("FusedEW: Unimplemented device");
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,80 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+
+#include "open3d/core/Scalar.h"
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+enum class FusedEWOpCode {
+    // Leaves.
+    Load,
+    Const,
+    // Unary ops.
+    Neg,
+    Abs,
+    Sqrt,
+    Exp,
+    Sin,
+    Cos,
+    // Binary ops.
+    Add,
+    Sub,
+    Mul,
+    Div,
+};
+
+/// Single step of a fused elementwise program. The i-th instruction of a
+/// program writes its result into register i. Operands refer to registers of
+/// previous instructions, except for Load, where \p lhs_ is the input index.
+struct FusedEWInstruction {
+    FusedEWOpCode op_code_;
+    int64_t lhs_ = -1;
+    int64_t rhs_ = -1;
+    /// Value of a Const instruction.
+    Scalar value_ = Scalar(0);
+};
+
+/// Evaluates \p program for every element of \p dst in a single pass.
+/// Inputs are broadcasted to the shape of \p dst and must share its dtype and
+/// device. The result of the last instruction is written to \p dst.
+void FusedEW(const std::vector<Tensor>& inputs,
+             const std::vector<FusedEWInstruction>& program,
+             Tensor& dst);
+
+void FusedEWCPU(const std::vector<Tensor>& inputs,
+                const std::vector<FusedEWInstruction>& program,
+                Tensor& dst);
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,187 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Indexer.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/FusedEW.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+// Number of elements processed per instruction before moving on to the next
+// instruction. The registers of a chunk stay in cache and the inner loops
+// over a chunk can be vectorized by the compiler.
+static constexpr int64_t kChunkSize = 512;
+
+template <typename scalar_t>
+static void EvaluateChunk(const Indexer& indexer,
+                          const std::vector<FusedEWInstruction>& program,
+                          const std::vector<scalar_t>& constants,
+                          int64_t start,
+                          int64_t count,
+                          scalar_t* registers) {
+    for (size_t i = 0; i < program.size(); ++i) {
+        const FusedEWInstruction& instruction = program[i];
+        scalar_t* out = registers + i * kChunkSize;
+        const scalar_t* lhs = registers + instruction.lhs_ * kChunkSize;
+        const scalar_t* rhs = registers + instruction.rhs_ * kChunkSize;
+
+        switch (instruction.op_code_) {
+            case FusedEWOpCode::Load:
+                for (int64_t j = 0; j < count; ++j) {
+                    out[j] = *indexer.GetInputPtr<scalar_t>(instruction.lhs_,
+                                                            start + j);
+                }
+                break;
+            case FusedEWOpCode::Const:
+                for (int64_t j = 0; j < count; ++j) {
+                    out[j] = constants[i];
+                }
+                break;
+            case FusedEWOpCode::Neg:
+                for (int64_t j = 0; j < count; ++j) {
+                    out[j] = static_cast<scalar_t>(-lhs[j]);
+                }
+                break;
+            case FusedEWOpCode::Abs:
+                for (int64_t j = 0; j < count; ++j) {
+                    out[j] = static_cast<scalar_t>(
+                            std::abs(static_cast<double>(lhs[j])));
+                }
+                break;
+            case FusedEWOpCode::Sqrt:
+                for (int64_t j = 0; j < count; ++j) {
+                    out[j] = static_cast<scalar_t>(std::sqrt(lhs[j]));
+                }
+                break;
+            case FusedEWOpCode::Exp:
+                for (int64_t j = 0; j < count; ++j) {
+                    out[j] = static_cast<scalar_t>(std::exp(lhs[j]));
+                }
+                break;
+            case FusedEWOpCode::Sin:
+                for (int64_t j = 0; j < count; ++j) {
+                    out[j] = static_cast<scalar_t>(std::sin(lhs[j]));
+                }
+                break;
+            case FusedEWOpCode::Cos:
+                for (int64_t j = 0; j < count; ++j) {
+                    out[j] = static_cast<scalar_t>(std::cos(lhs[j]));
+                }
+                break;
+            case FusedEWOpCode::Add:
+                for (int64_t j = 0; j < count; ++j) {
+                    out[j] = lhs[j] + rhs[j];
+                }
+                break;
+            case FusedEWOpCode::Sub:
+                for (int64_t j = 0; j < count; ++j) {
+                    out[j] = lhs[j] - rhs[j];
+                }
+                break;
+            case FusedEWOpCode::Mul:
+                for (int64_t j = 0; j < count; ++j) {
+                    out[j] = lhs[j] * rhs[j];
+                }
+                break;
+            case FusedEWOpCode::Div:
+                for (int64_t j = 0; j < count; ++j) {
+                    out[j] = lhs[j] / rhs[j];
+                }
+                break;
+            default:
+                utility::LogError("Unimplemented op_code for FusedEWCPU");
+                break;
+        }
+    }
+
+    const scalar_t* result = registers + (program.size() - 1) * kChunkSize;
+    for (int64_t j = 0; j < count; ++j) {
+        *indexer.GetOutputPtr<scalar_t>(start + j) = result[j];
+    }
+}
+
+void FusedEWCPU(const std::vector<Tensor>& inputs,
+                const std::vector<FusedEWInstruction>& program,
+                Tensor& dst) {
+    Dtype dtype = dst.GetDtype();
+    for (const FusedEWInstruction& instruction : program) {
+        switch (instruction.op_code_) {
+            case FusedEWOpCode::Sqrt:
+            case FusedEWOpCode::Exp:
+            case FusedEWOpCode::Sin:
+            case FusedEWOpCode::Cos:
+                if (dtype != core::Float32 && dtype != core::Float64) {
+                    utility::LogError(
+                            "Only supports Float32 and Float64, but {} is "
+                            "used.",
+                            dtype.ToString());
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
+    Indexer indexer(inputs, dst, DtypePolicy::ALL_SAME);
+    int64_t num_workloads = indexer.NumWorkloads();
+    int64_t num_chunks = (num_workloads + kChunkSize - 1) / kChunkSize;
+
+    DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        std::vector<scalar_t> constants(program.size(), scalar_t(0));
+        for (size_t i = 0; i < program.size(); ++i) {
+            if (program[i].op_code_ == FusedEWOpCode::Const) {
+                constants[i] = program[i].value_.To<scalar_t>();
+            }
+        }
+
+        const size_t num_registers = program.size() * kChunkSize;
+        ParallelFor(Device("CPU:0"), num_chunks, [&](int64_t chunk_idx) {
+            // The register file is allocated once per thread and reused by
+            // all chunks and calls on that thread.
+            thread_local std::vector<scalar_t> registers;
+            if (registers.size() < num_registers) {
+                registers.resize(num_registers);
+            }
+            int64_t start = chunk_idx * kChunkSize;
+            int64_t count = std::min(kChunkSize, num_workloads - start);
+            EvaluateChunk<scalar_t>(indexer, program, constants, start, count,
+                                    registers.data());
+        });
+    });
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
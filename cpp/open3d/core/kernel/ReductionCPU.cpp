@@ -24,10 +24,14 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <limits>
+#include <tuple>
+#include <vector>
 
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Indexer.h"
+#include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/kernel/Reduction.h"
 #include "open3d/utility/Logging.h"
@@ -85,14 +89,332 @@ static inline std::pair<int64_t, scalar_t> CPUArgMaxReductionKernel(
     }
 }
 
+/// Reduction plan for a contiguous input whose reduction dims form one
+/// consecutive block of its dims. The input is viewed as a 3D tensor
+/// {outer, reduce, inner} and the output as {outer, inner}, so every kernel
+/// can walk raw pointers instead of computing offsets through the Indexer.
+///
+/// The reduce dimension is split into chunks and the inner dimension into
+/// blocks. Each (outer, chunk, block) task is run by one thread into its own
+/// partial result, and the partials are combined in chunk order afterwards.
+class ContiguousReductionPlan {
+public:
+    ContiguousReductionPlan(const Tensor& src,
+                            const Tensor& dst,
+                            const SizeVector& dims) {
+        if (src.NumElements() == 0 || src.NumDims() == 0 || dims.size() == 0 ||
+            !src.IsContiguous() || !dst.IsContiguous()) {
+            return;
+        }
+        const int64_t ndims = src.NumDims();
+        std::vector<int64_t> wrapped_dims;
+        for (const int64_t& dim : dims) {
+            wrapped_dims.push_back(shape_util::WrapDim(dim, ndims));
+        }
+        std::sort(wrapped_dims.begin(), wrapped_dims.end());
+        const int64_t dim_begin = wrapped_dims.front();
+        const int64_t dim_end = wrapped_dims.back() + 1;
+        if (dim_end - dim_begin != static_cast<int64_t>(wrapped_dims.size())) {
+            return;
+        }
+
+        const SizeVector& shape = src.GetShape();
+        outer_ = 1;
+        reduce_ = 1;
+        inner_ = 1;
+        for (int64_t dim = 0; dim < dim_begin; ++dim) {
+            outer_ *= shape[dim];
+        }
+        for (int64_t dim = dim_begin; dim < dim_end; ++dim) {
+            reduce_ *= shape[dim];
+        }
+        for (int64_t dim = dim_end; dim < ndims; ++dim) {
+            inner_ *= shape[dim];
+        }
+        if (dst.NumElements() != outer_ * inner_) {
+            return;
+        }
+
+        // Small reductions stay on one thread, large ones are split until
+        // every thread has at least one task.
+        num_threads_ =
+                utility::InParallel() ? 1 : utility::EstimateMaxThreads();
+        int64_t tasks_per_outer = 1;
+        if (outer_ < num_threads_) {
+            int64_t max_tasks = std::max<int64_t>(
+                    1, reduce_ * inner_ / kMinWorkloadPerTask);
+            tasks_per_outer = std::min(
+                    (num_threads_ + outer_ - 1) / outer_, max_tasks);
+        }
+        num_chunks_ = std::min(reduce_, tasks_per_outer);
+        num_blocks_ = std::min(
+                inner_, (tasks_per_outer + num_chunks_ - 1) / num_chunks_);
+        if (outer_ * num_chunks_ * num_blocks_ == 1) {
+            num_threads_ = 1;
+        }
+        is_valid_ = true;
+    }
+
+    bool IsValid() const { return is_valid_; }
+
+    /// Regular reduction. \p reduce_func is called as (src, acc) like in
+    /// CPUReductionEngine.
+    template <typename scalar_t, typename func_t>
+    void Run(const scalar_t* src,
+             scalar_t* dst,
+             func_t reduce_func,
+             scalar_t identity) const {
+        // With a single chunk the partials are already the final results.
+        std::vector<scalar_t> partials;
+        scalar_t* partial_ptr = dst;
+        if (num_chunks_ > 1) {
+            partials.resize(outer_ * num_chunks_ * inner_);
+            partial_ptr = partials.data();
+        }
+
+        const int64_t num_tasks = outer_ * num_chunks_ * num_blocks_;
+#pragma omp parallel for schedule(static) num_threads(num_threads_)
+        for (int64_t task_idx = 0; task_idx < num_tasks; ++task_idx) {
+            int64_t outer_idx, r_begin, r_end, i_begin, i_end;
+            GetTaskRange(task_idx, outer_idx, r_begin, r_end, i_begin, i_end);
+            const scalar_t* src_ptr = src + outer_idx * reduce_ * inner_;
+            scalar_t* out_ptr =
+                    partial_ptr +
+                    (outer_idx * num_chunks_ + task_idx / num_blocks_ %
+                                                       num_chunks_) *
+                            inner_;
+            if (inner_ == 1) {
+                out_ptr[0] = ReduceRun(src_ptr + r_begin, r_end - r_begin,
+                                       reduce_func, identity);
+            } else {
+                ReduceRows(src_ptr, r_begin, r_end, i_begin, i_end, out_ptr,
+                           reduce_func, identity);
+            }
+        }
+
+        if (num_chunks_ > 1) {
+            const int64_t num_outputs = outer_ * inner_;
+#pragma omp parallel for schedule(static) num_threads(num_threads_)
+            for (int64_t output_idx = 0; output_idx < num_outputs;
+                 ++output_idx) {
+                const int64_t outer_idx = output_idx / inner_;
+                const int64_t inner_idx = output_idx % inner_;
+                scalar_t result = identity;
+                for (int64_t chunk = 0; chunk < num_chunks_; ++chunk) {
+                    result = reduce_func(
+                            partials[(outer_idx * num_chunks_ + chunk) *
+                                             inner_ +
+                                     inner_idx],
+                            result);
+                }
+                dst[output_idx] = result;
+            }
+        }
+    }
+
+    /// Arg-reduction. \p reduce_func is called as (src_idx, src, acc_idx, acc)
+    /// like in CPUArgReductionEngine. Ties resolve to the smallest index, which
+    /// matches a serial scan.
+    template <typename scalar_t, typename func_t>
+    void RunArg(const scalar_t* src,
+                int64_t* dst,
+                func_t reduce_func,
+                scalar_t identity) const {
+        const int64_t num_partials = outer_ * num_chunks_ * inner_;
+        std::vector<scalar_t> partial_vals(num_partials, identity);
+        std::vector<int64_t> partial_idxs(num_partials, 0);
+
+        const int64_t num_tasks = outer_ * num_chunks_ * num_blocks_;
+#pragma omp parallel for schedule(static) num_threads(num_threads_)
+        for (int64_t task_idx = 0; task_idx < num_tasks; ++task_idx) {
+            int64_t outer_idx, r_begin, r_end, i_begin, i_end;
+            GetTaskRange(task_idx, outer_idx, r_begin, r_end, i_begin, i_end);
+            const scalar_t* src_ptr = src + outer_idx * reduce_ * inner_;
+            const int64_t offset =
+                    (outer_idx * num_chunks_ + task_idx / num_blocks_ %
+                                                       num_chunks_) *
+                    inner_;
+            scalar_t* val_ptr = partial_vals.data() + offset;
+            int64_t* idx_ptr = partial_idxs.data() + offset;
+            if (inner_ == 1) {
+                ArgReduceRun(src_ptr, r_begin, r_end, reduce_func, identity,
+                             idx_ptr[0], val_ptr[0]);
+            } else {
+                for (int64_t i = i_begin; i < i_end; ++i) {
+                    idx_ptr[i] = r_begin;
+                }
+                for (int64_t r = r_begin; r < r_end; ++r) {
+                    const scalar_t* row_ptr = src_ptr + r * inner_;
+                    for (int64_t i = i_begin; i < i_end; ++i) {
+                        std::tie(idx_ptr[i], val_ptr[i]) = reduce_func(
+                                r, row_ptr[i], idx_ptr[i], val_ptr[i]);
+                    }
+                }
+            }
+        }
+
+        const int64_t num_outputs = outer_ * inner_;
+#pragma omp parallel for schedule(static) num_threads(num_threads_)
+        for (int64_t output_idx = 0; output_idx < num_outputs; ++output_idx) {
+            const int64_t outer_idx = output_idx / inner_;
+            const int64_t inner_idx = output_idx % inner_;
+            const int64_t first =
+                    outer_idx * num_chunks_ * inner_ + inner_idx;
+            int64_t best_idx = partial_idxs[first];
+            scalar_t best_val = partial_vals[first];
+            for (int64_t chunk = 1; chunk < num_chunks_; ++chunk) {
+                const int64_t offset = first + chunk * inner_;
+                ArgCombine(reduce_func, partial_idxs[offset],
+                           partial_vals[offset], best_idx, best_val);
+            }
+            dst[output_idx] = best_idx;
+        }
+    }
+
+private:
+    void GetTaskRange(int64_t task_idx,
+                      int64_t& outer_idx,
+                      int64_t& r_begin,
+                      int64_t& r_end,
+                      int64_t& i_begin,
+                      int64_t& i_end) const {
+        outer_idx = task_idx / (num_chunks_ * num_blocks_);
+        const int64_t chunk = task_idx / num_blocks_ % num_chunks_;
+        const int64_t block = task_idx % num_blocks_;
+        r_begin = reduce_ * chunk / num_chunks_;
+        r_end = reduce_ * (chunk + 1) / num_chunks_;
+        i_begin = inner_ * block / num_blocks_;
+        i_end = inner_ * (block + 1) / num_blocks_;
+    }
+
+    /// Reduces a contiguous run of \p n elements. Independent accumulators
+    /// break the loop-carried dependency so that the loop vectorizes.
+    template <typename scalar_t, typename func_t>
+    static scalar_t ReduceRun(const scalar_t* src,
+                              int64_t n,
+                              func_t reduce_func,
+                              scalar_t identity) {
+        scalar_t acc[kNumLanes];
+        for (int64_t k = 0; k < kNumLanes; ++k) {
+            acc[k] = identity;
+        }
+        int64_t i = 0;
+        for (; i + kNumLanes <= n; i += kNumLanes) {
+            for (int64_t k = 0; k < kNumLanes; ++k) {
+                acc[k] = reduce_func(src[i + k], acc[k]);
+            }
+        }
+        scalar_t result = identity;
+        for (int64_t k = 0; k < kNumLanes; ++k) {
+            result = reduce_func(acc[k], result);
+        }
+        for (; i < n; ++i) {
+            result = reduce_func(src[i], result);
+        }
+        return result;
+    }
+
+    /// Reduces rows [r_begin, r_end) of an {reduce, inner} slice into
+    /// out[i_begin, i_end). The inner loop is contiguous in both operands.
+    template <typename scalar_t, typename func_t>
+    void ReduceRows(const scalar_t* src,
+                    int64_t r_begin,
+                    int64_t r_end,
+                    int64_t i_begin,
+                    int64_t i_end,
+                    scalar_t* out,
+                    func_t reduce_func,
+                    scalar_t identity) const {
+        for (int64_t i = i_begin; i < i_end; ++i) {
+            out[i] = identity;
+        }
+        for (int64_t r = r_begin; r < r_end; ++r) {
+            const scalar_t* row_ptr = src + r * inner_;
+            for (int64_t i = i_begin; i < i_end; ++i) {
+                out[i] = reduce_func(row_ptr[i], out[i]);
+            }
+        }
+    }
+
+    template <typename scalar_t, typename func_t>
+    static void ArgReduceRun(const scalar_t* src,
+                             int64_t r_begin,
+                             int64_t r_end,
+                             func_t reduce_func,
+                             scalar_t identity,
+                             int64_t& best_idx,
+                             scalar_t& best_val) {
+        // Each lane keeps the first best element of its residue class.
+        scalar_t lane_vals[kNumLanes];
+        int64_t lane_idxs[kNumLanes];
+        for (int64_t k = 0; k < kNumLanes; ++k) {
+            lane_vals[k] = identity;
+            lane_idxs[k] = r_begin + k;
+        }
+        int64_t r = r_begin;
+        for (; r + kNumLanes <= r_end; r += kNumLanes) {
+            for (int64_t k = 0; k < kNumLanes; ++k) {
+                std::tie(lane_idxs[k], lane_vals[k]) = reduce_func(
+                        r + k, src[r + k], lane_idxs[k], lane_vals[k]);
+            }
+        }
+        best_idx = lane_idxs[0];
+        best_val = lane_vals[0];
+        for (; r < r_end; ++r) {
+            std::tie(best_idx, best_val) =
+                    reduce_func(r, src[r], best_idx, best_val);
+        }
+        for (int64_t k = 1; k < kNumLanes; ++k) {
+            ArgCombine(reduce_func, lane_idxs[k], lane_vals[k], best_idx,
+                       best_val);
+        }
+    }
+
+    /// Merges a candidate into the running best. Strictly better candidates
+    /// win, equal ones win only if they come first.
+    template <typename scalar_t, typename func_t>
+    static void ArgCombine(func_t reduce_func,
+                           int64_t idx,
+                           scalar_t val,
+                           int64_t& best_idx,
+                           scalar_t& best_val) {
+        if (reduce_func(idx, val, best_idx, best_val).first == idx ||
+            (val == best_val && idx < best_idx)) {
+            best_idx = idx;
+            best_val = val;
+        }
+    }
+
+    static constexpr int64_t kNumLanes = 8;
+    static constexpr int64_t kMinWorkloadPerTask = 1 << 15;
+
+    bool is_valid_ = false;
+    int64_t outer_ = 0;
+    int64_t reduce_ = 0;
+    int64_t inner_ = 0;
+    int64_t num_chunks_ = 1;
+    int64_t num_blocks_ = 1;
+    int num_threads_ = 1;
+};
+
 class CPUReductionEngine {
 public:
     CPUReductionEngine(const CPUReductionEngine&) = delete;
     CPUReductionEngine& operator=(const CPUReductionEngine&) = delete;
-    CPUReductionEngine(const Indexer& indexer) : indexer_(indexer) {}
+    CPUReductionEngine(const Indexer& indexer,
+                       const ContiguousReductionPlan& plan)
+        : indexer_(indexer), plan_(plan) {}
 
     template <typename func_t, typename scalar_t>
     void Run(const func_t& reduce_func, scalar_t identity) {
+        if (plan_.IsValid()) {
+            plan_.Run(reinterpret_cast<const scalar_t*>(
+                              indexer_.GetInput(0).data_ptr_),
+                      reinterpret_cast<scalar_t*>(
+                              indexer_.GetOutput().data_ptr_),
+                      reduce_func, identity);
+            return;
+        }
         // See: PyTorch's TensorIterator::parallel_reduce for the reference
         // design of reduction strategy.
         if (utility::EstimateMaxThreads() == 1 || utility::InParallel()) {
@@ -194,16 +516,27 @@ private:
 
 private:
     Indexer indexer_;
+    const ContiguousReductionPlan& plan_;
 };
 
 class CPUArgReductionEngine {
 public:
     CPUArgReductionEngine(const CPUArgReductionEngine&) = delete;
     CPUArgReductionEngine& operator=(const CPUArgReductionEngine&) = delete;
-    CPUArgReductionEngine(const Indexer& indexer) : indexer_(indexer) {}
+    CPUArgReductionEngine(const Indexer& indexer,
+                          const ContiguousReductionPlan& plan)
+        : indexer_(indexer), plan_(plan) {}
 
     template <typename func_t, typename scalar_t>
     void Run(const func_t& reduce_func, scalar_t identity) {
+        if (plan_.IsValid()) {
+            plan_.RunArg(reinterpret_cast<const scalar_t*>(
+                                 indexer_.GetInput(0).data_ptr_),
+                         reinterpret_cast<int64_t*>(
+                                 indexer_.GetOutput(0).data_ptr_),
+                         reduce_func, identity);
+            return;
+        }
         // Arg-reduction needs to iterate each output element separately in
         // sub-iterations. Each output elemnent corresponds to multiple input
         // elements. We need to keep track of the indices within each
@@ -233,6 +566,7 @@ public:
 
 private:
     Indexer indexer_;
+    const ContiguousReductionPlan& plan_;
 };
 
 void ReductionCPU(const Tensor& src,
@@ -242,7 +576,8 @@ void ReductionCPU(const Tensor& src,
                   ReductionOpCode op_code) {
     if (s_regular_reduce_ops.find(op_code) != s_regular_reduce_ops.end()) {
         Indexer indexer({src}, dst, DtypePolicy::ALL_SAME, dims);
-        CPUReductionEngine re(indexer);
+        ContiguousReductionPlan plan(src, dst, dims);
+        CPUReductionEngine re(indexer, plan);
         DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
             scalar_t identity;
             switch (op_code) {
@@ -289,7 +624,8 @@ void ReductionCPU(const Tensor& src,
         Tensor dst_acc(dst.GetShape(), src.GetDtype(), src.GetDevice());
 
         Indexer indexer({src}, {dst, dst_acc}, DtypePolicy::INPUT_SAME, dims);
-        CPUArgReductionEngine re(indexer);
+        ContiguousReductionPlan plan(src, dst, dims);
+        CPUArgReductionEngine re(indexer, plan);
         DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
             scalar_t identity;
             switch (op_code) {
@@ -329,7 +665,8 @@ void ReductionCPU(const Tensor& src,
                     "Boolean reduction only supports boolean output tensor.");
         }
         Indexer indexer({src}, dst, DtypePolicy::ALL_SAME, dims);
-        CPUReductionEngine re(indexer);
+        ContiguousReductionPlan plan(src, dst, dims);
+        CPUReductionEngine re(indexer, plan);
         switch (op_code) {
             case ReductionOpCode::All:
                 // Identity == true. 0-sized tensor, returns true.
@@ -0,0 +1,497 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/nns/DynamicGridIndex.h"
+
+#include <tbb/parallel_for.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <queue>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/TensorCheck.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+namespace {
+
+/// Pack per-query (distance, index) lists into the ragged layout returned by
+/// radius searches: (indices, distances, neighbors_row_splits).
+template <typename scalar_t>
+std::tuple<Tensor, Tensor, Tensor> PackRaggedResults(
+        const std::vector<std::vector<std::pair<scalar_t, int32_t>>> &results,
+        const Dtype &dtype,
+        const Device &device) {
+    const int64_t num_queries = static_cast<int64_t>(results.size());
+    Tensor neighbors_row_splits({num_queries + 1}, Int64, device);
+    int64_t *row_splits_ptr = neighbors_row_splits.GetDataPtr<int64_t>();
+    row_splits_ptr[0] = 0;
+    for (int64_t i = 0; i < num_queries; ++i) {
+        row_splits_ptr[i + 1] = row_splits_ptr[i] + results[i].size();
+    }
+
+    const int64_t num_neighbors = row_splits_ptr[num_queries];
+    Tensor indices({num_neighbors}, Int32, device);
+    Tensor distances({num_neighbors}, dtype, device);
+    int32_t *indices_ptr = indices.GetDataPtr<int32_t>();
+    scalar_t *distances_ptr = distances.GetDataPtr<scalar_t>();
+    tbb::parallel_for(tbb::blocked_range<int64_t>(0, num_queries),
+                      [&](const tbb::blocked_range<int64_t> &r) {
+                          for (int64_t i = r.begin(); i != r.end(); ++i) {
+                              int64_t offset = row_splits_ptr[i];
+                              for (const auto &match : results[i]) {
+                                  indices_ptr[offset] = match.second;
+                                  distances_ptr[offset] = match.first;
+                                  ++offset;
+                              }
+                          }
+                      });
+    return std::make_tuple(indices, distances, neighbors_row_splits);
+}
+
+}  // namespace
+
+DynamicGridIndex::DynamicGridIndex(){};
+
+DynamicGridIndex::DynamicGridIndex(const Tensor &dataset_points,
+                                   double voxel_size) {
+    SetTensorData(dataset_points, voxel_size);
+};
+
+DynamicGridIndex::~DynamicGridIndex(){};
+
+bool DynamicGridIndex::SetTensorData(const Tensor &dataset_points,
+                                     double voxel_size) {
+    AssertTensorDtypes(dataset_points, {Float32, Float64});
+    AssertTensorDevice(dataset_points, Device("CPU:0"));
+    AssertTensorShape(dataset_points, {utility::nullopt, 3});
+    if (voxel_size <= 0) {
+        utility::LogError("voxel_size should be positive.");
+    }
+
+    voxel_size_ = voxel_size;
+    num_active_points_ = 0;
+    points_buffer_ = Tensor::Empty({0, 3}, dataset_points.GetDtype(),
+                                   dataset_points.GetDevice());
+    dataset_points_ = points_buffer_;
+    active_.clear();
+    free_indices_.clear();
+    cells_.clear();
+    min_cell_.setConstant(std::numeric_limits<int>::max());
+    max_cell_.setConstant(std::numeric_limits<int>::lowest());
+    InsertPoints(dataset_points);
+    return true;
+}
+
+template <typename scalar_t>
+Eigen::Vector3i DynamicGridIndex::GetCellKey(const scalar_t *point) const {
+    return Eigen::Vector3i(
+            static_cast<int>(std::floor(point[0] / voxel_size_)),
+            static_cast<int>(std::floor(point[1] / voxel_size_)),
+            static_cast<int>(std::floor(point[2] / voxel_size_)));
+}
+
+Tensor DynamicGridIndex::InsertPoints(const Tensor &points) {
+    if (voxel_size_ <= 0) {
+        utility::LogError("Index is not set.");
+    }
+    AssertTensorDevice(points, GetDevice());
+    AssertTensorDtype(points, GetDtype());
+    AssertTensorShape(points, {utility::nullopt, 3});
+
+    // Fill the slots of removed points first, and append the rest.
+    const int64_t num_points = GetDatasetSize();
+    const int64_t num_new_points = points.GetLength();
+    const int64_t num_reused = std::min(
+            num_new_points, static_cast<int64_t>(free_indices_.size()));
+    const int64_t num_appended = num_new_points - num_reused;
+    if (num_points + num_appended > std::numeric_limits<int32_t>::max()) {
+        utility::LogError("DynamicGridIndex supports at most {} points.",
+                          std::numeric_limits<int32_t>::max());
+    }
+
+    // Grow the buffer geometrically so that frequent small inserts are
+    // amortized O(1) per point.
+    if (num_points + num_appended > points_buffer_.GetLength()) {
+        const int64_t capacity = std::max(num_points + num_appended,
+                                          2 * points_buffer_.GetLength());
+        Tensor points_buffer =
+                Tensor::Empty({capacity, 3}, GetDtype(), GetDevice());
+        if (num_points > 0) {
+            points_buffer.Slice(0, 0, num_points).AsRvalue() = dataset_points_;
+        }
+        points_buffer_ = points_buffer;
+    }
+    dataset_points_ = points_buffer_.Slice(0, 0, num_points + num_appended);
+    active_.resize(num_points + num_appended, false);
+
+    std::vector<int32_t> new_indices(num_new_points);
+    for (int64_t i = 0; i < num_reused; ++i) {
+        new_indices[i] = free_indices_.back();
+        free_indices_.pop_back();
+    }
+    for (int64_t i = num_reused; i < num_new_points; ++i) {
+        new_indices[i] = static_cast<int32_t>(num_points + i - num_reused);
+    }
+
+    const Tensor points_contiguous = points.Contiguous();
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(GetDtype(), [&]() {
+        const scalar_t *src_ptr = points_contiguous.GetDataPtr<scalar_t>();
+        scalar_t *points_ptr = dataset_points_.GetDataPtr<scalar_t>();
+        for (int64_t i = 0; i < num_new_points; ++i) {
+            const int32_t idx = new_indices[i];
+            std::copy(src_ptr + 3 * i, src_ptr + 3 * i + 3,
+                      points_ptr + 3 * idx);
+            const Eigen::Vector3i key = GetCellKey(points_ptr + 3 * idx);
+            cells_[key].push_back(idx);
+            min_cell_ = min_cell_.cwiseMin(key);
+            max_cell_ = max_cell_.cwiseMax(key);
+            active_[idx] = true;
+        }
+    });
+    num_active_points_ += num_new_points;
+    return Tensor(new_indices, {num_new_points}, Int32);
+}
+
+void DynamicGridIndex::RemovePoints(const Tensor &indices) {
+    AssertTensorDtypes(indices, {Int32, Int64});
+    AssertTensorDevice(indices, GetDevice());
+
+    const Tensor indices_contiguous = indices.To(Int64).Contiguous();
+    const int64_t *indices_ptr = indices_contiguous.GetDataPtr<int64_t>();
+    const int64_t num_points = GetDatasetSize();
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(GetDtype(), [&]() {
+        const scalar_t *points_ptr = dataset_points_.GetDataPtr<scalar_t>();
+        for (int64_t i = 0; i < indices_contiguous.NumElements(); ++i) {
+            const int64_t idx = indices_ptr[i];
+            if (idx < 0 || idx >= num_points) {
+                utility::LogError("Index {} is out of range [0, {}).", idx,
+                                  num_points);
+            }
+            if (!active_[idx]) {
+                continue;
+            }
+            const Eigen::Vector3i key = GetCellKey(points_ptr + 3 * idx);
+            auto cell_it = cells_.find(key);
+            std::vector<int32_t> &cell = cell_it->second;
+            auto it = std::find(cell.begin(), cell.end(),
+                                static_cast<int32_t>(idx));
+            *it = cell.back();
+            cell.pop_back();
+            if (cell.empty()) {
+                cells_.erase(cell_it);
+            }
+            active_[idx] = false;
+            free_indices_.push_back(static_cast<int32_t>(idx));
+            --num_active_points_;
+        }
+    });
+}
+
+Tensor DynamicGridIndex::GetActiveIndices() const {
+    std::vector<int32_t> active_indices;
+    active_indices.reserve(num_active_points_);
+    for (size_t i = 0; i < active_.size(); ++i) {
+        if (active_[i]) {
+            active_indices.push_back(static_cast<int32_t>(i));
+        }
+    }
+    return Tensor(active_indices, {num_active_points_}, Int32);
+}
+
+template <typename scalar_t>
+std::vector<std::pair<scalar_t, int32_t>> DynamicGridIndex::SearchRadiusSingle(
+        const scalar_t *query, double radius) const {
+    std::vector<std::pair<scalar_t, int32_t>> matches;
+    const scalar_t *points_ptr = dataset_points_.GetDataPtr<scalar_t>();
+    const scalar_t radius_squared = static_cast<scalar_t>(radius * radius);
+    auto visit_cell = [&](const std::vector<int32_t> &cell) {
+        for (const int32_t idx : cell) {
+            const scalar_t *point = points_ptr + 3 * idx;
+            const scalar_t dx = point[0] - query[0];
+            const scalar_t dy = point[1] - query[1];
+            const scalar_t dz = point[2] - query[2];
+            const scalar_t distance = dx * dx + dy * dy + dz * dz;
+            if (distance < radius_squared) {
+                matches.emplace_back(distance, idx);
+            }
+        }
+    };
+
+    const scalar_t r = static_cast<scalar_t>(radius);
+    const scalar_t query_min[3] = {query[0] - r, query[1] - r, query[2] - r};
+    const scalar_t query_max[3] = {query[0] + r, query[1] + r, query[2] + r};
+    const Eigen::Vector3i min_key =
+            GetCellKey(query_min).cwiseMax(min_cell_);
+    const Eigen::Vector3i max_key =
+            GetCellKey(query_max).cwiseMin(max_cell_);
+    if ((max_key.array() < min_key.array()).any()) {
+        return matches;
+    }
+
+    // Scanning the occupied cells is cheaper than probing a large range of
+    // mostly empty ones.
+    const Eigen::Vector3d range =
+            (max_key - min_key).cast<double>().array() + 1;
+    if (range.prod() > static_cast<double>(cells_.size())) {
+        for (const auto &kv : cells_) {
+            if ((kv.first.array() >= min_key.array()).all() &&
+                (kv.first.array() <= max_key.array()).all()) {
+                visit_cell(kv.second);
+            }
+        }
+    } else {
+        Eigen::Vector3i key;
+        for (key(0) = min_key(0); key(0) <= max_key(0); ++key(0)) {
+            for (key(1) = min_key(1); key(1) <= max_key(1); ++key(1)) {
+                for (key(2) = min_key(2); key(2) <= max_key(2); ++key(2)) {
+                    auto it = cells_.find(key);
+                    if (it != cells_.end()) {
+                        visit_cell(it->second);
+                    }
+                }
+            }
+        }
+    }
+    return matches;
+}
+
+template <typename scalar_t>
+std::vector<std::pair<scalar_t, int32_t>> DynamicGridIndex::SearchKnnSingle(
+        const scalar_t *query, int knn) const {
+    const size_t k = static_cast<size_t>(
+            std::min(static_cast<int64_t>(knn), num_active_points_));
+    std::vector<std::pair<scalar_t, int32_t>> matches;
+    if (k == 0) {
+        return matches;
+    }
+
+    const scalar_t *points_ptr = dataset_points_.GetDataPtr<scalar_t>();
+    // Max-heap of the best k candidates found so far.
+    std::priority_queue<std::pair<scalar_t, int32_t>> heap;
+    auto visit_cell = [&](const std::vector<int32_t> &cell) {
+        for (const int32_t idx : cell) {
+            const scalar_t *point = points_ptr + 3 * idx;
+            const scalar_t dx = point[0] - query[0];
+            const scalar_t dy = point[1] - query[1];
+            const scalar_t dz = point[2] - query[2];
+            const std::pair<scalar_t, int32_t> candidate(
+                    dx * dx + dy * dy + dz * dz, idx);
+            if (heap.size() < k) {
+                heap.push(candidate);
+            } else if (candidate < heap.top()) {
+                heap.pop();
+                heap.push(candidate);
+            }
+        }
+    };
+
+    // Visit cells in rings of growing Chebyshev distance around the query
+    // cell. After ring s, every unvisited point is at least s * voxel_size_
+    // away from the query.
+    const Eigen::Vector3i center = GetCellKey(query);
+    const int max_ring = std::max((center - min_cell_).cwiseAbs().maxCoeff(),
+                                  (max_cell_ - center).cwiseAbs().maxCoeff());
+    for (int s = 0; s <= max_ring; ++s) {
+        const double num_ring_cells = std::pow(2.0 * s + 1.0, 3);
+        if (num_ring_cells > static_cast<double>(cells_.size())) {
+            // The rings have become larger than the occupied grid. Finish
+            // with one pass over all cells instead.
+            heap = std::priority_queue<std::pair<scalar_t, int32_t>>();
+            for (const auto &kv : cells_) {
+                visit_cell(kv.second);
+            }
+            break;
+        }
+        Eigen::Vector3i offset;
+        for (offset(0) = -s; offset(0) <= s; ++offset(0)) {
+            for (offset(1) = -s; offset(1) <= s; ++offset(1)) {
+                for (offset(2) = -s; offset(2) <= s; ++offset(2)) {
+                    if (offset.cwiseAbs().maxCoeff() != s) {
+                        continue;
+                    }
+                    auto it = cells_.find(center + offset);
+                    if (it != cells_.end()) {
+                        visit_cell(it->second);
+                    }
+                }
+            }
+        }
+        const double bound = s * voxel_size_;
+        if (heap.size() == k && heap.top().first <= bound * bound) {
+            break;
+        }
+    }
+
+    matches.resize(heap.size());
+    for (size_t i = heap.size(); i > 0; --i) {
+        matches[i - 1] = heap.top();
+        heap.pop();
+    }
+    return matches;
+}
+
+void DynamicGridIndex::AssertQueryPoints(const Tensor &query_points) const {
+    if (voxel_size_ <= 0) {
+        utility::LogError("Index is not set.");
+    }
+    AssertTensorDevice(query_points, GetDevice());
+    AssertTensorDtype(query_points, GetDtype());
+    AssertTensorShape(query_points, {utility::nullopt, GetDimension()});
+}
+
+std::pair<Tensor, Tensor> DynamicGridIndex::SearchKnn(
+        const Tensor &query_points, int knn) const {
+    AssertQueryPoints(query_points);
+    if (knn <= 0) {
+        utility::LogError("knn should be larger than 0.");
+    }
+
+    const int64_t num_neighbors =
+            std::min(num_active_points_, static_cast<int64_t>(knn));
+    const int64_t num_query_points = query_points.GetLength();
+    Tensor indices({num_query_points, num_neighbors}, Int32, GetDevice());
+    Tensor distances({num_query_points, num_neighbors}, GetDtype(),
+                     GetDevice());
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(GetDtype(), [&]() {
+        const Tensor query_contiguous = query_points.Contiguous();
+        const scalar_t *query_ptr = query_contiguous.GetDataPtr<scalar_t>();
+        int32_t *indices_ptr = indices.GetDataPtr<int32_t>();
+        scalar_t *distances_ptr = distances.GetDataPtr<scalar_t>();
+        tbb::parallel_for(
+                tbb::blocked_range<int64_t>(0, num_query_points),
+                [&](const tbb::blocked_range<int64_t> &r) {
+                    for (int64_t i = r.begin(); i != r.end(); ++i) {
+                        const auto matches =
+                                SearchKnnSingle(query_ptr + 3 * i, knn);
+                        for (int64_t j = 0; j < num_neighbors; ++j) {
+                            indices_ptr[i * num_neighbors + j] =
+                                    matches[j].second;
+                            distances_ptr[i * num_neighbors + j] =
+                                    matches[j].first;
+                        }
+                    }
+                });
+    });
+    return std::make_pair(indices, distances);
+}
+
+std::tuple<Tensor, Tensor, Tensor> DynamicGridIndex::SearchRadius(
+        const Tensor &query_points, const Tensor &radii, bool sort) const {
+    AssertQueryPoints(query_points);
+    AssertTensorDevice(radii, GetDevice());
+    AssertTensorDtype(radii, GetDtype());
+    const int64_t num_query_points = query_points.GetLength();
+    AssertTensorShape(radii, {num_query_points});
+    if (radii.Le(0).Any()) {
+        utility::LogError("radius should be larger than 0.");
+    }
+
+    std::tuple<Tensor, Tensor, Tensor> result;
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(GetDtype(), [&]() {
+        const Tensor query_contiguous = query_points.Contiguous();
+        const Tensor radii_contiguous = radii.Contiguous();
+        const scalar_t *query_ptr = query_contiguous.GetDataPtr<scalar_t>();
+        const scalar_t *radii_ptr = radii_contiguous.GetDataPtr<scalar_t>();
+        std::vector<std::vector<std::pair<scalar_t, int32_t>>> matches(
+                num_query_points);
+        tbb::parallel_for(
+                tbb::blocked_range<int64_t>(0, num_query_points),
+                [&](const tbb::blocked_range<int64_t> &r) {
+                    for (int64_t i = r.begin(); i != r.end(); ++i) {
+                        matches[i] = SearchRadiusSingle(query_ptr + 3 * i,
+                                                        radii_ptr[i]);
+                        if (sort) {
+                            std::sort(matches[i].begin(), matches[i].end());
+                        }
+                    }
+                });
+        result = PackRaggedResults(matches, GetDtype(), GetDevice());
+    });
+    return result;
+}
+
+std::tuple<Tensor, Tensor, Tensor> DynamicGridIndex::SearchRadius(
+        const Tensor &query_points, double radius, bool sort) const {
+    const int64_t num_query_points = query_points.GetLength();
+    const Tensor radii = Tensor::Full({num_query_points}, radius, GetDtype(),
+                                      GetDevice());
+    return SearchRadius(query_points, radii, sort);
+}
+
+std::tuple<Tensor, Tensor, Tensor> DynamicGridIndex::SearchHybrid(
+        const Tensor &query_points, double radius, int max_knn) const {
+    AssertQueryPoints(query_points);
+    if (max_knn <= 0) {
+        utility::LogError("max_knn should be larger than 0.");
+    }
+    if (radius <= 0) {
+        utility::LogError("radius should be larger than 0.");
+    }
+
+    const int64_t num_query_points = query_points.GetLength();
+    Tensor indices({num_query_points, max_knn}, Int32, GetDevice());
+    Tensor distances({num_query_points, max_knn}, GetDtype(), GetDevice());
+    Tensor counts({num_query_points}, Int32, GetDevice());
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(GetDtype(), [&]() {
+        const Tensor query_contiguous = query_points.Contiguous();
+        const scalar_t *query_ptr = query_contiguous.GetDataPtr<scalar_t>();
+        int32_t *indices_ptr = indices.GetDataPtr<int32_t>();
+        scalar_t *distances_ptr = distances.GetDataPtr<scalar_t>();
+        int32_t *counts_ptr = counts.GetDataPtr<int32_t>();
+        tbb::parallel_for(
+                tbb::blocked_range<int64_t>(0, num_query_points),
+                [&](const tbb::blocked_range<int64_t> &r) {
+                    for (int64_t i = r.begin(); i != r.end(); ++i) {
+                        auto matches =
+                                SearchRadiusSingle(query_ptr + 3 * i, radius);
+                        const int count = std::min(
+                                static_cast<int>(matches.size()), max_knn);
+                        std::partial_sort(matches.begin(),
+                                          matches.begin() + count,
+                                          matches.end());
+                        counts_ptr[i] = count;
+                        for (int j = 0; j < max_knn; ++j) {
+                            const int64_t offset = i * max_knn + j;
+                            indices_ptr[offset] =
+                                    j < count ? matches[j].second : -1;
+                            distances_ptr[offset] =
+                                    j < count ? matches[j].first : 0;
+                        }
+                    }
+                });
+    });
+    return std::make_tuple(indices, distances, counts);
+}
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,154 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <unordered_map>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/nns/NNSIndex.h"
+#include "open3d/utility/Helper.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+/// \class DynamicGridIndex
+///
+/// \brief Uniform hash grid for nearest neighbor search that supports
+/// inserting and removing points without rebuilding the index.
+///
+/// A point keeps the index it was inserted with until it is removed.
+/// Removing a point does not shift the indices of the remaining points. Its
+/// index is reused by a later insertion, so the storage stays bounded by
+/// the largest number of points active at once. Only CPU tensors with 3D
+/// points are supported.
+class DynamicGridIndex : public NNSIndex {
+public:
+    /// \brief Default Constructor.
+    DynamicGridIndex();
+
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param dataset_points Initial points. Must be 2D, with shape {n, 3}.
+    /// \param voxel_size Edge length of the grid cells. Radius and hybrid
+    /// searches are fastest when the search radius is close to this value.
+    DynamicGridIndex(const Tensor &dataset_points, double voxel_size);
+    ~DynamicGridIndex();
+    DynamicGridIndex(const DynamicGridIndex &) = delete;
+    DynamicGridIndex &operator=(const DynamicGridIndex &) = delete;
+
+public:
+    bool SetTensorData(const Tensor &dataset_points) override {
+        utility::LogError(
+                "DynamicGridIndex::SetTensorData requires a voxel size.");
+    }
+
+    /// Reset the index to contain only \p dataset_points, with indices
+    /// 0 to n - 1.
+    bool SetTensorData(const Tensor &dataset_points,
+                       double voxel_size) override;
+
+    /// Insert points into the index. Indices of removed points are reused
+    /// before new ones are allocated.
+    ///
+    /// \param points Points to insert. Must be 2D, with shape {m, 3}, same
+    /// dtype with dataset_points.
+    /// \return Indices assigned to the inserted points, Tensor of shape {m,}
+    /// with dtype Int32.
+    Tensor InsertPoints(const Tensor &points);
+
+    /// Remove points from the index. Indices of points that have already
+    /// been removed are ignored.
+    ///
+    /// \param indices Indices of points to remove, with dtype Int32 or Int64.
+    void RemovePoints(const Tensor &indices);
+
+    /// Get the indices of all active points in increasing order.
+    /// \return Tensor of shape {num_active_points,}, with dtype Int32.
+    Tensor GetActiveIndices() const;
+
+    /// Get the number of points that have not been removed.
+    int64_t GetNumActivePoints() const { return num_active_points_; }
+
+    /// Get the edge length of the grid cells.
+    double GetVoxelSize() const { return voxel_size_; }
+
+    std::pair<Tensor, Tensor> SearchKnn(const Tensor &query_points,
+                                        int knn) const override;
+
+    std::tuple<Tensor, Tensor, Tensor> SearchRadius(
+            const Tensor &query_points,
+            const Tensor &radii,
+            bool sort = true) const override;
+
+    std::tuple<Tensor, Tensor, Tensor> SearchRadius(
+            const Tensor &query_points,
+            double radius,
+            bool sort = true) const override;
+
+    std::tuple<Tensor, Tensor, Tensor> SearchHybrid(const Tensor &query_points,
+                                                    double radius,
+                                                    int max_knn) const override;
+
+protected:
+    template <typename scalar_t>
+    Eigen::Vector3i GetCellKey(const scalar_t *point) const;
+
+    template <typename scalar_t>
+    std::vector<std::pair<scalar_t, int32_t>> SearchRadiusSingle(
+            const scalar_t *query, double radius) const;
+
+    template <typename scalar_t>
+    std::vector<std::pair<scalar_t, int32_t>> SearchKnnSingle(
+            const scalar_t *query, int knn) const;
+
+    void AssertQueryPoints(const Tensor &query_points) const;
+
+protected:
+    double voxel_size_ = 0;
+    int64_t num_active_points_ = 0;
+    /// Storage with spare capacity, dataset_points_ is a view of its first
+    /// rows so that inserting does not copy the existing points.
+    Tensor points_buffer_;
+    std::vector<bool> active_;
+    /// Indices of removed points, reused by InsertPoints.
+    std::vector<int32_t> free_indices_;
+    std::unordered_map<Eigen::Vector3i,
+                       std::vector<int32_t>,
+                       utility::hash_eigen<Eigen::Vector3i>>
+            cells_;
+    /// Bounds of all cells that have ever been occupied. Knn search stops
+    /// expanding once these are covered.
+    Eigen::Vector3i min_cell_;
+    Eigen::Vector3i max_cell_;
+};
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
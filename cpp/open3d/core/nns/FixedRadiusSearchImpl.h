@@ -28,7 +28,9 @@
 
 #include <tbb/parallel_for.h>
 
-#include <set>
+#include <algorithm>
+#include <cmath>
+#include <vector>
 
 #include "open3d/core/Atomic.h"
 #include "open3d/core/nns/NeighborSearchCommon.h"
@@ -189,6 +191,56 @@ Eigen::Array<typename TDerived::Scalar, VECSIZE, 1> NeighborsDist(
     return dist;
 }
 
+/// Collects the hash table bins that can contain neighbors of \p pos within
+/// \p radius. Bins are written to \p bins without duplicates.
+///
+/// \return Returns the number of bins written to \p bins.
+template <class T>
+int GetBinsToVisit(const utility::MiniVec<T, 3>& pos,
+                   const T radius,
+                   const T inv_voxel_size,
+                   const size_t hash_table_size,
+                   const size_t first_cell_idx,
+                   size_t* bins) {
+    typedef utility::MiniVec<T, 3> Vec3_t;
+    int num_bins = 1;
+    bins[0] = first_cell_idx +
+              SpatialHash(ComputeVoxelIndex(pos, inv_voxel_size)) %
+                      hash_table_size;
+    for (int dz = -1; dz <= 1; dz += 2) {
+        for (int dy = -1; dy <= 1; dy += 2) {
+            for (int dx = -1; dx <= 1; dx += 2) {
+                Vec3_t p = pos + radius * Vec3_t(T(dx), T(dy), T(dz));
+                const size_t bin =
+                        first_cell_idx +
+                        SpatialHash(ComputeVoxelIndex(p, inv_voxel_size)) %
+                                hash_table_size;
+                if (std::find(bins, bins + num_bins, bin) ==
+                    bins + num_bins) {
+                    bins[num_bins++] = bin;
+                }
+            }
+        }
+    }
+    return num_bins;
+}
+
+/// Distance of a single point to \p pos. For L2 the squared distance is
+/// returned.
+template <int METRIC, class T>
+inline T PointDist(const utility::MiniVec<T, 3>& pos, const T* const point) {
+    const T dx = point[0] - pos[0];
+    const T dy = point[1] - pos[1];
+    const T dz = point[2] - pos[2];
+    if (METRIC == Linf) {
+        return std::max(std::abs(dx), std::max(std::abs(dy), std::abs(dz)));
+    } else if (METRIC == L1) {
+        return std::abs(dx) + std::abs(dy) + std::abs(dz);
+    } else {
+        return dx * dx + dy * dy + dz * dz;
+    }
+}
+
 /// Implementation of FixedRadiusSearchCPU with template params for metrics
 /// and boolean options.
 template <class T,
@@ -265,32 +317,16 @@ void _FixedRadiusSearchCPU(int64_t* query_neighbors_row_splits,
 
                         Vec3_t pos(queries + i * 3);
 
-                        std::set<size_t> bins_to_visit;
-
-                        auto voxel_index =
-                                ComputeVoxelIndex(pos, inv_voxel_size);
-                        size_t hash =
-                                SpatialHash(voxel_index) % hash_table_size;
-
-                        bins_to_visit.insert(first_cell_idx + hash);
-
-                        for (int dz = -1; dz <= 1; dz += 2)
-                            for (int dy = -1; dy <= 1; dy += 2)
-                                for (int dx = -1; dx <= 1; dx += 2) {
-                                    Vec3_t p =
-                                            pos + radius * Vec3_t(T(dx), T(dy),
-                                                                  T(dz));
-                                    voxel_index = ComputeVoxelIndex(
-                                            p, inv_voxel_size);
-                                    hash = SpatialHash(voxel_index) %
-                                           hash_table_size;
-                                    bins_to_visit.insert(first_cell_idx + hash);
-                                }
+                        size_t bins_to_visit[8];
+                        const int num_bins = GetBinsToVisit(
+                                pos, radius, inv_voxel_size, hash_table_size,
+                                first_cell_idx, bins_to_visit);
 
                         Poslist_t xyz;
                         int vec_i = 0;
 
-                        for (size_t bin : bins_to_visit) {
+                        for (int bin_i = 0; bin_i < num_bins; ++bin_i) {
+                            const size_t bin = bins_to_visit[bin_i];
                             size_t begin_idx = hash_table_cell_splits[bin];
                             size_t end_idx = hash_table_cell_splits[bin + 1];
 
@@ -372,33 +408,17 @@ void _FixedRadiusSearchCPU(int64_t* query_neighbors_row_splits,
                         Vec3_t pos(queries[i * 3 + 0], queries[i * 3 + 1],
                                    queries[i * 3 + 2]);
 
-                        std::set<size_t> bins_to_visit;
-
-                        auto voxel_index =
-                                ComputeVoxelIndex(pos, inv_voxel_size);
-                        size_t hash =
-                                SpatialHash(voxel_index) % hash_table_size;
-
-                        bins_to_visit.insert(first_cell_idx + hash);
-
-                        for (int dz = -1; dz <= 1; dz += 2)
-                            for (int dy = -1; dy <= 1; dy += 2)
-                                for (int dx = -1; dx <= 1; dx += 2) {
-                                    Vec3_t p =
-                                            pos + radius * Vec3_t(T(dx), T(dy),
-                                                                  T(dz));
-                                    voxel_index = ComputeVoxelIndex(
-                                            p, inv_voxel_size);
-                                    hash = SpatialHash(voxel_index) %
-                                           hash_table_size;
-                                    bins_to_visit.insert(first_cell_idx + hash);
-                                }
+                        size_t bins_to_visit[8];
+                        const int num_bins = GetBinsToVisit(
+                                pos, radius, inv_voxel_size, hash_table_size,
+                                first_cell_idx, bins_to_visit);
 
                         Poslist_t xyz;
                         Veci_t idx_vec;
                         int vec_i = 0;
 
-                        for (size_t bin : bins_to_visit) {
+                        for (int bin_i = 0; bin_i < num_bins; ++bin_i) {
+                            const size_t bin = bins_to_visit[bin_i];
                             size_t begin_idx = hash_table_cell_splits[bin];
                             size_t end_idx = hash_table_cell_splits[bin + 1];
 
@@ -464,6 +484,115 @@ void _FixedRadiusSearchCPU(int64_t* query_neighbors_row_splits,
 #undef VECSIZE
 }
 
+/// Implementation of HybridSearchCPU with template params for metrics.
+template <class T, class OUTPUT_ALLOCATOR, int METRIC>
+void _HybridSearchCPU(size_t num_points,
+                      const T* const points,
+                      size_t num_queries,
+                      const T* const queries,
+                      const T radius,
+                      const int max_knn,
+                      const size_t points_row_splits_size,
+                      const int64_t* const points_row_splits,
+                      const size_t queries_row_splits_size,
+                      const int64_t* const queries_row_splits,
+                      const uint32_t* const hash_table_splits,
+                      const size_t hash_table_cell_splits_size,
+                      const uint32_t* const hash_table_cell_splits,
+                      const uint32_t* const hash_table_index,
+                      OUTPUT_ALLOCATOR& output_allocator) {
+    typedef utility::MiniVec<T, 3> Vec3_t;
+
+    // return empty output arrays if there are no points
+    if (num_points == 0 || num_queries == 0) {
+        int32_t* indices_ptr;
+        output_allocator.AllocIndices(&indices_ptr, 0);
+
+        T* distances_ptr;
+        output_allocator.AllocDistances(&distances_ptr, 0);
+
+        int32_t* counts_ptr;
+        output_allocator.AllocCounts(&counts_ptr, 0);
+        return;
+    }
+
+    const int batch_size = points_row_splits_size - 1;
+
+    // use squared radius for L2 to avoid sqrt
+    const T threshold = (METRIC == L2 ? radius * radius : radius);
+
+    const T voxel_size = 2 * radius;
+    const T inv_voxel_size = 1 / voxel_size;
+
+    const size_t num_indices = num_queries * max_knn;
+
+    int32_t* indices_ptr;
+    output_allocator.AllocIndices(&indices_ptr, num_indices, -1);
+
+    T* distances_ptr;
+    output_allocator.AllocDistances(&distances_ptr, num_indices, 0);
+
+    int32_t* counts_ptr;
+    output_allocator.AllocCounts(&counts_ptr, num_queries, 0);
+
+    for (int i = 0; i < batch_size; ++i) {
+        const size_t hash_table_size =
+                hash_table_splits[i + 1] - hash_table_splits[i];
+        const size_t first_cell_idx = hash_table_splits[i];
+        tbb::parallel_for(
+                tbb::blocked_range<size_t>(queries_row_splits[i],
+                                           queries_row_splits[i + 1]),
+                [&](const tbb::blocked_range<size_t>& r) {
+                    // Max-heap with the max_knn closest neighbors found so
+                    // far, reused for all queries of this range.
+                    std::vector<std::pair<T, int32_t>> heap;
+                    heap.reserve(max_knn);
+                    for (size_t i = r.begin(); i != r.end(); ++i) {
+                        Vec3_t pos(queries + i * 3);
+
+                        size_t bins_to_visit[8];
+                        const int num_bins = GetBinsToVisit(
+                                pos, radius, inv_voxel_size, hash_table_size,
+                                first_cell_idx, bins_to_visit);
+
+                        heap.clear();
+                        for (int bin_i = 0; bin_i < num_bins; ++bin_i) {
+                            const size_t bin = bins_to_visit[bin_i];
+                            size_t begin_idx = hash_table_cell_splits[bin];
+                            size_t end_idx = hash_table_cell_splits[bin + 1];
+
+                            for (size_t j = begin_idx; j < end_idx; ++j) {
+                                const int32_t idx = hash_table_index[j];
+                                const T dist = PointDist<METRIC>(
+                                        pos, points + 3 * int64_t(idx));
+                                if (dist > threshold) {
+                                    continue;
+                                }
+                                const std::pair<T, int32_t> neighbor(dist,
+                                                                     idx);
+                                if (int(heap.size()) < max_knn) {
+                                    heap.push_back(neighbor);
+                                    std::push_heap(heap.begin(), heap.end());
+                                } else if (neighbor < heap.front()) {
+                                    std::pop_heap(heap.begin(), heap.end());
+                                    heap.back() = neighbor;
+                                    std::push_heap(heap.begin(), heap.end());
+                                }
+                            }
+                        }
+                        std::sort_heap(heap.begin(), heap.end());
+
+                        const size_t indices_offset = i * max_knn;
+                        for (size_t k = 0; k < heap.size(); ++k) {
+                            indices_ptr[indices_offset + k] = heap[k].second;
+                            distances_ptr[indices_offset + k] = heap[k].first;
+                        }
+                        counts_ptr[i] = static_cast<int32_t>(heap.size());
+                    }
+                });
+    }
+}
+
 }  // namespace
 
 /// Fixed radius search. This function computes a list of neighbor indices
@@ -597,6 +726,57 @@ void FixedRadiusSearchCPU(int64_t* query_neighbors_row_splits,
 #undef FN_PARAMETERS
 }
 
+/// Hybrid search. This function computes up to \p max_knn nearest neighbors
+/// within \p radius for each query point, sorted by distance. The hash table
+/// must have been built with BuildSpatialHashTableCPU for the same radius.
+///
+/// \tparam T    Floating-point data type for the point positions.
+///
+/// \tparam OUTPUT_ALLOCATOR    Type of the output_allocator. It must
+///         implement AllocIndices, AllocDistances and AllocCounts with an
+///         additional fill value argument.
+///
+/// The indices and distances are returned as arrays of size
+/// num_queries * max_knn. Unused entries are filled with -1 and 0. The
+/// counts array has one entry per query. See FixedRadiusSearchCPU for the
+/// description of the other parameters.
+template <class T, class OUTPUT_ALLOCATOR>
+void HybridSearchCPU(const size_t num_points,
+                     const T* const points,
+                     const size_t num_queries,
+                     const T* const queries,
+                     const T radius,
+                     const int max_knn,
+                     const size_t points_row_splits_size,
+                     const int64_t* const points_row_splits,
+                     const size_t queries_row_splits_size,
+                     const int64_t* const queries_row_splits,
+                     const uint32_t* const hash_table_splits,
+                     const size_t hash_table_cell_splits_size,
+                     const uint32_t* const hash_table_cell_splits,
+                     const uint32_t* const hash_table_index,
+                     const Metric metric,
+                     OUTPUT_ALLOCATOR& output_allocator) {
+#define FN_PARAMETERS                                                        \
+    num_points, points, num_queries, queries, radius, max_knn,               \
+            points_row_splits_size, points_row_splits,                       \
+            queries_row_splits_size, queries_row_splits, hash_table_splits,  \
+            hash_table_cell_splits_size, hash_table_cell_splits,             \
+            hash_table_index, output_allocator
+
+#define CALL_TEMPLATE(METRIC)                                         \
+    if (METRIC == metric) {                                           \
+        _HybridSearchCPU<T, OUTPUT_ALLOCATOR, METRIC>(FN_PARAMETERS); \
+    }
+
+    CALL_TEMPLATE(L1)
+    CALL_TEMPLATE(L2)
+    CALL_TEMPLATE(Linf)
+
+#undef CALL_TEMPLATE
+#undef FN_PARAMETERS
+}
+
 }  // namespace impl
 }  // namespace nns
 }  // namespace core
@@ -25,6 +25,11 @@
 // ----------------------------------------------------------------------------
 //
 
+#include <tbb/parallel_for.h>
+
+#include <algorithm>
+#include <vector>
+
 #include "open3d/core/Tensor.h"
 #include "open3d/core/nns/FixedRadiusIndex.h"
 #include "open3d/core/nns/FixedRadiusSearchImpl.h"
@@ -87,6 +92,34 @@ void FixedRadiusSearchCPU(const Tensor& points,
 
     neighbors_index = output_allocator.NeighborsIndex();
     neighbors_distance = output_allocator.NeighborsDistance();
+
+    if (sort && return_distances) {
+        // Sort the neighbors of each query point by distance.
+        const int64_t num_queries = queries.GetShape()[0];
+        const int64_t* row_splits_ptr =
+                neighbors_row_splits.GetDataPtr<int64_t>();
+        int32_t* indices_ptr = neighbors_index.GetDataPtr<int32_t>();
+        T* distances_ptr = neighbors_distance.GetDataPtr<T>();
+        tbb::parallel_for(
+                tbb::blocked_range<int64_t>(0, num_queries),
+                [&](const tbb::blocked_range<int64_t>& r) {
+                    std::vector<std::pair<T, int32_t>> neighbors;
+                    for (int64_t i = r.begin(); i != r.end(); ++i) {
+                        const int64_t begin = row_splits_ptr[i];
+                        const int64_t end = row_splits_ptr[i + 1];
+                        neighbors.clear();
+                        for (int64_t j = begin; j < end; ++j) {
+                            neighbors.emplace_back(distances_ptr[j],
+                                                   indices_ptr[j]);
+                        }
+                        std::sort(neighbors.begin(), neighbors.end());
+                        for (int64_t j = begin; j < end; ++j) {
+                            distances_ptr[j] = neighbors[j - begin].first;
+                            indices_ptr[j] = neighbors[j - begin].second;
+                        }
+                    }
+                });
+    }
 }
 
 template <class T>
@@ -103,7 +136,24 @@ void HybridSearchCPU(const Tensor& points,
                      Tensor& neighbors_index,
                      Tensor& neighbors_count,
                      Tensor& neighbors_distance) {
-    utility::LogError("Not implemented.");
+    Device device = points.GetDevice();
+    NeighborSearchAllocator<T> output_allocator(device);
+
+    open3d::core::nns::impl::HybridSearchCPU(
+            points.GetShape()[0], points.GetDataPtr<T>(), queries.GetShape()[0],
+            queries.GetDataPtr<T>(), T(radius), max_knn,
+            points_row_splits.GetShape()[0],
+            points_row_splits.GetDataPtr<int64_t>(),
+            queries_row_splits.GetShape()[0],
+            queries_row_splits.GetDataPtr<int64_t>(),
+            hash_table_splits.GetDataPtr<uint32_t>(),
+            hash_table_cell_splits.GetShape()[0],
+            hash_table_cell_splits.GetDataPtr<uint32_t>(),
+            hash_table_index.GetDataPtr<uint32_t>(), metric, output_allocator);
+
+    neighbors_index = output_allocator.NeighborsIndex();
+    neighbors_distance = output_allocator.NeighborsDistance();
+    neighbors_count = output_allocator.NeighborsCount();
 }
 
 #define INSTANTIATE_BUILD(T)                                                  \
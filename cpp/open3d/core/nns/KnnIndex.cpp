@@ -26,6 +26,9 @@
 
 #include "open3d/core/nns/KnnIndex.h"
 
+#include <algorithm>
+#include <tuple>
+
 #include "open3d/core/Device.h"
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/TensorCheck.h"
@@ -80,9 +83,11 @@ bool KnnIndex::SetTensorData(const Tensor& dataset_points,
                 "Please recompile Open3d With -DBUILD_CUDA_MODULE=ON.");
 #endif
     } else {
-        utility::LogError(
-                "CPU Tensor is not supported in KnnIndex. Please use "
-                "NanoFlannIndex instead.");
+        dataset_points_ = dataset_points.Contiguous();
+        points_row_splits_ = points_row_splits.Contiguous();
+        nanoflann_index_.reset(new NanoFlannIndex());
+        return nanoflann_index_->SetTensorData(dataset_points_,
+                                               points_row_splits_);
     }
     return false;
 }
@@ -143,9 +148,19 @@ std::pair<Tensor, Tensor> KnnIndex::SearchKnn(const Tensor& query_points,
                 "-DBUILD_CUDA_MODULE=ON.");
 #endif
     } else {
-        utility::LogError(
-                "-DBUILD_CUDA_MODULE=OFF. Please compile Open3d with "
-                "-DBUILD_CUDA_MODULE=ON.");
+        std::tie(neighbors_index, neighbors_distance, neighbors_row_splits) =
+                nanoflann_index_->SearchKnn(query_points_, queries_row_splits_,
+                                            knn);
+        // Match the CUDA layout: a single batch item returns {n, knn}.
+        if (points_row_splits_.GetShape(0) == 2) {
+            const int64_t num_neighbors =
+                    std::min(static_cast<int64_t>(GetDatasetSize()),
+                             static_cast<int64_t>(knn));
+            neighbors_index = neighbors_index.View(
+                    {query_points.GetShape(0), num_neighbors});
+            neighbors_distance = neighbors_distance.View(
+                    {query_points.GetShape(0), num_neighbors});
+        }
     }
     return std::make_pair(neighbors_index, neighbors_distance);
 }
@@ -29,6 +29,7 @@
 #include "open3d/core/Dtype.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/nns/NNSIndex.h"
+#include "open3d/core/nns/NanoFlannIndex.h"
 #include "open3d/core/nns/NeighborSearchCommon.h"
 #include "open3d/utility/Logging.h"
 
@@ -98,6 +99,8 @@ public:
 
 protected:
     Tensor points_row_splits_;
+    /// Batched KDTrees used for CPU tensors.
+    std::unique_ptr<NanoFlannIndex> nanoflann_index_;
 };
 
 }  // namespace nns
@@ -28,8 +28,10 @@
 #include <tbb/parallel_for.h>
 
 #include <algorithm>
+#include <memory>
 #include <mutex>
 #include <nanoflann.hpp>
+#include <vector>
 
 #include "open3d/core/Atomic.h"
 #include "open3d/core/nns/NeighborSearchCommon.h"
@@ -403,6 +405,85 @@ void _HybridSearchCPU(NanoFlannIndexHolderBase *holder,
             });
 }
 
+template <class T, class OUTPUT_ALLOCATOR, int METRIC>
+void _KnnSearchBatchCPU(NanoFlannIndexHolderBase *const *holders,
+                        int64_t batch_size,
+                        const int64_t *const points_row_splits,
+                        const int64_t *const queries_row_splits,
+                        int64_t *query_neighbors_row_splits,
+                        const T *const queries,
+                        const size_t dimension,
+                        int knn,
+                        bool return_distances,
+                        OUTPUT_ALLOCATOR &output_allocator) {
+    // Every query of batch item b gets exactly min(knn, num_points_b)
+    // neighbors, so the output layout is known before searching and all
+    // queries of all batch items can be processed in a single pass.
+    std::vector<int64_t> batch_knn(batch_size);
+    std::vector<int64_t> batch_offset(batch_size + 1, 0);
+    for (int64_t b = 0; b < batch_size; ++b) {
+        const int64_t num_points_b =
+                holders[b] ? points_row_splits[b + 1] - points_row_splits[b]
+                           : 0;
+        batch_knn[b] = std::min(static_cast<int64_t>(knn), num_points_b);
+        batch_offset[b + 1] =
+                batch_offset[b] +
+                batch_knn[b] *
+                        (queries_row_splits[b + 1] - queries_row_splits[b]);
+    }
+    const int64_t num_queries = queries_row_splits[batch_size];
+    const int64_t num_indices = batch_offset[batch_size];
+
+    index_t *indices_ptr;
+    output_allocator.AllocIndices(&indices_ptr, num_indices);
+    T *distances_ptr;
+    if (return_distances)
+        output_allocator.AllocDistances(&distances_ptr, num_indices);
+    else
+        output_allocator.AllocDistances(&distances_ptr, 0);
+
+    query_neighbors_row_splits[0] = 0;
+    if (num_indices == 0) {
+        std::fill(query_neighbors_row_splits,
+                  query_neighbors_row_splits + num_queries + 1, 0);
+        return;
+    }
+
+    typedef NanoFlannIndexHolder<METRIC, T, index_t> holder_t;
+    tbb::parallel_for(
+            tbb::blocked_range<int64_t>(0, num_queries),
+            [&](const tbb::blocked_range<int64_t> &r) {
+                std::vector<index_t> result_indices(knn);
+                std::vector<T> result_distances(knn);
+                // Locate the batch item of the first query in the range,
+                // then advance as the range crosses batch boundaries.
+                int64_t b = std::upper_bound(queries_row_splits,
+                                             queries_row_splits + batch_size,
+                                             r.begin()) -
+                            queries_row_splits - 1;
+                for (int64_t i = r.begin(); i != r.end(); ++i) {
+                    while (i >= queries_row_splits[b + 1]) ++b;
+                    const int64_t k = batch_knn[b];
+                    const int64_t start =
+                            batch_offset[b] + (i - queries_row_splits[b]) * k;
+                    query_neighbors_row_splits[i + 1] = start + k;
+                    if (k == 0) continue;
+
+                    auto holder = static_cast<holder_t *>(holders[b]);
+                    holder->index_->knnSearch(&queries[i * dimension], k,
+                                              result_indices.data(),
+                                              result_distances.data());
+                    std::copy(result_indices.begin(),
+                              result_indices.begin() + k, &indices_ptr[start]);
+                    if (return_distances) {
+                        std::copy(result_distances.begin(),
+                                  result_distances.begin() + k,
+                                  &distances_ptr[start]);
+                    }
+                }
+            });
+}
+
 }  // namespace
 
 /// Build KD Tree. This function build a KDTree for given dataset points.
@@ -713,6 +794,126 @@ void HybridSearchCPU(NanoFlannIndexHolderBase *holder,
 #undef FN_PARAMETERS
 }
 
+/// Build one KD Tree per batch item. The trees are built concurrently, which
+/// amortizes the per-index setup cost when many small point clouds are
+/// processed together.
+///
+/// \tparam T   Floating-point data type for the point positions.
+///
+/// \param batch_size   The number of point clouds in the batch.
+///
+/// \param points_row_splits   Array of size \p batch_size + 1 defining the
+///        start and end of each point cloud in \p points.
+///
+/// \param points   Array with the point positions of all point clouds.
+///
+/// \param dimension    The dimension of points.
+///
+/// \param metric   One of L1, L2. Defines the distance metric for the
+///        search.
+///
+/// \return Vector of \p batch_size holders. The holder of an empty point
+///         cloud is nullptr.
+template <class T>
+std::vector<std::unique_ptr<NanoFlannIndexHolderBase>> BuildKdTreeBatch(
+        int64_t batch_size,
+        const int64_t *const points_row_splits,
+        const T *const points,
+        size_t dimension,
+        const Metric metric) {
+    std::vector<std::unique_ptr<NanoFlannIndexHolderBase>> holders(batch_size);
+    tbb::parallel_for(
+            tbb::blocked_range<int64_t>(0, batch_size, 1),
+            [&](const tbb::blocked_range<int64_t> &r) {
+                for (int64_t b = r.begin(); b != r.end(); ++b) {
+                    const int64_t num_points_b =
+                            points_row_splits[b + 1] - points_row_splits[b];
+                    if (num_points_b == 0) continue;
+                    holders[b] = BuildKdTree<T>(
+                            num_points_b,
+                            points + points_row_splits[b] * dimension,
+                            dimension, metric);
+                }
+            });
+    return holders;
+}
+
+/// Batched KNN search. Searches the queries of each batch item in the KD Tree
+/// of the corresponding point cloud. All queries of all batch items are
+/// processed in a single parallel pass. Each query of batch item b gets
+/// min(\p knn, num_points_b) neighbors, sorted by distance. Neighbor indices
+/// are relative to the start of the point cloud of the batch item.
+///
+/// \tparam T    Floating-point data type for the point positions.
+///
+/// \tparam OUTPUT_ALLOCATOR    Type of the output_allocator. See
+///         \p output_allocator for more information.
+///
+/// \param holders    Array of \p batch_size holders built with
+///        BuildKdTreeBatch. Empty point clouds have a nullptr holder.
+///
+/// \param batch_size    The number of batch items.
+///
+/// \param points_row_splits    Array of size \p batch_size + 1 defining the
+///        start and end of each point cloud.
+///
+/// \param queries_row_splits    Array of size \p batch_size + 1 defining the
+///        start and end of the queries of each batch item in \p queries.
+///
+/// \param query_neighbors_row_splits    This is the output pointer for the
+///        prefix sum. The length of this array is the number of queries + 1.
+///
+/// \param queries    Array with the query positions.
+///
+/// \param dimension    The dimension of the points and \p queries.
+///
+/// \param knn    The number of neighbors to search.
+///
+/// \param metric    One of L1, L2. Defines the distance metric for the
+///        search.
+///
+/// \param return_distances    If true then this function will return the
+///        distances for each neighbor to its query point in the same format
+///        as the indices.
+///        Note that for the L2 metric the squared distances will be returned!!
+///
+/// \param output_allocator    An object that implements functions for
+///         allocating the output arrays. See KnnSearchCPU.
+///
+template <class T, class OUTPUT_ALLOCATOR>
+void KnnSearchBatchCPU(NanoFlannIndexHolderBase *const *holders,
+                       int64_t batch_size,
+                       const int64_t *const points_row_splits,
+                       const int64_t *const queries_row_splits,
+                       int64_t *query_neighbors_row_splits,
+                       const T *const queries,
+                       const size_t dimension,
+                       int knn,
+                       const Metric metric,
+                       bool return_distances,
+                       OUTPUT_ALLOCATOR &output_allocator) {
+#define FN_PARAMETERS                                                    \
+    holders, batch_size, points_row_splits, queries_row_splits,          \
+            query_neighbors_row_splits, queries, dimension, knn,         \
+            return_distances, output_allocator
+
+#define CALL_TEMPLATE(METRIC)                                           \
+    if (METRIC == metric) {                                             \
+        _KnnSearchBatchCPU<T, OUTPUT_ALLOCATOR, METRIC>(FN_PARAMETERS); \
+    }
+
+#define CALL_TEMPLATE2 \
+    CALL_TEMPLATE(L1)  \
+    CALL_TEMPLATE(L2)
+
+    CALL_TEMPLATE2
+
+#undef CALL_TEMPLATE
+#undef CALL_TEMPLATE2
+
+#undef FN_PARAMETERS
+}
+
 }  // namespace impl
 }  // namespace nns
 }  // namespace core
@@ -58,6 +58,8 @@ bool NanoFlannIndex::SetTensorData(const Tensor &dataset_points) {
     }
 
     dataset_points_ = dataset_points.Contiguous();
+    batch_holders_.clear();
+    points_row_splits_ = Tensor();
     DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(GetDtype(), [&]() {
         holder_ = impl::BuildKdTree<scalar_t>(
                 dataset_points_.GetShape(0),
@@ -67,6 +69,42 @@ bool NanoFlannIndex::SetTensorData(const Tensor &dataset_points) {
     return true;
 };
 
+bool NanoFlannIndex::SetTensorData(const Tensor &dataset_points,
+                                   const Tensor &points_row_splits) {
+    AssertTensorDtypes(dataset_points, {Float32, Float64});
+    AssertTensorDevice(dataset_points, Device("CPU:0"));
+    AssertTensorDevice(points_row_splits, Device("CPU:0"));
+    AssertTensorDtype(points_row_splits, Int64);
+
+    if (dataset_points.NumDims() != 2) {
+        utility::LogError(
+                "dataset_points must be 2D matrix, with shape "
+                "{n_dataset_points, d}.");
+    }
+    if (points_row_splits.NumDims() != 1 ||
+        points_row_splits.GetShape(0) < 2) {
+        utility::LogError(
+                "points_row_splits must be 1D, with shape {batch_size + 1,}.");
+    }
+    if (dataset_points.GetShape(0) != points_row_splits[-1].Item<int64_t>()) {
+        utility::LogError(
+                "dataset_points and points_row_splits have incompatible "
+                "shapes.");
+    }
+
+    dataset_points_ = dataset_points.Contiguous();
+    points_row_splits_ = points_row_splits.Contiguous();
+    holder_.reset();
+    const int64_t batch_size = points_row_splits_.GetShape(0) - 1;
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(GetDtype(), [&]() {
+        batch_holders_ = impl::BuildKdTreeBatch<scalar_t>(
+                batch_size, points_row_splits_.GetDataPtr<int64_t>(),
+                dataset_points_.GetDataPtr<scalar_t>(),
+                dataset_points_.GetShape(1), /* metric */ L2);
+    });
+    return true;
+};
+
 std::pair<Tensor, Tensor> NanoFlannIndex::SearchKnn(const Tensor &query_points,
                                                     int knn) const {
     const Dtype dtype = GetDtype();
@@ -76,6 +114,11 @@ std::pair<Tensor, Tensor> NanoFlannIndex::SearchKnn(const Tensor &query_points,
     core::AssertTensorDtype(query_points, dtype);
     core::AssertTensorShape(query_points, {utility::nullopt, GetDimension()});
 
+    if (!batch_holders_.empty()) {
+        utility::LogError(
+                "The index is built with points_row_splits. Please use "
+                "SearchKnn with queries_row_splits.");
+    }
     if (knn <= 0) {
         utility::LogError("knn should be larger than 0.");
     }
@@ -107,6 +150,71 @@ std::pair<Tensor, Tensor> NanoFlannIndex::SearchKnn(const Tensor &query_points,
     return std::make_pair(indices, distances);
 };
 
+std::tuple<Tensor, Tensor, Tensor> NanoFlannIndex::SearchKnn(
+        const Tensor &query_points,
+        const Tensor &queries_row_splits,
+        int knn) const {
+    const Dtype dtype = GetDtype();
+    const Device device = GetDevice();
+
+    AssertTensorDevice(query_points, device);
+    AssertTensorDtype(query_points, dtype);
+    AssertTensorShape(query_points, {utility::nullopt, GetDimension()});
+    AssertTensorDevice(queries_row_splits, Device("CPU:0"));
+    AssertTensorDtype(queries_row_splits, Int64);
+
+    if (knn <= 0) {
+        utility::LogError("knn should be larger than 0.");
+    }
+    if (query_points.GetShape(0) != queries_row_splits[-1].Item<int64_t>()) {
+        utility::LogError(
+                "query_points and queries_row_splits have incompatible "
+                "shapes.");
+    }
+
+    // An index built from a single point cloud is a batch of size 1.
+    std::vector<NanoFlannIndexHolderBase *> holders;
+    Tensor points_row_splits;
+    if (batch_holders_.empty()) {
+        holders.push_back(holder_.get());
+        points_row_splits =
+                Tensor::Init<int64_t>({0, dataset_points_.GetShape(0)});
+    } else {
+        for (const auto &holder : batch_holders_) {
+            holders.push_back(holder.get());
+        }
+        points_row_splits = points_row_splits_;
+    }
+    const int64_t batch_size = static_cast<int64_t>(holders.size());
+    if (queries_row_splits.GetShape(0) != batch_size + 1) {
+        utility::LogError(
+                "queries_row_splits must have shape {{{},}}, but got {}.",
+                batch_size + 1, queries_row_splits.GetShape().ToString());
+    }
+
+    const int64_t num_query_points = query_points.GetShape(0);
+    Tensor indices, distances;
+    Tensor neighbors_row_splits = Tensor({num_query_points + 1}, Int64);
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        const Tensor query_contiguous = query_points.Contiguous();
+        const Tensor queries_row_splits_contiguous =
+                queries_row_splits.Contiguous();
+        NeighborSearchAllocator<scalar_t> output_allocator(device);
+
+        impl::KnnSearchBatchCPU(
+                holders.data(), batch_size,
+                points_row_splits.GetDataPtr<int64_t>(),
+                queries_row_splits_contiguous.GetDataPtr<int64_t>(),
+                neighbors_row_splits.GetDataPtr<int64_t>(),
+                query_contiguous.GetDataPtr<scalar_t>(),
+                query_contiguous.GetShape(1), knn, /* metric */ L2,
+                /* return_distances */ true, output_allocator);
+        indices = output_allocator.NeighborsIndex();
+        distances = output_allocator.NeighborsDistance();
+    });
+    return std::make_tuple(indices, distances, neighbors_row_splits);
+}
+
 std::tuple<Tensor, Tensor, Tensor> NanoFlannIndex::SearchRadius(
         const Tensor &query_points, const Tensor &radii, bool sort) const {
     const Dtype dtype = GetDtype();
@@ -121,6 +229,11 @@ std::tuple<Tensor, Tensor, Tensor> NanoFlannIndex::SearchRadius(
     int64_t num_query_points = query_points.GetShape(0);
     AssertTensorShape(query_points, {utility::nullopt, GetDimension()});
     AssertTensorShape(radii, {num_query_points});
+    if (!batch_holders_.empty()) {
+        utility::LogError(
+                "The index is built with points_row_splits. Please use "
+                "SearchKnn with queries_row_splits.");
+    }
 
     // Check if the radii has negative values.
     Tensor below_zero = radii.Le(0);
@@ -172,6 +285,11 @@ std::tuple<Tensor, Tensor, Tensor> NanoFlannIndex::SearchHybrid(
     AssertTensorDtype(query_points, dtype);
     AssertTensorShape(query_points, {utility::nullopt, GetDimension()});
 
+    if (!batch_holders_.empty()) {
+        utility::LogError(
+                "The index is built with points_row_splits. Please use "
+                "SearchKnn with queries_row_splits.");
+    }
     if (max_knn <= 0) {
         utility::LogError("max_knn should be larger than 0.");
     }
@@ -57,6 +57,16 @@ public:
 public:
     bool SetTensorData(const Tensor &dataset_points) override;
 
+    /// Set the data for a batch of point clouds. One KDTree is built per
+    /// batch item and the trees are built in parallel.
+    ///
+    /// \param dataset_points Points of all batch items. Must be 2D, with
+    /// shape {n, d}.
+    /// \param points_row_splits Defines the start and end of the points of
+    /// each batch item. Must be 1D, with shape {batch_size + 1,}, dtype Int64.
+    bool SetTensorData(const Tensor &dataset_points,
+                       const Tensor &points_row_splits);
+
     bool SetTensorData(const Tensor &dataset_points, double radius) override {
         utility::LogError(
                 "NanoFlannIndex::SetTensorData with radius not implemented.");
@@ -73,6 +83,27 @@ public:
     std::pair<Tensor, Tensor> SearchKnn(const Tensor &query_points,
                                         int knn) const override;
 
+    /// Perform batched K nearest neighbor search. The queries of each batch
+    /// item are searched only in the points of the same batch item. All
+    /// queries are processed in a single parallel pass.
+    ///
+    /// \param query_points Query points of all batch items. Must be 2D, with
+    /// shape {n, d}, same dtype with dataset_points.
+    /// \param queries_row_splits Defines the start and end of the queries of
+    /// each batch item. Must be 1D, with shape {batch_size + 1,}, dtype Int64.
+    /// \param knn Number of nearest neighbor to search. Queries of batch item
+    /// b get min(knn, num_points_b) neighbors.
+    /// \return Tuple of Tensors: (indices, distances, neighbors_row_splits):
+    /// - indices: Tensor of shape {total_num_neighbors,}, dtype Int32. The
+    /// indices are relative to the start of the points of the batch item.
+    /// - distances: Tensor of shape {total_num_neighbors,}, same dtype with
+    /// dataset_points.
+    /// - neighbors_row_splits: Tensor of shape {n + 1,}, dtype Int64.
+    std::tuple<Tensor, Tensor, Tensor> SearchKnn(
+            const Tensor &query_points,
+            const Tensor &queries_row_splits,
+            int knn) const;
+
     /// Perform radius search with multiple radii.
     ///
     /// \param query_points Query points. Must be 2D, with shape {n, d}, same
@@ -121,6 +152,10 @@ public:
 protected:
     // Tensor dataset_points_;
     std::unique_ptr<NanoFlannIndexHolderBase> holder_;
+
+    /// Per batch item KDTrees, set when the index is built with row splits.
+    std::vector<std::unique_ptr<NanoFlannIndexHolderBase>> batch_holders_;
+    Tensor points_row_splits_;
 };
 }  // namespace nns
 }  // namespace core
@@ -71,6 +71,8 @@ bool NearestNeighborSearch::FixedRadiusIndex(utility::optional<double> radius) {
                 "-DBUILD_CUDA_MODULE=ON.");
 #endif
 
+    } else if (radius.has_value()) {
+        return SetFixedRadiusIndexCPU(radius.value());
     } else {
         return SetIndex();
     }
@@ -90,11 +92,40 @@ bool NearestNeighborSearch::HybridIndex(utility::optional<double> radius) {
                 "-DBUILD_CUDA_MODULE=ON.");
 #endif
 
+    } else if (radius.has_value()) {
+        return SetFixedRadiusIndexCPU(radius.value());
     } else {
         return SetIndex();
     }
 };
 
+bool NearestNeighborSearch::SetFixedRadiusIndexCPU(double radius) {
+    // The spatial hash table only supports 3D points.
+    if (dataset_points_.NumDims() != 2 || dataset_points_.GetShape(1) != 3) {
+        return SetIndex();
+    }
+    fixed_radius_index_.reset(new nns::FixedRadiusIndex());
+    fixed_radius_index_radius_ = radius;
+    return fixed_radius_index_->SetTensorData(dataset_points_, radius);
+}
+
+bool NearestNeighborSearch::UseFixedRadiusIndexCPU(double radius) {
+    // The cells of the hash table are sized for the radius it was built for,
+    // and the search derives the cell size from the query radius. Queries
+    // with any other radius fall back to the KDTree.
+    if (fixed_radius_index_ && radius == fixed_radius_index_radius_) {
+        return true;
+    }
+    SetIndexIfMissingCPU();
+    return false;
+}
+
+void NearestNeighborSearch::SetIndexIfMissingCPU() {
+    if (!nanoflann_index_ && fixed_radius_index_) {
+        SetIndex();
+    }
+}
+
 std::pair<Tensor, Tensor> NearestNeighborSearch::KnnSearch(
         const Tensor& query_points, int knn) {
     AssertTensorDevice(query_points, dataset_points_.GetDevice());
@@ -106,6 +137,7 @@ std::pair<Tensor, Tensor> NearestNeighborSearch::KnnSearch(
             utility::LogError("Index is not set.");
         }
     } else {
+        SetIndexIfMissingCPU();
         if (nanoflann_index_) {
             return nanoflann_index_->SearchKnn(query_points, knn);
         } else {
@@ -126,7 +158,10 @@ std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::FixedRadiusSearch(
             utility::LogError("Index is not set.");
         }
     } else {
-        if (nanoflann_index_) {
+        if (UseFixedRadiusIndexCPU(radius)) {
+            return fixed_radius_index_->SearchRadius(query_points, radius,
+                                                     sort);
+        } else if (nanoflann_index_) {
             return nanoflann_index_->SearchRadius(query_points, radius);
         } else {
             utility::LogError("Index is not set.");
@@ -140,6 +175,7 @@ std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::MultiRadiusSearch(
     AssertTensorDtype(query_points, dataset_points_.GetDtype());
     AssertTensorDtype(radii, dataset_points_.GetDtype());
 
+    SetIndexIfMissingCPU();
     if (!nanoflann_index_) {
         utility::LogError("Index is not set.");
     }
@@ -158,7 +194,10 @@ std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::HybridSearch(
             utility::LogError("Index is not set.");
         }
     } else {
-        if (nanoflann_index_) {
+        if (UseFixedRadiusIndexCPU(radius)) {
+            return fixed_radius_index_->SearchHybrid(query_points, radius,
+                                                     max_knn);
+        } else if (nanoflann_index_) {
             return nanoflann_index_->SearchHybrid(query_points, radius,
                                                   max_knn);
         } else {
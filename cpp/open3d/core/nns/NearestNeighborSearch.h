@@ -68,11 +68,18 @@ public:
     /// Set index for fixed-radius search.
     ///
     /// \param radius optional radius parameter. required for gpu fixed radius
-    /// index. \return Returns true if building index success, otherwise false.
+    /// index. On CPU, a spatial hash table is built for 3D points if the
+    /// radius is given, otherwise a KDTree is used. Queries with a different
+    /// radius fall back to a KDTree built on demand.
+    /// \return Returns true if building index success, otherwise false.
     bool FixedRadiusIndex(utility::optional<double> radius = {});
 
     /// Set index for hybrid search.
     ///
+    /// \param radius optional radius parameter. required for gpu hybrid index.
+    /// On CPU, a spatial hash table is built for 3D points if the radius is
+    /// given, otherwise a KDTree is used. Queries with a different radius
+    /// fall back to a KDTree built on demand.
     /// \return Returns true if building index success, otherwise false.
     bool HybridIndex(utility::optional<double> radius = {});
 
@@ -133,6 +140,17 @@ public:
 private:
     bool SetIndex();
 
+    /// Build the spatial hash table for CPU fixed-radius and hybrid search.
+    bool SetFixedRadiusIndexCPU(double radius);
+
+    /// Returns true if the CPU spatial hash table can answer a query with
+    /// \p radius, which is only the case for the radius it was built for.
+    /// Otherwise makes sure that the KDTree fallback is built.
+    bool UseFixedRadiusIndexCPU(double radius);
+
+    /// Builds the KDTree on demand if only the CPU spatial hash table is set.
+    void SetIndexIfMissingCPU();
+
     /// Assert a Tensor is not CUDA tensoer. This will be removed in the future.
     void AssertNotCUDA(const Tensor &t) const;
 
@@ -140,6 +158,8 @@ protected:
     std::unique_ptr<NanoFlannIndex> nanoflann_index_;
     std::unique_ptr<nns::FixedRadiusIndex> fixed_radius_index_;
     std::unique_ptr<nns::KnnIndex> knn_index_;
+    /// Radius the CPU spatial hash table was built for.
+    double fixed_radius_index_radius_ = 0;
     const Tensor dataset_points_;
 };
 }  // namespace nns
@@ -0,0 +1,310 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/KDTreeForest.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <queue>
+#include <random>
+
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+/// Maximum number of points in a leaf.
+constexpr int kLeafSize = 8;
+/// Number of points used to estimate the variance of a node.
+constexpr int kNumVarianceSamples = 100;
+/// The split dimension is drawn among this many highest variance dimensions.
+constexpr int kNumSplitCandidates = 5;
+
+}  // namespace
+
+KDTreeForest::KDTreeForest(int num_trees,
+                           utility::optional<unsigned int> seed)
+    : num_trees_(num_trees), seed_(seed) {}
+
+KDTreeForest::KDTreeForest(const Eigen::MatrixXd &data,
+                           int num_trees,
+                           utility::optional<unsigned int> seed)
+    : num_trees_(num_trees), seed_(seed) {
+    SetMatrixData(data);
+}
+
+KDTreeForest::KDTreeForest(const pipelines::registration::Feature &feature,
+                           int num_trees,
+                           utility::optional<unsigned int> seed)
+    : num_trees_(num_trees), seed_(seed) {
+    SetFeature(feature);
+}
+
+KDTreeForest::~KDTreeForest() {}
+
+bool KDTreeForest::SetMatrixData(const Eigen::MatrixXd &data) {
+    dimension_ = data.rows();
+    dataset_size_ = data.cols();
+    trees_.clear();
+    if (dimension_ == 0 || dataset_size_ == 0) {
+        utility::LogWarning(
+                "[KDTreeForest::SetMatrixData] Failed due to no data.");
+        return false;
+    }
+    if (num_trees_ <= 0) {
+        utility::LogWarning(
+                "[KDTreeForest::SetMatrixData] num_trees must be positive.");
+        return false;
+    }
+    data_.assign(data.data(), data.data() + dataset_size_ * dimension_);
+
+    const unsigned int seed =
+            seed_.has_value() ? seed_.value() : std::random_device{}();
+    trees_.resize(num_trees_);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int t = 0; t < num_trees_; ++t) {
+        BuildTree(trees_[t], seed + t);
+    }
+    return true;
+}
+
+bool KDTreeForest::SetFeature(const pipelines::registration::Feature &feature) {
+    return SetMatrixData(feature.data_);
+}
+
+void KDTreeForest::BuildTree(Tree &tree, unsigned int seed) const {
+    const int dimension = static_cast<int>(dimension_);
+    std::mt19937 generator(seed);
+
+    // Shuffle once so that the leading points of any node are a random
+    // sample of the node.
+    tree.indices_.resize(dataset_size_);
+    std::iota(tree.indices_.begin(), tree.indices_.end(), 0);
+    std::shuffle(tree.indices_.begin(), tree.indices_.end(), generator);
+    tree.nodes_.assign(1, Node());
+
+    struct Range {
+        int node_;
+        int begin_;
+        int end_;
+    };
+    std::vector<Range> stack{{0, 0, static_cast<int>(dataset_size_)}};
+    std::vector<double> mean(dimension), variance(dimension);
+    std::vector<int> dims(dimension);
+    const int num_candidates = std::min(kNumSplitCandidates, dimension);
+    while (!stack.empty()) {
+        const Range range = stack.back();
+        stack.pop_back();
+        const int count = range.end_ - range.begin_;
+        if (count <= kLeafSize) {
+            tree.nodes_[range.node_].child_[0] = range.begin_;
+            tree.nodes_[range.node_].child_[1] = range.end_;
+            continue;
+        }
+
+        const int num_samples = std::min(count, kNumVarianceSamples);
+        std::fill(mean.begin(), mean.end(), 0.0);
+        std::fill(variance.begin(), variance.end(), 0.0);
+        for (int s = 0; s < num_samples; ++s) {
+            const double *p =
+                    &data_[tree.indices_[range.begin_ + s] * dimension_];
+            for (int d = 0; d < dimension; ++d) mean[d] += p[d];
+        }
+        for (int d = 0; d < dimension; ++d) mean[d] /= num_samples;
+        for (int s = 0; s < num_samples; ++s) {
+            const double *p =
+                    &data_[tree.indices_[range.begin_ + s] * dimension_];
+            for (int d = 0; d < dimension; ++d) {
+                variance[d] += (p[d] - mean[d]) * (p[d] - mean[d]);
+            }
+        }
+        std::iota(dims.begin(), dims.end(), 0);
+        std::partial_sort(dims.begin(), dims.begin() + num_candidates,
+                          dims.end(), [&](int a, int b) {
+                              return variance[a] > variance[b];
+                          });
+        const int split_dim = dims[generator() % num_candidates];
+        double split_value = mean[split_dim];
+
+        auto value = [&](int idx) {
+            return data_[idx * dimension_ + split_dim];
+        };
+        auto begin = tree.indices_.begin() + range.begin_;
+        auto end = tree.indices_.begin() + range.end_;
+        int num_left = static_cast<int>(
+                std::partition(begin, end,
+                               [&](int idx) {
+                                   return value(idx) < split_value;
+                               }) -
+                begin);
+        if (num_left == 0 || num_left == count) {
+            // The sampled mean does not separate the node, split at the
+            // median instead.
+            num_left = count / 2;
+            std::nth_element(begin, begin + num_left, end, [&](int a, int b) {
+                return value(a) < value(b);
+            });
+            split_value = value(*(begin + num_left));
+        }
+
+        const int left = static_cast<int>(tree.nodes_.size());
+        tree.nodes_.resize(left + 2);
+        Node &node = tree.nodes_[range.node_];
+        node.split_dim_ = split_dim;
+        node.split_value_ = split_value;
+        node.child_[0] = left;
+        node.child_[1] = left + 1;
+        stack.push_back({left, range.begin_, range.begin_ + num_left});
+        stack.push_back({left + 1, range.begin_ + num_left, range.end_});
+    }
+}
+
+template <typename T>
+int KDTreeForest::SearchKNN(const T &query,
+                            int knn,
+                            int max_checks,
+                            std::vector<int> &indices,
+                            std::vector<double> &distance2) const {
+    if (data_.empty() || dataset_size_ <= 0 ||
+        size_t(query.rows()) != dimension_ || knn < 0) {
+        return -1;
+    }
+    indices.clear();
+    distance2.clear();
+    if (knn == 0) {
+        return 0;
+    }
+    if (max_checks <= 0) {
+        max_checks = std::numeric_limits<int>::max();
+    }
+
+    const double *q = query.data();
+    // Max-heap of the best (distance2, index) pairs found so far.
+    std::vector<std::pair<double, int>> result;
+    result.reserve(knn + 1);
+    auto worst = [&]() {
+        return int(result.size()) < knn
+                       ? std::numeric_limits<double>::infinity()
+                       : result.front().first;
+    };
+
+    struct Branch {
+        double min_distance2_;
+        int tree_;
+        int node_;
+        bool operator<(const Branch &other) const {
+            return min_distance2_ > other.min_distance2_;
+        }
+    };
+    std::priority_queue<Branch> branches;
+    int num_checks = 0;
+
+    auto check_leaf = [&](const Tree &tree, const Node &node) {
+        for (int i = node.child_[0]; i < node.child_[1]; ++i) {
+            const int idx = tree.indices_[i];
+            const double *p = &data_[idx * dimension_];
+            const double bound = worst();
+            double dist = 0.0;
+            for (size_t d = 0; d < dimension_ && dist < bound; ++d) {
+                dist += (q[d] - p[d]) * (q[d] - p[d]);
+            }
+            ++num_checks;
+            if (dist >= bound) continue;
+            // A point may be reached through several trees.
+            if (std::any_of(result.begin(), result.end(),
+                            [idx](const std::pair<double, int> &r) {
+                                return r.second == idx;
+                            })) {
+                continue;
+            }
+            result.emplace_back(dist, idx);
+            std::push_heap(result.begin(), result.end());
+            if (int(result.size()) > knn) {
+                std::pop_heap(result.begin(), result.end());
+                result.pop_back();
+            }
+        }
+    };
+
+    auto descend = [&](int t, int node_idx, double min_distance2) {
+        const Tree &tree = trees_[t];
+        while (true) {
+            const Node &node = tree.nodes_[node_idx];
+            if (node.split_dim_ < 0) {
+                check_leaf(tree, node);
+                return;
+            }
+            const double diff = q[node.split_dim_] - node.split_value_;
+            const int best = diff < 0 ? 0 : 1;
+            const double other_distance2 = min_distance2 + diff * diff;
+            if (other_distance2 < worst()) {
+                branches.push({other_distance2, t, node.child_[1 - best]});
+            }
+            node_idx = node.child_[best];
+        }
+    };
+
+    for (int t = 0; t < int(trees_.size()); ++t) {
+        descend(t, 0, 0.0);
+    }
+    while (!branches.empty() && num_checks < max_checks) {
+        const Branch branch = branches.top();
+        branches.pop();
+        if (branch.min_distance2_ >= worst()) break;
+        descend(branch.tree_, branch.node_, branch.min_distance2_);
+    }
+
+    std::sort_heap(result.begin(), result.end());
+    const int k = static_cast<int>(result.size());
+    indices.resize(k);
+    distance2.resize(k);
+    for (int i = 0; i < k; ++i) {
+        distance2[i] = result[i].first;
+        indices[i] = result[i].second;
+    }
+    return k;
+}
+
+template int KDTreeForest::SearchKNN<Eigen::Vector3d>(
+        const Eigen::Vector3d &query,
+        int knn,
+        int max_checks,
+        std::vector<int> &indices,
+        std::vector<double> &distance2) const;
+template int KDTreeForest::SearchKNN<Eigen::VectorXd>(
+        const Eigen::VectorXd &query,
+        int knn,
+        int max_checks,
+        std::vector<int> &indices,
+        std::vector<double> &distance2) const;
+
+}  // namespace geometry
+}  // namespace open3d
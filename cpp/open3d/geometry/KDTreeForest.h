@@ -0,0 +1,130 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <memory>
+#include <vector>
+
+#include "open3d/pipelines/registration/Feature.h"
+#include "open3d/utility/Optional.h"
+
+namespace open3d {
+namespace geometry {
+
+/// \class KDTreeForest
+///
+/// \brief Randomized KD-tree forest for approximate nearest neighbor search in
+/// high dimensional spaces, e.g. for matching FPFH features.
+///
+/// Each tree splits on a dimension drawn at random among the dimensions with
+/// the highest variance. A query descends all trees and then explores the
+/// closest unexplored branches of the whole forest until a budget of
+/// distance computations is spent, trading recall for speed.
+class KDTreeForest {
+public:
+    /// \brief Default Constructor.
+    ///
+    /// \param num_trees Number of randomized trees.
+    /// \param seed Random seed used to build the trees.
+    KDTreeForest(int num_trees = 4,
+                 utility::optional<unsigned int> seed = utility::nullopt);
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param data Provides set of data points for the forest construction.
+    /// \param num_trees Number of randomized trees.
+    /// \param seed Random seed used to build the trees.
+    KDTreeForest(const Eigen::MatrixXd &data,
+                 int num_trees = 4,
+                 utility::optional<unsigned int> seed = utility::nullopt);
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param feature Provides a set of features from which the forest is
+    /// constructed.
+    /// \param num_trees Number of randomized trees.
+    /// \param seed Random seed used to build the trees.
+    KDTreeForest(const pipelines::registration::Feature &feature,
+                 int num_trees = 4,
+                 utility::optional<unsigned int> seed = utility::nullopt);
+    ~KDTreeForest();
+    KDTreeForest(const KDTreeForest &) = delete;
+    KDTreeForest &operator=(const KDTreeForest &) = delete;
+
+public:
+    /// Sets the data for the forest from a matrix.
+    ///
+    /// \param data Data points for the forest construction.
+    bool SetMatrixData(const Eigen::MatrixXd &data);
+    /// Sets the data for the forest from the feature data.
+    ///
+    /// \param feature Set of features for the forest construction.
+    bool SetFeature(const pipelines::registration::Feature &feature);
+
+    /// Approximate KNN search.
+    ///
+    /// \param query Query point.
+    /// \param knn Number of neighbors to search.
+    /// \param max_checks Maximum number of distance computations. Larger
+    /// values increase recall and search time.
+    /// \param indices Output indices of the neighbors, sorted by distance.
+    /// \param distance2 Output squared distances of the neighbors.
+    /// \return Number of neighbors found, or -1 on invalid input.
+    template <typename T>
+    int SearchKNN(const T &query,
+                  int knn,
+                  int max_checks,
+                  std::vector<int> &indices,
+                  std::vector<double> &distance2) const;
+
+protected:
+    struct Node {
+        /// Split dimension, -1 for leaf nodes.
+        int split_dim_ = -1;
+        double split_value_ = 0.0;
+        /// Children for inner nodes, [begin, end) into tree indices for
+        /// leaves.
+        int child_[2] = {-1, -1};
+    };
+
+    struct Tree {
+        std::vector<Node> nodes_;
+        std::vector<int> indices_;
+    };
+
+    void BuildTree(Tree &tree, unsigned int seed) const;
+
+protected:
+    int num_trees_;
+    utility::optional<unsigned int> seed_;
+    std::vector<double> data_;
+    std::vector<Tree> trees_;
+    size_t dimension_ = 0;
+    size_t dataset_size_ = 0;
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -28,6 +28,7 @@
 
 #include <Eigen/Dense>
 #include <algorithm>
+#include <limits>
 #include <numeric>
 #include <random>
 
@@ -496,17 +497,44 @@ std::shared_ptr<PointCloud> PointCloud::FarthestPointDownSample(
     const size_t num_points = points_.size();
     std::vector<double> distances(num_points,
                                   std::numeric_limits<double>::infinity());
+
+    // Each iteration updates the distances and finds the farthest point in
+    // one pass, split into one chunk of points per thread. The chunk maxima
+    // are reduced in order, so ties resolve to the lowest index as in a
+    // serial scan.
+    const size_t kMinChunkSize = 4096;
+    const int num_chunks = static_cast<int>(std::max<size_t>(
+            1, std::min<size_t>(utility::EstimateMaxThreads(),
+                                num_points / kMinChunkSize)));
+    std::vector<double> chunk_max_dists(num_chunks);
+    std::vector<size_t> chunk_max_indices(num_chunks);
+
     size_t farthest_index = 0;
     for (size_t i = 0; i < num_samples; i++) {
         selected_indices.push_back(farthest_index);
-        const Eigen::Vector3d &selected = points_[farthest_index];
+        const Eigen::Vector3d selected = points_[farthest_index];
+#pragma omp parallel for schedule(static) num_threads(num_chunks)
+        for (int chunk = 0; chunk < num_chunks; chunk++) {
+            const size_t begin = num_points * chunk / num_chunks;
+            const size_t end = num_points * (chunk + 1) / num_chunks;
+            double max_dist = 0;
+            size_t max_index = farthest_index;
+            for (size_t j = begin; j < end; j++) {
+                double dist = (points_[j] - selected).squaredNorm();
+                distances[j] = std::min(distances[j], dist);
+                if (distances[j] > max_dist) {
+                    max_dist = distances[j];
+                    max_index = j;
+                }
+            }
+            chunk_max_dists[chunk] = max_dist;
+            chunk_max_indices[chunk] = max_index;
+        }
         double max_dist = 0;
-        for (size_t j = 0; j < num_points; j++) {
-            double dist = (points_[j] - selected).squaredNorm();
-            distances[j] = std::min(distances[j], dist);
-            if (distances[j] > max_dist) {
-                max_dist = distances[j];
-                farthest_index = j;
+        for (int chunk = 0; chunk < num_chunks; chunk++) {
+            if (chunk_max_dists[chunk] > max_dist) {
+                max_dist = chunk_max_dists[chunk];
+                farthest_index = chunk_max_indices[chunk];
             }
         }
     }
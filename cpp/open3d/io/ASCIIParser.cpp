@@ -0,0 +1,301 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/ASCIIParser.h"
+
+#include <algorithm>
+#include <clocale>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace io {
+
+namespace {
+
+/// Chunks smaller than this are not worth a thread.
+constexpr size_t kMinChunkSize = 1 << 20;
+
+/// Progress is reported after every block of this many parsed bytes.
+constexpr int64_t kProgressBlockSize = 1 << 16;
+
+/// Powers of ten that are exactly representable as double.
+constexpr double kExactPow10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,
+                                  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                  1e12, 1e13, 1e14, 1e15, 1e16, 1e17,
+                                  1e18, 1e19, 1e20, 1e21, 1e22};
+
+inline bool IsBlank(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+inline bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+
+/// Case-insensitive match of a lower case word, advances \p p on success.
+bool MatchWord(const char *&p, const char *last, const char *word) {
+    const char *q = p;
+    for (; *word; ++word, ++q) {
+        if (q == last || (*q | 0x20) != *word) {
+            return false;
+        }
+    }
+    p = q;
+    return true;
+}
+
+/// Fallback for numbers that cannot be converted exactly with a single
+/// floating point operation. strtod honors the decimal point of the current
+/// locale, so the token is adapted to it.
+double ParseDoubleSlow(const char *first, const char *last) {
+    char buffer[64];
+    std::string long_token;
+    char *token = buffer;
+    const size_t length = last - first;
+    if (length >= sizeof(buffer)) {
+        long_token.resize(length + 1);
+        token = &long_token[0];
+    }
+    std::copy(first, last, token);
+    token[length] = '\0';
+    const char decimal_point = *std::localeconv()->decimal_point;
+    if (decimal_point != '.') {
+        std::replace(token, token + length, '.', decimal_point);
+    }
+    return std::strtod(token, nullptr);
+}
+
+}  // namespace
+
+const char *ParseDouble(const char *first, const char *last, double &value) {
+    const char *p = first;
+    while (p < last && IsBlank(*p)) {
+        ++p;
+    }
+    const char *start = p;
+    bool negative = false;
+    if (p < last && (*p == '+' || *p == '-')) {
+        negative = *p == '-';
+        ++p;
+    }
+
+    if (p < last && !IsDigit(*p) && *p != '.') {
+        if (MatchWord(p, last, "nan")) {
+            value = negative ? -std::numeric_limits<double>::quiet_NaN()
+                             : std::numeric_limits<double>::quiet_NaN();
+            return p;
+        }
+        if (MatchWord(p, last, "inf")) {
+            MatchWord(p, last, "inity");
+            value = negative ? -std::numeric_limits<double>::infinity()
+                             : std::numeric_limits<double>::infinity();
+            return p;
+        }
+        return nullptr;
+    }
+
+    // Accumulate up to 19 significant digits, which always fit in 64 bits.
+    uint64_t mantissa = 0;
+    int num_digits = 0;
+    int exponent = 0;
+    bool has_digits = false;
+    bool truncated = false;
+    for (; p < last && IsDigit(*p); ++p) {
+        has_digits = true;
+        if (num_digits < 19) {
+            mantissa = mantissa * 10 + (*p - '0');
+            num_digits += mantissa > 0;
+        } else {
+            ++exponent;
+            truncated |= *p != '0';
+        }
+    }
+    if (p < last && *p == '.') {
+        for (++p; p < last && IsDigit(*p); ++p) {
+            has_digits = true;
+            if (num_digits < 19) {
+                mantissa = mantissa * 10 + (*p - '0');
+                num_digits += mantissa > 0;
+                --exponent;
+            } else {
+                truncated |= *p != '0';
+            }
+        }
+    }
+    if (!has_digits) {
+        return nullptr;
+    }
+
+    if (p < last && (*p == 'e' || *p == 'E')) {
+        const char *q = p + 1;
+        bool negative_exponent = false;
+        if (q < last && (*q == '+' || *q == '-')) {
+            negative_exponent = *q == '-';
+            ++q;
+        }
+        // As with strtod, a dangling exponent marker is not consumed.
+        if (q < last && IsDigit(*q)) {
+            int exponent_value = 0;
+            for (; q < last && IsDigit(*q); ++q) {
+                if (exponent_value < 100000) {
+                    exponent_value = exponent_value * 10 + (*q - '0');
+                }
+            }
+            exponent += negative_exponent ? -exponent_value : exponent_value;
+            p = q;
+        }
+    }
+
+    if (mantissa == 0 && !truncated) {
+        value = negative ? -0.0 : 0.0;
+        return p;
+    }
+    // Fixed-point output such as "%.10f" pads with zeros that need not be
+    // part of the mantissa.
+    if (!truncated) {
+        while (mantissa > (uint64_t(1) << 53) && mantissa % 10 == 0) {
+            mantissa /= 10;
+            ++exponent;
+        }
+    }
+    // Both the mantissa and the power of ten are exact, so a single
+    // multiplication or division is correctly rounded.
+    if (!truncated && mantissa <= (uint64_t(1) << 53) && exponent >= -22 &&
+        exponent <= 22) {
+        const double v = static_cast<double>(mantissa);
+        value = exponent < 0 ? v / kExactPow10[-exponent]
+                             : v * kExactPow10[exponent];
+        if (negative) value = -value;
+        return p;
+    }
+    value = ParseDoubleSlow(start, p);
+    return p;
+}
+
+int64_t ParseASCIIRows(const char *data,
+                       size_t size,
+                       int num_columns,
+                       const std::function<double *(int64_t)> &allocate,
+                       const std::function<void(int64_t)> &progress) {
+    if (num_columns <= 0) {
+        utility::LogError("num_columns must be positive, but got {}.",
+                          num_columns);
+    }
+    const char *const last = data + size;
+
+    // Split the text into chunks that start at the beginning of a line.
+    const int64_t num_chunks = std::max<int64_t>(
+            1, std::min<int64_t>(4 * utility::EstimateMaxThreads(),
+                                 size / kMinChunkSize));
+    std::vector<const char *> bounds(num_chunks + 1, last);
+    bounds[0] = data;
+    for (int64_t k = 1; k < num_chunks; ++k) {
+        const char *begin =
+                std::max(data + size / num_chunks * k, bounds[k - 1]);
+        const void *newline = std::memchr(begin, '\n', last - begin);
+        bounds[k] = newline ? static_cast<const char *>(newline) + 1 : last;
+    }
+
+    // Every line yields at most one row, so the line counts bound the output
+    // offsets of the chunks.
+    std::vector<int64_t> offsets(num_chunks + 1, 0);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t k = 0; k < num_chunks; ++k) {
+        const char *begin = bounds[k];
+        const char *end = bounds[k + 1];
+        int64_t num_lines = std::count(begin, end, '\n');
+        if (end > begin && end[-1] != '\n') {
+            ++num_lines;
+        }
+        offsets[k + 1] = num_lines;
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    double *rows = allocate(offsets.back());
+
+    std::vector<int64_t> num_rows(num_chunks, 0);
+    int64_t num_parsed_bytes = 0;
+    auto report_progress = [&](int64_t num_bytes) {
+#pragma omp critical(ParseASCIIRowsProgress)
+        {
+            num_parsed_bytes += num_bytes;
+            progress(num_parsed_bytes);
+        }
+    };
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t k = 0; k < num_chunks; ++k) {
+        double *row = rows + offsets[k] * num_columns;
+        const char *end = bounds[k + 1];
+        const char *reported = bounds[k];
+        int64_t count = 0;
+        for (const char *p = bounds[k]; p < end;) {
+            const void *newline = std::memchr(p, '\n', end - p);
+            const char *eol =
+                    newline ? static_cast<const char *>(newline) : end;
+            int c = 0;
+            for (const char *q = p; c < num_columns; ++c) {
+                q = ParseDouble(q, eol, row[c]);
+                if (!q) break;
+            }
+            if (c == num_columns) {
+                row += num_columns;
+                ++count;
+            }
+            p = eol + 1;
+            if (progress && p - reported >= kProgressBlockSize) {
+                const char *parsed = std::min(p, end);
+                report_progress(parsed - reported);
+                reported = parsed;
+            }
+        }
+        num_rows[k] = count;
+        if (progress && end > reported) {
+            report_progress(end - reported);
+        }
+    }
+
+    // Close the gaps left by skipped lines.
+    int64_t num_parsed = 0;
+    for (int64_t k = 0; k < num_chunks; ++k) {
+        if (num_parsed != offsets[k] && num_rows[k] > 0) {
+            std::memmove(rows + num_parsed * num_columns,
+                         rows + offsets[k] * num_columns,
+                         num_rows[k] * num_columns * sizeof(double));
+        }
+        num_parsed += num_rows[k];
+    }
+    return num_parsed;
+}
+
+}  // namespace io
+}  // namespace open3d
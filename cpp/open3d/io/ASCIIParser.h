@@ -0,0 +1,74 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace open3d {
+namespace io {
+
+/// \brief Parses a decimal floating point number, independently of the
+/// current locale.
+///
+/// Leading spaces, tabs and carriage returns are skipped. The accepted syntax
+/// is the one of strtod for decimal numbers, including "nan" and "inf".
+///
+/// \param first Start of the text.
+/// \param last End of the text, exclusive.
+/// \param value The parsed number.
+/// \return Pointer past the last consumed character, or nullptr if no number
+/// could be parsed.
+const char *ParseDouble(const char *first, const char *last, double &value);
+
+/// \brief Parses lines of whitespace separated numbers in parallel.
+///
+/// The text is split into newline aligned chunks that are parsed
+/// concurrently. Every line provides the first \p num_columns numbers of a
+/// row. As with sscanf, lines holding fewer numbers are skipped and trailing
+/// numbers are ignored.
+///
+/// \param data Start of the text, e.g. a memory-mapped file.
+/// \param size Size of the text in bytes.
+/// \param num_columns Number of values per row.
+/// \param allocate Called once with an upper bound of the number of rows. It
+/// returns a row-major buffer of at least that many rows, which is filled in
+/// place. The buffer may be nullptr if the bound is 0.
+/// \param progress If set, called repeatedly while parsing with the number of
+/// bytes parsed so far, up to \p size. The calls are serialized, but may come
+/// from any thread.
+/// \return Number of parsed rows, stored contiguously at the beginning of the
+/// buffer.
+int64_t ParseASCIIRows(const char *data,
+                       size_t size,
+                       int num_columns,
+                       const std::function<double *(int64_t)> &allocate,
+                       const std::function<void(int64_t)> &progress = nullptr);
+
+}  // namespace io
+}  // namespace open3d
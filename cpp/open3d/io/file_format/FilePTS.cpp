@@ -24,13 +24,17 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <cstdio>
+#include <cstdlib>
 
+#include "open3d/io/ASCIIParser.h"
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/io/PointCloudIO.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 #include "open3d/utility/ProgressReporters.h"
 
 namespace open3d {
@@ -44,94 +48,75 @@ bool ReadPointCloudFromPTS(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            const ReadPointCloudOption &params) {
     try {
-        utility::filesystem::CFile file;
-        if (!file.Open(filename, "r")) {
+        utility::filesystem::MappedFile file;
+        if (!file.Open(filename)) {
             utility::LogWarning("Read PTS failed: unable to open file: {}",
                                 filename);
             return false;
         }
-        size_t num_of_pts = 0;
-        size_t num_of_fields = 0;
-        const char *line_buffer;
-        if ((line_buffer = file.ReadLine())) {
-            sscanf(line_buffer, "%zu", &num_of_pts);
-        }
+        const char *data = file.GetData();
+        const char *data_end = data + file.GetSize();
+        const char *header_end = std::find(data, data_end, '\n');
+        const int64_t num_of_pts =
+                std::strtoll(std::string(data, header_end).c_str(), nullptr,
+                             10);
         if (num_of_pts <= 0) {
             utility::LogWarning("Read PTS failed: unable to read header.");
             return false;
         }
-        utility::CountingProgressReporter reporter(params.update_progress);
-        reporter.SetTotal(num_of_pts);
-
         pointcloud.Clear();
 
-        // Store data start position.
-        int64_t start_pos = ftell(file.GetFILE());
-
-        if ((line_buffer = file.ReadLine())) {
-            num_of_fields = utility::SplitString(line_buffer, " ").size();
-
-            if (num_of_fields == 7 || num_of_fields == 4) {
-                utility::LogWarning(
-                        "Read PTS: only points and colors attributes are "
-                        "supported.");
-            }
-
-            // X Y Z I R G B or X Y Z R G B.
-            if (num_of_fields == 7 || num_of_fields == 6) {
-                pointcloud.points_.resize(num_of_pts);
-                pointcloud.colors_.resize(num_of_pts);
-            }
-            // X Y Z I or X Y Z.
-            else if (num_of_fields == 4 || num_of_fields == 3) {
-                pointcloud.points_.resize(num_of_pts);
-            } else {
-                utility::LogWarning("Read PTS failed: unknown pts format: {}",
-                                    line_buffer);
-                return false;
-            }
+        // The first point determines the fields of all points.
+        const char *data_start = std::min(header_end + 1, data_end);
+        utility::CountingProgressReporter reporter(params.update_progress);
+        reporter.SetTotal(data_end - data_start);
+        const std::string first_line(data_start,
+                                     std::find(data_start, data_end, '\n'));
+        const size_t num_of_fields =
+                utility::SplitString(first_line, " ").size();
+        if (num_of_fields == 7 || num_of_fields == 4) {
+            utility::LogWarning(
+                    "Read PTS: only points and colors attributes are "
+                    "supported.");
+        }
+        // X Y Z I R G B, X Y Z R G B, X Y Z I or X Y Z.
+        if (num_of_fields < 3 || num_of_fields > 7 || num_of_fields == 5) {
+            utility::LogWarning("Read PTS failed: unknown pts format: {}",
+                                first_line);
+            return false;
         }
 
-        // Go to data start position.
-        fseek(file.GetFILE(), start_pos, 0);
-
-        size_t idx = 0;
-        while (idx < num_of_pts && (line_buffer = file.ReadLine())) {
-            double x, y, z, i;
-            int r, g, b;
-            // X Y Z I R G B
-            if (num_of_fields == 7 &&
-                sscanf(line_buffer, "%lf %lf %lf %lf %d %d %d", &x, &y, &z, &i,
-                       &r, &g, &b) == 7) {
-                pointcloud.points_[idx] = Eigen::Vector3d(x, y, z);
-                pointcloud.colors_[idx] = utility::ColorToDouble(r, g, b);
-            }
-            // X Y Z R G B
-            else if (num_of_fields == 6 &&
-                     sscanf(line_buffer, "%lf %lf %lf %d %d %d", &x, &y, &z, &r,
-                            &g, &b) == 6) {
-                pointcloud.points_[idx] = Eigen::Vector3d(x, y, z);
-                pointcloud.colors_[idx] = utility::ColorToDouble(r, g, b);
-            }
-            // X Y Z I
-            else if (num_of_fields == 4 &&
-                     sscanf(line_buffer, "%lf %lf %lf %lf", &x, &y, &z, &i) ==
-                             4) {
-                pointcloud.points_[idx] = Eigen::Vector3d(x, y, z);
-            }
-            // X Y Z
-            else if (num_of_fields == 3 &&
-                     sscanf(line_buffer, "%lf %lf %lf", &x, &y, &z) == 3) {
-                pointcloud.points_[idx] = Eigen::Vector3d(x, y, z);
-            } else {
-                utility::LogWarning("Read PTS failed at line: {}. ",
-                                    line_buffer);
-                return false;
-            }
+        std::vector<double> values;
+        const int64_t num_rows = ParseASCIIRows(
+                data_start, data_end - data_start, int(num_of_fields),
+                [&](int64_t max_rows) {
+                    values.resize(max_rows * num_of_fields);
+                    return values.data();
+                },
+                [&](int64_t num_bytes) { reporter.Update(num_bytes); });
+        if (num_rows < num_of_pts) {
+            utility::LogWarning(
+                    "Read PTS failed: expected {} points, but only {} could "
+                    "be read.",
+                    num_of_pts, num_rows);
+            return false;
+        }
 
-            idx++;
-            if (idx % 1000 == 0) {
-                reporter.Update(idx);
+        const bool has_colors = num_of_fields == 7 || num_of_fields == 6;
+        const size_t color_offset = num_of_fields - 3;
+        pointcloud.points_.resize(num_of_pts);
+        if (has_colors) {
+            pointcloud.colors_.resize(num_of_pts);
+        }
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t idx = 0; idx < num_of_pts; ++idx) {
+            const double *row = values.data() + idx * num_of_fields;
+            pointcloud.points_[idx] = Eigen::Vector3d(row[0], row[1], row[2]);
+            if (has_colors) {
+                const double *color = row + color_offset;
+                pointcloud.colors_[idx] = utility::ColorToDouble(
+                        int(color[0]), int(color[1]), int(color[2]));
             }
         }
 
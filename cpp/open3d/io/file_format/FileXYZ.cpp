@@ -26,6 +26,7 @@
 
 #include <cstdio>
 
+#include "open3d/io/ASCIIParser.h"
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/io/PointCloudIO.h"
 #include "open3d/utility/FileSystem.h"
@@ -43,27 +44,26 @@ bool ReadPointCloudFromXYZ(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            const ReadPointCloudOption &params) {
     try {
-        utility::filesystem::CFile file;
-        if (!file.Open(filename, "r")) {
+        utility::filesystem::MappedFile file;
+        if (!file.Open(filename)) {
             utility::LogWarning("Read XYZ failed: unable to open file: {}",
                                 filename);
             return false;
         }
         utility::CountingProgressReporter reporter(params.update_progress);
-        reporter.SetTotal(file.GetFileSize());
+        reporter.SetTotal(file.GetSize());
 
         pointcloud.Clear();
-        int i = 0;
-        double x, y, z;
-        const char *line_buffer;
-        while ((line_buffer = file.ReadLine())) {
-            if (sscanf(line_buffer, "%lf %lf %lf", &x, &y, &z) == 3) {
-                pointcloud.points_.push_back(Eigen::Vector3d(x, y, z));
-            }
-            if (++i % 1000 == 0) {
-                reporter.Update(file.CurPos());
-            }
-        }
+        // Eigen::Vector3d is tightly packed, so the rows are parsed in place.
+        int64_t num_points = ParseASCIIRows(
+                file.GetData(), file.GetSize(), 3,
+                [&](int64_t num_rows) -> double * {
+                    pointcloud.points_.resize(num_rows);
+                    return num_rows > 0 ? pointcloud.points_.data()->data()
+                                        : nullptr;
+                },
+                [&](int64_t num_bytes) { reporter.Update(num_bytes); });
+        pointcloud.points_.resize(num_points);
         reporter.Finish();
 
         return true;
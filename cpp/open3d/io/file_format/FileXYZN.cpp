@@ -26,10 +26,12 @@
 
 #include <cstdio>
 
+#include "open3d/io/ASCIIParser.h"
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/io/PointCloudIO.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 #include "open3d/utility/ProgressReporters.h"
 
 namespace open3d {
@@ -43,28 +45,32 @@ bool ReadPointCloudFromXYZN(const std::string &filename,
                             geometry::PointCloud &pointcloud,
                             const ReadPointCloudOption &params) {
     try {
-        utility::filesystem::CFile file;
-        if (!file.Open(filename, "r")) {
+        utility::filesystem::MappedFile file;
+        if (!file.Open(filename)) {
             utility::LogWarning("Read XYZN failed: unable to open file: {}",
                                 filename);
             return false;
         }
         utility::CountingProgressReporter reporter(params.update_progress);
-        reporter.SetTotal(file.GetFileSize());
+        reporter.SetTotal(file.GetSize());
 
         pointcloud.Clear();
-        int i = 0;
-        double x, y, z, nx, ny, nz;
-        const char *line_buffer;
-        while ((line_buffer = file.ReadLine())) {
-            if (sscanf(line_buffer, "%lf %lf %lf %lf %lf %lf", &x, &y, &z, &nx,
-                       &ny, &nz) == 6) {
-                pointcloud.points_.push_back(Eigen::Vector3d(x, y, z));
-                pointcloud.normals_.push_back(Eigen::Vector3d(nx, ny, nz));
-            }
-            if (++i % 1000 == 0) {
-                reporter.Update(file.CurPos());
-            }
+        std::vector<double> data;
+        int64_t num_points = ParseASCIIRows(
+                file.GetData(), file.GetSize(), 6,
+                [&](int64_t num_rows) {
+                    data.resize(num_rows * 6);
+                    return data.data();
+                },
+                [&](int64_t num_bytes) { reporter.Update(num_bytes); });
+        pointcloud.points_.resize(num_points);
+        pointcloud.normals_.resize(num_points);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t i = 0; i < num_points; ++i) {
+            const double *row = data.data() + 6 * i;
+            pointcloud.points_[i] = Eigen::Vector3d(row[0], row[1], row[2]);
+            pointcloud.normals_[i] = Eigen::Vector3d(row[3], row[4], row[5]);
         }
         reporter.Finish();
 
@@ -26,9 +26,8 @@
 
 #include "open3d/pipelines/registration/FastGlobalRegistration.h"
 
-#include <map>
+#include <algorithm>
 
-#include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/pipelines/registration/Feature.h"
 #include "open3d/pipelines/registration/Registration.h"
@@ -40,37 +39,38 @@ namespace pipelines {
 namespace registration {
 
 static std::vector<std::pair<int, int>> InitialMatching(
-        const Feature& src_features, const Feature& dst_features) {
-    geometry::KDTreeFlann src_feature_tree(src_features);
-    geometry::KDTreeFlann dst_feature_tree(dst_features);
-    std::map<int, int> corres_ij;
-    std::vector<int> corres_ji(dst_features.data_.cols(), -1);
-
-#pragma omp for nowait
-    for (int j = 0; j < dst_features.data_.cols(); j++) {
-        std::vector<int> corres_tmp(1);
-        std::vector<double> dist_tmp(1);
-        src_feature_tree.SearchKNN(Eigen::VectorXd(dst_features.data_.col(j)),
-                                   1, corres_tmp, dist_tmp);
-        int i = corres_tmp[0];
-        corres_ji[j] = i;
-        if (corres_ij.find(i) == corres_ij.end()) {
-            // set a temp value to prevent other threads recomputing
-            // corres_ij[i] until the following dst_feature_tree.SearchKNN()
-            // call completes. There is still a race condition but the result
-            // would be fine since both threads will compute the same result
-            corres_ij[i] = -1;
-            dst_feature_tree.SearchKNN(
-                    Eigen::VectorXd(src_features.data_.col(i)), 1, corres_tmp,
-                    dist_tmp);
-            corres_ij[i] = corres_tmp[0];
-        }
+        const Feature& src_features,
+        const Feature& dst_features,
+        const FeatureMatchingOption& matching_option) {
+    std::vector<int> corres_ji =
+            FindNearestFeatures(dst_features, src_features, matching_option);
+
+    // Only the source features matched by some destination feature need a
+    // reverse search.
+    std::vector<int> src_matched;
+    src_matched.reserve(corres_ji.size());
+    for (int i : corres_ji) {
+        if (i >= 0) src_matched.push_back(i);
+    }
+    std::sort(src_matched.begin(), src_matched.end());
+    src_matched.erase(std::unique(src_matched.begin(), src_matched.end()),
+                      src_matched.end());
+    Feature src_matched_features;
+    src_matched_features.data_.resize(src_features.data_.rows(),
+                                      src_matched.size());
+    for (size_t k = 0; k < src_matched.size(); k++) {
+        src_matched_features.data_.col(k) =
+                src_features.data_.col(src_matched[k]);
     }
+    std::vector<int> corres_matched_ij = FindNearestFeatures(
+            src_matched_features, dst_features, matching_option);
 
     utility::LogDebug("\t[cross check] ");
     std::vector<std::pair<int, int>> corres_cross;
-    for (const std::pair<const int, int>& ij : corres_ij) {
-        if (corres_ji[ij.second] == ij.first) corres_cross.push_back(ij);
+    for (size_t k = 0; k < src_matched.size(); k++) {
+        const int i = src_matched[k];
+        const int j = corres_matched_ij[k];
+        if (j >= 0 && corres_ji[j] == i) corres_cross.emplace_back(i, j);
     }
     utility::LogDebug("Initial matchings : {}", corres_cross.size());
     return corres_cross;
@@ -363,15 +363,20 @@ RegistrationResult FastGlobalRegistrationBasedOnFeatureMatching(
         if (source.points_.size() > target.points_.size()) {
             corres = AdvancedMatching(
                     source, target,
-                    InitialMatching(source_feature, target_feature), option);
+                    InitialMatching(source_feature, target_feature,
+                                    option.matching_option_),
+                    option);
         } else {
             corres = AdvancedMatching(
                     target, source,
-                    InitialMatching(target_feature, source_feature), option);
+                    InitialMatching(target_feature, source_feature,
+                                    option.matching_option_),
+                    option);
             for (auto& p : corres) std::swap(p.first, p.second);
         }
     } else {
-        corres = InitialMatching(source_feature, target_feature);
+        corres = InitialMatching(source_feature, target_feature,
+                                 option.matching_option_);
     }
 
     Eigen::Matrix4d transformation;
@@ -31,6 +31,7 @@
 #include <tuple>
 #include <vector>
 
+#include "open3d/pipelines/registration/Feature.h"
 #include "open3d/pipelines/registration/TransformationEstimation.h"
 #include "open3d/utility/Optional.h"
 
@@ -43,7 +44,6 @@ class PointCloud;
 namespace pipelines {
 namespace registration {
 
-class Feature;
 class RegistrationResult;
 
 /// \class FastGlobalRegistrationOption
@@ -67,6 +67,8 @@ public:
     /// \param tuple_test Set to `true` to perform geometric compatibility tests
     /// on initial set of correspondences.
     /// \param seed Random seed.
+    /// \param matching_option Option of the nearest neighbor search between
+    /// features.
     FastGlobalRegistrationOption(
             double division_factor = 1.4,
             bool use_absolute_scale = false,
@@ -76,7 +78,9 @@ public:
             double tuple_scale = 0.95,
             int maximum_tuple_count = 1000,
             bool tuple_test = true,
-            utility::optional<unsigned int> seed = utility::nullopt)
+            utility::optional<unsigned int> seed = utility::nullopt,
+            const FeatureMatchingOption &matching_option =
+                    FeatureMatchingOption())
         : division_factor_(division_factor),
           use_absolute_scale_(use_absolute_scale),
           decrease_mu_(decrease_mu),
@@ -85,7 +89,8 @@ public:
           tuple_scale_(tuple_scale),
           maximum_tuple_count_(maximum_tuple_count),
           tuple_test_(tuple_test),
-          seed_(seed) {}
+          seed_(seed),
+          matching_option_(matching_option) {}
     ~FastGlobalRegistrationOption() {}
 
 public:
@@ -111,6 +116,8 @@ public:
     bool tuple_test_;
     /// Random seed
     utility::optional<unsigned int> seed_;
+    /// Option of the nearest neighbor search between features.
+    FeatureMatchingOption matching_option_;
 };
 
 /// \brief Fast Global Registration based on a given set of correspondences.
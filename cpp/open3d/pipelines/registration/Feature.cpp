@@ -29,6 +29,7 @@
 #include <Eigen/Dense>
 
 #include "open3d/geometry/KDTreeFlann.h"
+#include "open3d/geometry/KDTreeForest.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/utility/Logging.h"
 #include "open3d/utility/Parallel.h"
@@ -158,6 +159,51 @@ std::shared_ptr<Feature> ComputeFPFHFeature(
     return feature;
 }
 
+std::vector<int> FindNearestFeatures(
+        const Feature &query_features,
+        const Feature &target_features,
+        const FeatureMatchingOption &option /* = FeatureMatchingOption()*/) {
+    if (query_features.Dimension() != target_features.Dimension()) {
+        utility::LogError(
+                "Feature dimensions mismatch: query {} vs target {}.",
+                query_features.Dimension(), target_features.Dimension());
+    }
+    const int num_queries = static_cast<int>(query_features.Num());
+    std::vector<int> nearest(num_queries, -1);
+    if (num_queries == 0 || target_features.Num() == 0) {
+        return nearest;
+    }
+
+    if (option.approximate_) {
+        geometry::KDTreeForest forest(target_features, option.num_trees_,
+                                      option.seed_);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int i = 0; i < num_queries; i++) {
+            std::vector<int> indices;
+            std::vector<double> distance2;
+            if (forest.SearchKNN(Eigen::VectorXd(query_features.data_.col(i)),
+                                 1, option.max_checks_, indices,
+                                 distance2) > 0) {
+                nearest[i] = indices[0];
+            }
+        }
+    } else {
+        geometry::KDTreeFlann kdtree(target_features);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int i = 0; i < num_queries; i++) {
+            std::vector<int> indices(1);
+            std::vector<double> distance2(1);
+            if (kdtree.SearchKNN(Eigen::VectorXd(query_features.data_.col(i)),
+                                 1, indices, distance2) > 0) {
+                nearest[i] = indices[0];
+            }
+        }
+    }
+    return nearest;
+}
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace open3d
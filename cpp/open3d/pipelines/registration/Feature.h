@@ -31,6 +31,7 @@
 #include <vector>
 
 #include "open3d/geometry/KDTreeSearchParam.h"
+#include "open3d/utility/Optional.h"
 
 namespace open3d {
 
@@ -64,6 +65,42 @@ public:
     Eigen::MatrixXd data_;
 };
 
+/// \class FeatureMatchingOption
+///
+/// \brief Options for nearest neighbor matching of features.
+class FeatureMatchingOption {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param approximate Set to `true` to search with a randomized KD-tree
+    /// forest instead of an exact KD-tree.
+    /// \param num_trees Number of trees of the forest.
+    /// \param max_checks Maximum number of distance computations per query
+    /// of the approximate search. Larger values increase recall and time.
+    /// \param seed Random seed used to build the forest.
+    FeatureMatchingOption(
+            bool approximate = false,
+            int num_trees = 4,
+            int max_checks = 128,
+            utility::optional<unsigned int> seed = utility::nullopt)
+        : approximate_(approximate),
+          num_trees_(num_trees),
+          max_checks_(max_checks),
+          seed_(seed) {}
+    ~FeatureMatchingOption() {}
+
+public:
+    /// Search with a randomized KD-tree forest instead of an exact KD-tree.
+    bool approximate_;
+    /// Number of trees of the forest.
+    int num_trees_;
+    /// Maximum number of distance computations per query of the approximate
+    /// search.
+    int max_checks_;
+    /// Random seed used to build the forest.
+    utility::optional<unsigned int> seed_;
+};
+
 /// Function to compute FPFH feature for a point cloud.
 ///
 /// \param input The Input point cloud.
@@ -73,6 +110,17 @@ std::shared_ptr<Feature> ComputeFPFHFeature(
         const geometry::KDTreeSearchParam &search_param =
                 geometry::KDTreeSearchParamKNN());
 
+/// Function to find the nearest target feature of every query feature.
+///
+/// \param query_features Features to match.
+/// \param target_features Features to search in.
+/// \param option Matching option.
+/// \return For every query feature, the index of its nearest target feature.
+std::vector<int> FindNearestFeatures(
+        const Feature &query_features,
+        const Feature &target_features,
+        const FeatureMatchingOption &option = FeatureMatchingOption());
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace open3d
@@ -28,6 +28,7 @@
 
 #include <Eigen/Dense>
 #include <Eigen/Sparse>
+#include <algorithm>
 #include <tuple>
 #include <vector>
 
@@ -206,13 +207,19 @@ static Eigen::VectorXd ComputeZeta(const PoseGraph &pose_graph) {
 ///
 /// This function focuses the case that every edge has two nodes (not hyper
 /// graph) so we have two Jacobian matrices from one constraint.
-static std::tuple<Eigen::MatrixXd, Eigen::VectorXd> ComputeLinearSystem(
-        const PoseGraph &pose_graph, const Eigen::VectorXd &zeta) {
+/// H is block-sparse: it has a 6x6 block on the diagonal for every node and
+/// a pair of off-diagonal 6x6 blocks for every edge. The diagonal blocks are
+/// always stored, even if they are zero, so that the sparsity pattern of H only
+/// depends on the edges of the pose graph.
+static std::tuple<Eigen::SparseMatrix<double>, Eigen::VectorXd>
+ComputeLinearSystem(const PoseGraph &pose_graph, const Eigen::VectorXd &zeta) {
     int n_nodes = (int)pose_graph.nodes_.size();
     int n_edges = (int)pose_graph.edges_.size();
-    Eigen::MatrixXd H(n_nodes * 6, n_nodes * 6);
+    std::vector<Eigen::Matrix6d, utility::Matrix6d_allocator> H_diag(
+            n_nodes, Eigen::Matrix6d::Zero());
+    std::vector<Eigen::Matrix6d, utility::Matrix6d_allocator> H_off_diag(
+            n_edges);
     Eigen::VectorXd b(n_nodes * 6);
-    H.setZero();
     b.setZero();
 
     for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
@@ -229,24 +236,110 @@ static std::tuple<Eigen::MatrixXd, Eigen::VectorXd> ComputeLinearSystem(
         Eigen::Vector6d eT_Info = e.transpose() * t.information_;
         double line_process_iter = t.confidence_;
 
-        int id_i = t.source_node_id_ * 6;
-        int id_j = t.target_node_id_ * 6;
-        H.block<6, 6>(id_i, id_i).noalias() +=
-                line_process_iter * JsT_Info * Js;
-        H.block<6, 6>(id_i, id_j).noalias() +=
-                line_process_iter * JsT_Info * Jt;
-        H.block<6, 6>(id_j, id_i).noalias() +=
-                line_process_iter * JtT_Info * Js;
-        H.block<6, 6>(id_j, id_j).noalias() +=
-                line_process_iter * JtT_Info * Jt;
-        b.block<6, 1>(id_i, 0).noalias() -=
+        int id_i = t.source_node_id_;
+        int id_j = t.target_node_id_;
+        H_diag[id_i].noalias() += line_process_iter * JsT_Info * Js;
+        H_off_diag[iter_edge].noalias() = line_process_iter * JsT_Info * Jt;
+        H_diag[id_j].noalias() += line_process_iter * JtT_Info * Jt;
+        b.block<6, 1>(id_i * 6, 0).noalias() -=
                 line_process_iter * eT_Info.transpose() * Js;
-        b.block<6, 1>(id_j, 0).noalias() -=
+        b.block<6, 1>(id_j * 6, 0).noalias() -=
                 line_process_iter * eT_Info.transpose() * Jt;
     }
+
+    std::vector<Eigen::Triplet<double>> triplets;
+    triplets.reserve(36 * (n_nodes + 2 * n_edges));
+    auto add_block = [&triplets](int row, int col, const Eigen::Matrix6d &M,
+                                 bool transpose) {
+        for (int c = 0; c < 6; c++) {
+            for (int r = 0; r < 6; r++) {
+                triplets.emplace_back(row + r, col + c,
+                                      transpose ? M(c, r) : M(r, c));
+            }
+        }
+    };
+    for (int iter_node = 0; iter_node < n_nodes; iter_node++) {
+        add_block(iter_node * 6, iter_node * 6, H_diag[iter_node], false);
+    }
+    for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
+        const PoseGraphEdge &t = pose_graph.edges_[iter_edge];
+        int id_i = t.source_node_id_ * 6;
+        int id_j = t.target_node_id_ * 6;
+        add_block(id_i, id_j, H_off_diag[iter_edge], false);
+        add_block(id_j, id_i, H_off_diag[iter_edge], true);
+    }
+
+    // Duplicated entries, e.g. from parallel edges, are summed up.
+    Eigen::SparseMatrix<double> H(n_nodes * 6, n_nodes * 6);
+    H.setFromTriplets(triplets.begin(), triplets.end());
     return std::make_tuple(std::move(H), std::move(b));
 }
 
+namespace {
+
+/// Sparse LDLT solver for the normal equations of a pose graph.
+/// The sparsity pattern of H is fixed for a given set of edges, so the
+/// symbolic factorization is computed once and only the numerical
+/// factorization is redone for every solve.
+class PoseGraphLinearSolver {
+public:
+    explicit PoseGraphLinearSolver(const Eigen::SparseMatrix<double> &H) {
+        solver_.analyzePattern(H);
+    }
+
+    Eigen::VectorXd Solve(const Eigen::SparseMatrix<double> &H,
+                          const Eigen::VectorXd &b) {
+        Eigen::VectorXd x;
+        if (TrySolve(H, b, x)) {
+            return x;
+        }
+
+        // H is singular, e.g. when edges are pruned by the line process.
+        // Regularize its diagonal slightly, which keeps the sparsity pattern
+        // and thus the symbolic factorization.
+        const double shift =
+                kDiagonalShift *
+                std::max(H.diagonal().cwiseAbs().maxCoeff(), 1.0);
+        utility::LogWarning(
+                "Sparse LDLT factorization failed, retrying with a diagonal "
+                "shift of {:e}.",
+                shift);
+        solver_.setShift(shift);
+        const bool success = TrySolve(H, b, x);
+        solver_.setShift(0.0);
+        if (success) {
+            return x;
+        }
+
+        utility::LogWarning(
+                "Sparse LDLT factorization failed, switched to conjugate "
+                "gradient solver.");
+        Eigen::ConjugateGradient<Eigen::SparseMatrix<double>,
+                                 Eigen::Lower | Eigen::Upper>
+                cg(H);
+        return cg.solve(b);
+    }
+
+private:
+    bool TrySolve(const Eigen::SparseMatrix<double> &H,
+                  const Eigen::VectorXd &b,
+                  Eigen::VectorXd &x) {
+        solver_.factorize(H);
+        if (solver_.info() != Eigen::Success) {
+            return false;
+        }
+        x = solver_.solve(b);
+        return solver_.info() == Eigen::Success;
+    }
+
+    /// Diagonal shift relative to the largest diagonal entry of H.
+    static constexpr double kDiagonalShift = 1e-9;
+
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> solver_;
+};
+
+}  // namespace
+
 static Eigen::VectorXd UpdatePoseVector(const PoseGraph &pose_graph) {
     int n_nodes = (int)pose_graph.nodes_.size();
     Eigen::VectorXd output(n_nodes * 6);
@@ -511,11 +604,12 @@ void GlobalOptimizationGaussNewton::OptimizePoseGraph(
     valid_edges_num =
             UpdateConfidence(pose_graph, zeta, line_process_weight, option);
 
-    Eigen::MatrixXd H;
+    Eigen::SparseMatrix<double> H;
     Eigen::VectorXd b;
     Eigen::VectorXd x = UpdatePoseVector(pose_graph);
 
     std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta);
+    PoseGraphLinearSolver solver(H);
 
     utility::LogDebug("[Initial     ] residual : {:e}", current_residual);
 
@@ -529,13 +623,8 @@ void GlobalOptimizationGaussNewton::OptimizePoseGraph(
         utility::Timer timer_iter;
         timer_iter.Start();
 
-        Eigen::VectorXd delta(H.cols());
-        bool solver_success = false;
-
-        // Solve H_LM @ delta == b using a sparse solver
-        std::tie(solver_success, delta) = utility::SolveLinearSystemPSD(
-                H, b, /*prefer_sparse=*/true, /*check_symmetric=*/false,
-                /*check_det=*/false, /*check_psd=*/false);
+        // Solve H @ delta == b using a sparse solver
+        Eigen::VectorXd delta = solver.Solve(H, b);
 
         stop = stop || CheckRelativeIncrement(delta, x, criteria);
         if (stop) {
@@ -602,12 +691,15 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
     int valid_edges_num =
             UpdateConfidence(pose_graph, zeta, line_process_weight, option);
 
-    Eigen::MatrixXd H_I = Eigen::MatrixXd::Identity(n_nodes * 6, n_nodes * 6);
-    Eigen::MatrixXd H;
+    Eigen::SparseMatrix<double> H_I(n_nodes * 6, n_nodes * 6);
+    H_I.setIdentity();
+    Eigen::SparseMatrix<double> H;
     Eigen::VectorXd b;
     Eigen::VectorXd x = UpdatePoseVector(pose_graph);
 
     std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta);
+    // H already stores its diagonal, so H_LM shares the pattern of H.
+    PoseGraphLinearSolver solver(H);
 
     Eigen::VectorXd H_diag = H.diagonal();
     double tau = 1e-5;
@@ -629,14 +721,10 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
         timer_iter.Start();
         int lm_count = 0;
         do {
-            Eigen::MatrixXd H_LM = H + current_lambda * H_I;
-            Eigen::VectorXd delta(H_LM.cols());
-            bool solver_success = false;
+            Eigen::SparseMatrix<double> H_LM = H + current_lambda * H_I;
 
             // Solve H_LM @ delta == b using a sparse solver
-            std::tie(solver_success, delta) = utility::SolveLinearSystemPSD(
-                    H_LM, b, /*prefer_sparse=*/true, /*check_symmetric=*/false,
-                    /*check_det=*/false, /*check_psd=*/false);
+            Eigen::VectorXd delta = solver.Solve(H_LM, b);
 
             stop = stop || CheckRelativeIncrement(delta, x, criteria);
             if (!stop) {
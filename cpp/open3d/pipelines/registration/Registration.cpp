@@ -313,7 +313,9 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
                 &checkers /* = {}*/,
         const RANSACConvergenceCriteria &criteria,
         /* = RANSACConvergenceCriteria()*/
-        utility::optional<unsigned int> seed /* = utility::nullopt*/) {
+        utility::optional<unsigned int> seed /* = utility::nullopt*/,
+        const FeatureMatchingOption
+                &matching_option /* = FeatureMatchingOption()*/) {
     if (ransac_n < 3 || max_correspondence_distance <= 0.0) {
         return RegistrationResult();
     }
@@ -321,40 +323,26 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
     int num_src_pts = int(source.points_.size());
     int num_tgt_pts = int(target.points_.size());
 
-    geometry::KDTreeFlann kdtree_target(target_feature);
+    std::vector<int> nearest_ij = FindNearestFeatures(
+            source_feature, target_feature, matching_option);
     pipelines::registration::CorrespondenceSet corres_ij(num_src_pts);
-
-#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
     for (int i = 0; i < num_src_pts; i++) {
-        std::vector<int> corres_tmp(1);
-        std::vector<double> dist_tmp(1);
-
-        kdtree_target.SearchKNN(Eigen::VectorXd(source_feature.data_.col(i)), 1,
-                                corres_tmp, dist_tmp);
-        int j = corres_tmp[0];
-        corres_ij[i] = Eigen::Vector2i(i, j);
+        corres_ij[i] = Eigen::Vector2i(i, nearest_ij[i]);
     }
 
     // Do reverse check if mutual_filter is enabled
     if (mutual_filter) {
-        geometry::KDTreeFlann kdtree_source(source_feature);
+        std::vector<int> nearest_ji = FindNearestFeatures(
+                target_feature, source_feature, matching_option);
         pipelines::registration::CorrespondenceSet corres_ji(num_tgt_pts);
-
-#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
         for (int j = 0; j < num_tgt_pts; ++j) {
-            std::vector<int> corres_tmp(1);
-            std::vector<double> dist_tmp(1);
-            kdtree_source.SearchKNN(
-                    Eigen::VectorXd(target_feature.data_.col(j)), 1, corres_tmp,
-                    dist_tmp);
-            int i = corres_tmp[0];
-            corres_ji[j] = Eigen::Vector2i(i, j);
+            corres_ji[j] = Eigen::Vector2i(nearest_ji[j], j);
         }
 
         pipelines::registration::CorrespondenceSet corres_mutual;
         for (int i = 0; i < num_src_pts; ++i) {
             int j = corres_ij[i](1);
-            if (corres_ji[j](0) == i) {
+            if (j >= 0 && corres_ji[j](0) == i) {
                 corres_mutual.emplace_back(i, j);
             }
         }
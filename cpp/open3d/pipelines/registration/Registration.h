@@ -31,6 +31,7 @@
 #include <vector>
 
 #include "open3d/pipelines/registration/CorrespondenceChecker.h"
+#include "open3d/pipelines/registration/Feature.h"
 #include "open3d/pipelines/registration/TransformationEstimation.h"
 #include "open3d/utility/Eigen.h"
 #include "open3d/utility/Optional.h"
@@ -43,7 +44,6 @@ class PointCloud;
 
 namespace pipelines {
 namespace registration {
-class Feature;
 
 /// \class ICPConvergenceCriteria
 ///
@@ -215,6 +215,8 @@ RegistrationResult RegistrationRANSACBasedOnCorrespondence(
 /// \param checkers Correspondence checker.
 /// \param criteria Convergence criteria.
 /// \param seed Random seed.
+/// \param matching_option Option of the nearest neighbor search between
+/// features.
 RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -228,7 +230,8 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
         const std::vector<std::reference_wrapper<const CorrespondenceChecker>>
                 &checkers = {},
         const RANSACConvergenceCriteria &criteria = RANSACConvergenceCriteria(),
-        utility::optional<unsigned int> seed = utility::nullopt);
+        utility::optional<unsigned int> seed = utility::nullopt,
+        const FeatureMatchingOption &matching_option = FeatureMatchingOption());
 
 /// \param source The source point cloud.
 /// \param target The target point cloud.
@@ -27,26 +27,36 @@
 #include "open3d/t/geometry/PointCloud.h"
 
 #include <Eigen/Core>
+#include <algorithm>
+#include <cmath>
+#include <functional>
 #include <limits>
 #include <string>
+#include <tuple>
 #include <unordered_map>
+#include <vector>
 
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/EigenConverter.h"
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/TensorCheck.h"
-#include "open3d/core/hashmap/HashSet.h"
 #include "open3d/core/linalg/Matmul.h"
+#include "open3d/core/nns/NearestNeighborSearch.h"
 #include "open3d/t/geometry/TensorMap.h"
 #include "open3d/t/geometry/kernel/GeometryMacros.h"
 #include "open3d/t/geometry/kernel/PointCloud.h"
 #include "open3d/t/geometry/kernel/Transform.h"
+#include "open3d/utility/ProgressBar.h"
 
 namespace open3d {
 namespace t {
 namespace geometry {
 
+/// Neighbors are searched for this many query points at a time, so that the
+/// memory used by the search results stays bounded for large point clouds.
+static constexpr int64_t kNeighborSearchBatchSize = 1 << 18;
+
 PointCloud::PointCloud(const core::Device &device)
     : Geometry(Geometry::GeometryType::PointCloud, 3),
       device_(device),
@@ -212,35 +222,191 @@ PointCloud &PointCloud::Rotate(const core::Tensor &R,
     return *this;
 }
 
-PointCloud PointCloud::VoxelDownSample(
-        double voxel_size, const core::HashBackendType &backend) const {
+PointCloud PointCloud::SelectByMask(const core::Tensor &boolean_mask,
+                                    bool invert) const {
+    core::AssertTensorShape(boolean_mask, {GetPointPositions().GetLength()});
+    core::AssertTensorDtype(boolean_mask, core::Bool);
+    core::AssertTensorDevice(boolean_mask, device_);
+
+    const core::Tensor mask = invert ? boolean_mask.LogicalNot() : boolean_mask;
+    PointCloud pcd(device_);
+    for (auto &kv : point_attr_) {
+        pcd.SetPointAttr(kv.first, kv.second.IndexGet({mask}));
+    }
+    return pcd;
+}
+
+PointCloud PointCloud::VoxelDownSample(double voxel_size,
+                                       const core::HashBackendType &backend,
+                                       const std::string &reduction) const {
     if (voxel_size <= 0) {
         utility::LogError("voxel_size must be positive.");
     }
+    kernel::pointcloud::SegmentReduction segment_reduction;
+    if (reduction == "mean") {
+        segment_reduction = kernel::pointcloud::SegmentReduction::Mean;
+    } else if (reduction == "min") {
+        segment_reduction = kernel::pointcloud::SegmentReduction::Min;
+    } else if (reduction == "max") {
+        segment_reduction = kernel::pointcloud::SegmentReduction::Max;
+    } else if (reduction == "first") {
+        segment_reduction = kernel::pointcloud::SegmentReduction::First;
+    } else {
+        utility::LogError(
+                "Unsupported reduction {}, must be one of mean, min, max and "
+                "first.",
+                reduction);
+    }
+
+    const int64_t num_points = GetPointPositions().GetLength();
+    if (num_points == 0) {
+        return PointCloud(device_);
+    }
     core::Tensor points_voxeld = GetPointPositions() / voxel_size;
     core::Tensor points_voxeli = points_voxeld.Floor().To(core::Int64);
 
-    core::HashSet points_voxeli_hashset(points_voxeli.GetLength(), core::Int64,
-                                        {3}, device_, backend);
+    // All attributes are reduced in one call, so the points are grouped by
+    // voxel only once.
+    std::vector<std::string> keys;
+    std::vector<core::Tensor> values, reduced;
+    for (auto &kv : point_attr_) {
+        keys.push_back(kv.first);
+        values.push_back(kv.second);
+    }
+    core::Tensor segment_ids;
+    int64_t num_voxels;
+    kernel::pointcloud::VoxelSegments(points_voxeli, backend, segment_ids,
+                                      num_voxels);
+    kernel::pointcloud::SegmentReduce(segment_ids, num_voxels,
+                                      segment_reduction, values, reduced);
+
+    PointCloud pcd_down(device_);
+    for (size_t i = 0; i < keys.size(); ++i) {
+        pcd_down.SetPointAttr(keys[i], reduced[i]);
+    }
+    return pcd_down;
+}
+
+PointCloud PointCloud::FarthestPointDownSample(size_t num_samples) const {
+    if (num_samples == 0) {
+        return PointCloud(device_);
+    }
+    const int64_t num_points = GetPointPositions().GetLength();
+    if (static_cast<int64_t>(num_samples) > num_points) {
+        utility::LogError(
+                "Illegal number of samples: {}, must <= point size: {}",
+                num_samples, num_points);
+    }
+    core::AssertTensorDtypes(GetPointPositions(),
+                             {core::Float32, core::Float64});
 
-    core::Tensor buf_indices, masks;
-    points_voxeli_hashset.Insert(points_voxeli, buf_indices, masks);
+    core::Tensor sample_indices;
+    const core::Device::DeviceType device_type = device_.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        kernel::pointcloud::FarthestPointDownSampleCPU(
+                GetPointPositions().Contiguous(), num_samples, sample_indices);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(kernel::pointcloud::FarthestPointDownSampleCUDA,
+                  GetPointPositions().Contiguous(), num_samples,
+                  sample_indices);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
 
-    PointCloud pcd_down(GetPointPositions().GetDevice());
+    PointCloud pcd_down(device_);
     for (auto &kv : point_attr_) {
-        if (kv.first == "positions") {
-            pcd_down.SetPointAttr(kv.first,
-                                  points_voxeli.IndexGet({masks}).To(
-                                          GetPointPositions().GetDtype()) *
-                                          voxel_size);
-        } else {
-            pcd_down.SetPointAttr(kv.first, kv.second.IndexGet({masks}));
-        }
+        pcd_down.SetPointAttr(kv.first, kv.second.IndexGet({sample_indices}));
     }
-
     return pcd_down;
 }
 
+std::tuple<PointCloud, core::Tensor> PointCloud::RemoveRadiusOutliers(
+        size_t nb_points, double search_radius) const {
+    if (nb_points < 1 || search_radius <= 0) {
+        utility::LogError(
+                "Illegal input parameters, the number of points and radius "
+                "must be positive.");
+    }
+    core::AssertTensorDtypes(GetPointPositions(),
+                             {core::Float32, core::Float64});
+    const int64_t num_points = GetPointPositions().GetLength();
+    core::Tensor mask = core::Tensor::Empty({num_points}, core::Bool, device_);
+    if (num_points == 0) {
+        return std::make_tuple(SelectByMask(mask), mask);
+    }
+
+    const core::Tensor points = GetPointPositions().Contiguous();
+    core::nns::NearestNeighborSearch nns(points);
+    if (!nns.HybridIndex(search_radius)) {
+        utility::LogError("Building HybridIndex failed.");
+    }
+    // Counting stops at nb_points + 1, which is enough to keep a point.
+    for (int64_t begin = 0; begin < num_points;
+         begin += kNeighborSearchBatchSize) {
+        const int64_t end =
+                std::min(begin + kNeighborSearchBatchSize, num_points);
+        core::Tensor counts;
+        std::tie(std::ignore, std::ignore, counts) =
+                nns.HybridSearch(points.Slice(0, begin, end), search_radius,
+                                 static_cast<int>(nb_points + 1));
+        mask.Slice(0, begin, end) = counts.Gt(static_cast<int32_t>(nb_points));
+    }
+    return std::make_tuple(SelectByMask(mask), mask);
+}
+
+std::tuple<PointCloud, core::Tensor> PointCloud::RemoveStatisticalOutliers(
+        size_t nb_neighbors, double std_ratio) const {
+    if (nb_neighbors < 1 || std_ratio <= 0) {
+        utility::LogError(
+                "Illegal input parameters, the number of neighbors and "
+                "standard deviation ratio must be positive.");
+    }
+    core::AssertTensorDtypes(GetPointPositions(),
+                             {core::Float32, core::Float64});
+    const int64_t num_points = GetPointPositions().GetLength();
+    if (num_points == 0) {
+        core::Tensor mask = core::Tensor::Empty({0}, core::Bool, device_);
+        return std::make_tuple(SelectByMask(mask), mask);
+    }
+
+    const core::Tensor points = GetPointPositions().Contiguous();
+    core::nns::NearestNeighborSearch nns(points);
+    if (!nns.KnnIndex()) {
+        utility::LogError("Building KnnIndex failed.");
+    }
+    const int knn = static_cast<int>(
+            std::min<int64_t>(static_cast<int64_t>(nb_neighbors), num_points));
+    core::Tensor avg_distances =
+            core::Tensor::Empty({num_points}, core::Float64, device_);
+    for (int64_t begin = 0; begin < num_points;
+         begin += kNeighborSearchBatchSize) {
+        const int64_t end =
+                std::min(begin + kNeighborSearchBatchSize, num_points);
+        core::Tensor distances;
+        std::tie(std::ignore, distances) =
+                nns.KnnSearch(points.Slice(0, begin, end), knn);
+        avg_distances.Slice(0, begin, end) =
+                distances.To(core::Float64).Sqrt().Mean({1});
+    }
+
+    // As in the legacy implementation, points with a zero mean distance,
+    // i.e. duplicates of all their neighbors, are left out of the sums and
+    // are always removed. Every point counts towards the number of samples.
+    const core::Tensor positive = avg_distances.Gt(0);
+    const core::Tensor positive_distances = avg_distances.IndexGet({positive});
+    const double cloud_mean = positive_distances.Sum({0}).Item<double>() /
+                              static_cast<double>(num_points);
+    const core::Tensor deviations = positive_distances - cloud_mean;
+    // Bessel's correction.
+    const double std_dev =
+            std::sqrt((deviations * deviations).Sum({0}).Item<double>() /
+                      static_cast<double>(num_points - 1));
+    const double distance_threshold = cloud_mean + std_ratio * std_dev;
+    core::Tensor mask =
+            positive.LogicalAnd(avg_distances.Lt(distance_threshold));
+    return std::make_tuple(SelectByMask(mask), mask);
+}
+
 void PointCloud::EstimateNormals(
         const int max_knn /* = 30*/,
         const utility::optional<double> radius /*= utility::nullopt*/) {
@@ -389,6 +555,119 @@ void PointCloud::EstimateColorGradients(
     }
 }
 
+core::Tensor PointCloud::ClusterDBSCAN(double eps,
+                                       size_t min_points,
+                                       bool print_progress) const {
+    if (eps <= 0) {
+        utility::LogError("eps must be positive.");
+    }
+    core::AssertTensorDtypes(GetPointPositions(),
+                             {core::Float32, core::Float64});
+    const int64_t num_points = GetPointPositions().GetLength();
+    if (num_points == 0) {
+        return core::Tensor::Empty({0}, core::Int32, device_);
+    }
+    if (num_points > std::numeric_limits<int32_t>::max()) {
+        utility::LogError("ClusterDBSCAN supports at most {} points, got {}.",
+                          std::numeric_limits<int32_t>::max(), num_points);
+    }
+
+    const core::Tensor points = GetPointPositions().Contiguous();
+    core::nns::NearestNeighborSearch nns(points);
+    if (!nns.FixedRadiusIndex(eps)) {
+        utility::LogError("Building FixedRadiusIndex failed.");
+    }
+
+    // All points are counted first, and then the core points and the other
+    // points are each searched once.
+    utility::ProgressBar progress_bar(2 * num_points, "Clustering",
+                                      print_progress);
+
+    // A point is a core point if it has at least min_points neighbors,
+    // including itself. Counting stops at min_points.
+    core::Tensor is_core;
+    if (min_points <= 1) {
+        is_core = core::Tensor::Ones({num_points}, core::Bool, device_);
+    } else {
+        is_core = core::Tensor::Empty({num_points}, core::Bool, device_);
+        for (int64_t begin = 0; begin < num_points;
+             begin += kNeighborSearchBatchSize) {
+            const int64_t end =
+                    std::min(begin + kNeighborSearchBatchSize, num_points);
+            core::Tensor counts;
+            std::tie(std::ignore, std::ignore, counts) =
+                    nns.HybridSearch(points.Slice(0, begin, end), eps,
+                                     static_cast<int>(min_points));
+            is_core.Slice(0, begin, end) =
+                    counts.Ge(static_cast<int32_t>(min_points));
+            progress_bar.SetCurrentCount(end);
+        }
+    }
+    int64_t num_done = num_points;
+    progress_bar.SetCurrentCount(num_done);
+
+    auto for_each_batch = [&](const core::Tensor &query_indices,
+                              const std::function<void(const core::Tensor &)>
+                                      &func) {
+        const int64_t num_queries = query_indices.GetLength();
+        for (int64_t begin = 0; begin < num_queries;
+             begin += kNeighborSearchBatchSize) {
+            const int64_t end =
+                    std::min(begin + kNeighborSearchBatchSize, num_queries);
+            func(query_indices.Slice(0, begin, end));
+            num_done += end - begin;
+            progress_bar.SetCurrentCount(num_done);
+        }
+    };
+
+    // Merge the clusters of neighboring core points.
+    const core::Tensor core_indices = is_core.NonZero()[0];
+    core::Tensor parents =
+            core::Tensor::Arange(0, num_points, 1, core::Int32, device_);
+    for_each_batch(core_indices, [&](const core::Tensor &query_indices) {
+        core::Tensor neighbors_index, neighbors_row_splits;
+        std::tie(neighbors_index, std::ignore, neighbors_row_splits) =
+                nns.FixedRadiusSearch(points.IndexGet({query_indices}), eps,
+                                      /*sort=*/false);
+        kernel::pointcloud::UnionCoreNeighbors(
+                query_indices, neighbors_index.To(core::Int32),
+                neighbors_row_splits, is_core, parents);
+    });
+
+    // Every tree is rooted at its lowest core point, so numbering the roots in
+    // ascending order numbers the clusters like the serial algorithm.
+    kernel::pointcloud::CompressUnionFind(parents);
+    const core::Tensor root_indices =
+            parents.Eq(core::Tensor::Arange(0, num_points, 1, core::Int32,
+                                            device_))
+                    .LogicalAnd(is_core)
+                    .NonZero()[0];
+    core::Tensor labels =
+            core::Tensor::Full({num_points}, -1, core::Int32, device_);
+    labels.IndexSet({root_indices},
+                    core::Tensor::Arange(0, root_indices.GetLength(), 1,
+                                         core::Int32, device_));
+    labels.IndexSet({core_indices},
+                    labels.IndexGet({parents.IndexGet({core_indices})
+                                             .To(core::Int64)}));
+
+    // The other points join the cluster of a core neighbor, or are noise.
+    const core::Tensor non_core_indices = is_core.LogicalNot().NonZero()[0];
+    for_each_batch(non_core_indices, [&](const core::Tensor &query_indices) {
+        core::Tensor neighbors_index, neighbors_row_splits;
+        std::tie(neighbors_index, std::ignore, neighbors_row_splits) =
+                nns.FixedRadiusSearch(points.IndexGet({query_indices}), eps,
+                                      /*sort=*/false);
+        kernel::pointcloud::AssignBorderLabels(
+                query_indices, neighbors_index.To(core::Int32),
+                neighbors_row_splits, is_core, labels);
+    });
+
+    utility::LogDebug("Done Compute Clusters: {:d}",
+                      root_indices.GetLength());
+    return labels;
+}
+
 static PointCloud CreatePointCloudWithNormals(
         const Image &depth_in, /* UInt16 or Float32 */
         const Image &color_in, /* Float32 */
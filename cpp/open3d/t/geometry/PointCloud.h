@@ -27,6 +27,7 @@
 #pragma once
 
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -311,11 +312,69 @@ public:
     /// \return Rotated point cloud
     PointCloud &Rotate(const core::Tensor &R, const core::Tensor &center);
 
+    /// \brief Select points by a boolean mask.
+    ///
+    /// \param boolean_mask Bool tensor of shape {N}, where N is the number of
+    /// points, on the device of the point cloud.
+    /// \param invert If true, the points where the mask is false are selected.
+    /// \return Point cloud with all attributes of the selected points.
+    PointCloud SelectByMask(const core::Tensor &boolean_mask,
+                            bool invert = false) const;
+
     /// \brief Downsamples a point cloud with a specified voxel size.
+    ///
+    /// Points are grouped by the voxel they fall in, and every attribute of
+    /// the points in a voxel is reduced to one output point.
+    ///
     /// \param voxel_size Voxel size. A positive number.
+    /// \param backend Hash backend used to group the points on CUDA devices.
+    /// On CPU the points are grouped by sorting their voxel coordinates.
+    /// \param reduction How the attributes of a voxel are reduced: "mean"
+    /// averages them (rounded for integer attributes), "min" and "max" take the
+    /// element-wise minimum and maximum, and "first" keeps the attributes of
+    /// the first point in the voxel.
     PointCloud VoxelDownSample(double voxel_size,
                                const core::HashBackendType &backend =
-                                       core::HashBackendType::Default) const;
+                                       core::HashBackendType::Default,
+                               const std::string &reduction = "mean") const;
+
+    /// \brief Downsample a point cloud with farthest point sampling.
+    ///
+    /// Starting from the first point, the point farthest from the points
+    /// selected so far is selected iteratively. The samples are returned in
+    /// the order they are selected.
+    ///
+    /// \param num_samples Number of points to be sampled, at most the number
+    /// of points.
+    PointCloud FarthestPointDownSample(size_t num_samples) const;
+
+    /// \brief Remove points that have less than \p nb_points neighbors in a
+    /// sphere of a given radius.
+    ///
+    /// The neighbors are counted with batched hybrid searches, and a point is
+    /// kept if the sphere holds more than \p nb_points points including the
+    /// point itself, as in the legacy implementation.
+    ///
+    /// \param nb_points Number of neighbor points required within the radius.
+    /// \param search_radius Radius of the sphere.
+    /// \return Tuple of the filtered point cloud and a Bool mask of shape {N}
+    /// that is true for the kept points.
+    std::tuple<PointCloud, core::Tensor> RemoveRadiusOutliers(
+            size_t nb_points, double search_radius) const;
+
+    /// \brief Remove points that are further away from their \p nb_neighbors
+    /// neighbors than the average of the point cloud.
+    ///
+    /// A point is kept if the mean distance to its \p nb_neighbors nearest
+    /// points, including itself, is less than the mean of these distances
+    /// over the point cloud plus \p std_ratio times their standard deviation.
+    ///
+    /// \param nb_neighbors Number of neighbors around the target point.
+    /// \param std_ratio Standard deviation ratio.
+    /// \return Tuple of the filtered point cloud and a Bool mask of shape {N}
+    /// that is true for the kept points.
+    std::tuple<PointCloud, core::Tensor> RemoveStatisticalOutliers(
+            size_t nb_neighbors, double std_ratio) const;
 
     /// \brief Returns the device attribute of this PointCloud.
     core::Device GetDevice() const { return device_; }
@@ -343,6 +402,26 @@ public:
             const int max_nn = 30,
             const utility::optional<double> radius = utility::nullopt);
 
+    /// \brief Cluster PointCloud using the DBSCAN algorithm
+    /// Ester et al., "A Density-Based Algorithm for Discovering Clusters
+    /// in Large Spatial Databases with Noise", 1996
+    ///
+    /// Core points are merged in parallel with a union-find forest while their
+    /// neighbors are searched in batches, so the neighbor lists of all points
+    /// are never stored at once. Clusters are numbered by their lowest core
+    /// point index, and border points take the smallest label of their core
+    /// neighbors, which gives the same labels as the legacy implementation.
+    ///
+    /// \param eps Density parameter that is used to find neighbouring points.
+    /// \param min_points Minimum number of points to form a cluster.
+    /// \param print_progress If `true` the progress is visualized in the
+    /// console.
+    /// \return Int32 tensor of shape {N} with the label of every point, -1
+    /// indicates noise.
+    core::Tensor ClusterDBSCAN(double eps,
+                               size_t min_points,
+                               bool print_progress = false) const;
+
 public:
     /// \brief Factory function to create a point cloud from a depth image and a
     /// camera model.
@@ -29,13 +29,17 @@
 #include <Eigen/Core>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "open3d/core/EigenConverter.h"
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/TensorCheck.h"
+#include "open3d/core/TensorFunction.h"
+#include "open3d/core/hashmap/HashSet.h"
 #include "open3d/t/geometry/kernel/PointCloud.h"
 #include "open3d/t/geometry/kernel/Transform.h"
+#include "open3d/t/geometry/kernel/TriangleMesh.h"
 
 namespace open3d {
 namespace t {
@@ -164,6 +168,192 @@ TriangleMesh &TriangleMesh::Rotate(const core::Tensor &R,
     return *this;
 }
 
+/// Scales the rows of \p vectors to unit length, leaving zero rows as they
+/// are.
+static core::Tensor NormalizeRows(const core::Tensor &vectors) {
+    core::Tensor norms = (vectors * vectors).Sum({1}, true).Sqrt();
+    norms += norms.Eq(0).To(norms.GetDtype());
+    return vectors / norms;
+}
+
+/// Computes the unit normals of the triangles of \p mesh. Degenerate
+/// triangles get zero normals.
+static core::Tensor ComputeTriangleNormals(const TriangleMesh &mesh) {
+    const core::Tensor &positions = mesh.GetVertexPositions();
+    const core::Tensor triangles = mesh.GetTriangleIndices().To(core::Int64);
+    std::vector<core::Tensor> corners;
+    for (int64_t k = 0; k < 3; ++k) {
+        corners.push_back(positions.IndexGet(
+                {triangles.Slice(1, k, k + 1).Reshape({-1})}));
+    }
+    const core::Tensor e0 = corners[1] - corners[0];
+    const core::Tensor e1 = corners[2] - corners[0];
+    auto column = [](const core::Tensor &t, int64_t k) {
+        return t.Slice(1, k, k + 1);
+    };
+    return NormalizeRows(core::Concatenate(
+            {column(e0, 1) * column(e1, 2) - column(e0, 2) * column(e1, 1),
+             column(e0, 2) * column(e1, 0) - column(e0, 0) * column(e1, 2),
+             column(e0, 0) * column(e1, 1) - column(e0, 1) * column(e1, 0)},
+            1));
+}
+
+TriangleMesh TriangleMesh::SimplifyVertexClustering(
+        double voxel_size, const core::HashBackendType &backend) const {
+    if (voxel_size <= 0) {
+        utility::LogError("voxel_size must be positive.");
+    }
+    if (!HasVertexPositions()) {
+        return TriangleMesh(device_);
+    }
+
+    // The voxel grid is shifted by half a voxel from the minimum bound, as in
+    // the legacy TriangleMesh.
+    const core::Tensor &positions = GetVertexPositions();
+    const core::Tensor voxel_min_bound = GetMinBound() - voxel_size * 0.5;
+    const core::Tensor points_voxeld =
+            (positions - voxel_min_bound) / voxel_size;
+    const core::Tensor voxel_coords = points_voxeld.Floor().To(core::Int64);
+    core::Tensor segment_ids;
+    int64_t num_voxels;
+    kernel::pointcloud::VoxelSegments(voxel_coords, backend, segment_ids,
+                                      num_voxels);
+
+    std::vector<std::string> keys;
+    std::vector<core::Tensor> values, reduced;
+    for (const auto &kv : vertex_attr_) {
+        keys.push_back(kv.first);
+        values.push_back(kv.second);
+    }
+    kernel::pointcloud::SegmentReduce(
+            segment_ids, num_voxels,
+            kernel::pointcloud::SegmentReduction::Mean, values, reduced);
+    TriangleMesh mesh(device_);
+    for (size_t i = 0; i < keys.size(); ++i) {
+        mesh.SetVertexAttr(keys[i], reduced[i]);
+    }
+    if (mesh.HasVertexNormals()) {
+        mesh.SetVertexNormals(NormalizeRows(mesh.GetVertexNormals()));
+    }
+    if (!HasTriangleIndices()) {
+        return mesh;
+    }
+
+    // Only triangles whose vertices end up in three different voxels are
+    // kept.
+    const core::Tensor &triangles = GetTriangleIndices();
+    const core::Tensor new_triangles =
+            segment_ids.IndexGet({triangles.To(core::Int64).Reshape({-1})})
+                    .Reshape({-1, 3});
+    const core::Tensor c0 = new_triangles.Slice(1, 0, 1);
+    const core::Tensor c1 = new_triangles.Slice(1, 1, 2);
+    const core::Tensor c2 = new_triangles.Slice(1, 2, 3);
+    const core::Tensor valid =
+            c0.Ne(c1).LogicalAnd(c1.Ne(c2)).LogicalAnd(c2.Ne(c0));
+    core::Tensor triangle_ids = valid.Reshape({-1}).NonZero().Reshape({-1});
+
+    // Triangles that only differ by a rotation of their indices are
+    // duplicates, so the hash keys start with the smallest index.
+    const int64_t num_valid = triangle_ids.GetLength();
+    if (num_valid > 0) {
+        const core::Tensor valid_triangles =
+                new_triangles.IndexGet({triangle_ids});
+        const core::Tensor first = valid_triangles.ArgMin({1});
+        const core::Tensor row_offsets = core::Tensor::Arange(
+                0, 3 * num_valid, 3, core::Int64, device_);
+        const core::Tensor valid_triangles_flat =
+                valid_triangles.Reshape({-1});
+        core::Tensor triangle_keys =
+                core::Tensor::Empty({num_valid, 3}, core::Int64, device_);
+        for (int64_t k = 0; k < 3; ++k) {
+            core::Tensor corner = first + k;
+            corner -= corner.Ge(3).To(core::Int64) * 3;
+            triangle_keys.Slice(1, k, k + 1) =
+                    valid_triangles_flat.IndexGet({row_offsets + corner})
+                            .Reshape({-1, 1});
+        }
+
+        core::HashSet triangle_hashset(num_valid, core::Int64, {3}, device_,
+                                       backend);
+        core::Tensor buf_indices, masks;
+        triangle_hashset.Insert(triangle_keys, buf_indices, masks);
+        triangle_ids = triangle_ids.IndexGet({masks});
+    }
+
+    mesh.SetTriangleIndices(new_triangles.IndexGet({triangle_ids})
+                                    .To(triangles.GetDtype()));
+    for (const auto &kv : triangle_attr_) {
+        if (kv.first != triangle_attr_.GetPrimaryKey()) {
+            mesh.SetTriangleAttr(kv.first, kv.second.IndexGet({triangle_ids}));
+        }
+    }
+    if (mesh.HasTriangleNormals()) {
+        mesh.SetTriangleNormals(ComputeTriangleNormals(mesh).To(
+                mesh.GetTriangleNormals().GetDtype()));
+    }
+    return mesh;
+}
+
+TriangleMesh TriangleMesh::SimplifyQuadricDecimation(
+        int64_t target_number_of_triangles,
+        double maximum_error,
+        double boundary_weight) const {
+    if (target_number_of_triangles < 0) {
+        utility::LogError("target_number_of_triangles must be non-negative.");
+    }
+    if (!HasVertexPositions() || !HasTriangleIndices()) {
+        return Clone();
+    }
+
+    static const core::Device host("CPU:0");
+    const core::Tensor &positions = GetVertexPositions();
+    const core::Tensor &triangles = GetTriangleIndices();
+    core::Tensor new_positions, new_triangles, vertex_segment_ids,
+            triangle_ids;
+    kernel::trianglemesh::SimplifyQuadricDecimationCPU(
+            positions.To(host, core::Float64),
+            triangles.To(host, core::Int64), target_number_of_triangles,
+            maximum_error, boundary_weight, new_positions, new_triangles,
+            vertex_segment_ids, triangle_ids);
+
+    TriangleMesh mesh(device_);
+    mesh.SetVertexPositions(new_positions.To(device_, positions.GetDtype()));
+    mesh.SetTriangleIndices(new_triangles.To(device_, triangles.GetDtype()));
+
+    // The other vertex attributes are averaged over the collapsed vertices.
+    std::vector<std::string> keys;
+    std::vector<core::Tensor> values, reduced;
+    for (const auto &kv : vertex_attr_) {
+        if (kv.first != vertex_attr_.GetPrimaryKey()) {
+            keys.push_back(kv.first);
+            values.push_back(kv.second);
+        }
+    }
+    if (!keys.empty()) {
+        kernel::pointcloud::SegmentReduce(
+                vertex_segment_ids.To(device_), new_positions.GetLength(),
+                kernel::pointcloud::SegmentReduction::Mean, values, reduced);
+        for (size_t i = 0; i < keys.size(); ++i) {
+            mesh.SetVertexAttr(keys[i], reduced[i]);
+        }
+    }
+    if (mesh.HasVertexNormals()) {
+        mesh.SetVertexNormals(NormalizeRows(mesh.GetVertexNormals()));
+    }
+
+    triangle_ids = triangle_ids.To(device_);
+    for (const auto &kv : triangle_attr_) {
+        if (kv.first != triangle_attr_.GetPrimaryKey()) {
+            mesh.SetTriangleAttr(kv.first, kv.second.IndexGet({triangle_ids}));
+        }
+    }
+    if (mesh.HasTriangleNormals()) {
+        mesh.SetTriangleNormals(ComputeTriangleNormals(mesh).To(
+                mesh.GetTriangleNormals().GetDtype()));
+    }
+    return mesh;
+}
+
 geometry::TriangleMesh TriangleMesh::FromLegacy(
         const open3d::geometry::TriangleMesh &mesh_legacy,
         core::Dtype float_dtype,
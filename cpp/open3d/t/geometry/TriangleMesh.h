@@ -26,8 +26,11 @@
 
 #pragma once
 
+#include <limits>
+
 #include "open3d/core/Tensor.h"
 #include "open3d/core/TensorCheck.h"
+#include "open3d/core/hashmap/HashMap.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/t/geometry/DrawableGeometry.h"
 #include "open3d/t/geometry/Geometry.h"
@@ -428,6 +431,49 @@ public:
     /// \return Rotated TriangleMesh
     TriangleMesh &Rotate(const core::Tensor &R, const core::Tensor &center);
 
+    /// \brief Simplifies the TriangleMesh by clustering its vertices in a
+    /// voxel grid.
+    ///
+    /// The vertices within a voxel are merged into one vertex, whose
+    /// attributes are the averages of the merged vertices' attributes, with
+    /// the normals normalized.
+    /// Triangles that collapse into a line or a point are removed, and of the
+    /// triangles that end up with the same vertices in the same orientation
+    /// only one is kept. The kept triangles keep their attributes, and their
+    /// normals are recomputed if they exist. The result can be a non-manifold
+    /// mesh.
+    /// \param voxel_size The size of the voxels within which vertices are
+    /// pooled.
+    /// \param backend The hash backend used to group vertices and triangles.
+    /// \return Simplified TriangleMesh
+    TriangleMesh SimplifyVertexClustering(
+            double voxel_size,
+            const core::HashBackendType &backend =
+                    core::HashBackendType::Default) const;
+
+    /// \brief Simplifies the TriangleMesh with Quadric Error Metric
+    /// Decimation by Garland and Heckbert.
+    ///
+    /// Each round collapses a batch of the cheapest edges whose one-rings do
+    /// not overlap, so the collapses of a batch are applied in parallel.
+    /// Collapses that would flip a triangle are skipped. The merged vertices'
+    /// attributes other than positions are averaged, with the normals
+    /// normalized. The remaining triangles keep their attributes, and their
+    /// normals are recomputed if they exist. The decimation runs on CPU;
+    /// meshes on other devices are copied to CPU and back.
+    /// \param target_number_of_triangles The number of triangles that the
+    /// simplified mesh should have. It is not guaranteed that this number
+    /// will be reached.
+    /// \param maximum_error The maximum error where a vertex is allowed to be
+    /// merged.
+    /// \param boundary_weight A weight applied to edge vertices used to
+    /// preserve boundaries.
+    /// \return Simplified TriangleMesh
+    TriangleMesh SimplifyQuadricDecimation(
+            int64_t target_number_of_triangles,
+            double maximum_error = std::numeric_limits<double>::infinity(),
+            double boundary_weight = 1.0) const;
+
     core::Device GetDevice() const { return device_; }
 
     /// Create a TriangleMesh from a legacy Open3D TriangleMesh.
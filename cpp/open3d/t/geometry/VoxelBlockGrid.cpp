@@ -26,13 +26,21 @@
 
 #include "open3d/t/geometry/VoxelBlockGrid.h"
 
+#include <algorithm>
+#include <cstdio>
+#include <map>
+#include <numeric>
+#include <unordered_set>
+
 #include "open3d/core/Tensor.h"
+#include "open3d/core/TensorCheck.h"
 #include "open3d/t/geometry/Geometry.h"
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/geometry/Utility.h"
 #include "open3d/t/geometry/kernel/VoxelBlockGrid.h"
 #include "open3d/t/io/NumpyIO.h"
 #include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Helper.h"
 
 namespace open3d {
 namespace t {
@@ -342,6 +350,7 @@ void VoxelBlockGrid::Integrate(const core::Tensor &block_coords,
             block_value_map, depth_intrinsic, color_intrinsic, extrinsic,
             block_resolution_, voxel_size_,
             voxel_size_ * trunc_voxel_multiplier, depth_scale, depth_max);
+    MarkBlocksDirty(buf_indices);
 }
 
 TensorMap VoxelBlockGrid::RayCast(const core::Tensor &block_coords,
@@ -490,65 +499,39 @@ TriangleMesh VoxelBlockGrid::ExtractTriangleMesh(float weight_threshold,
     return mesh;
 }
 
-void VoxelBlockGrid::Save(const std::string &file_name) const {
-    AssertInitialized();
-    // TODO(wei): provide 'GetActiveKeyValues' functionality.
-    core::Tensor keys = block_hashmap_->GetKeyTensor();
-    std::vector<core::Tensor> values = block_hashmap_->GetValueTensors();
-
+static std::unordered_map<std::string, core::Tensor> ConstructMetadata(
+        float voxel_size,
+        int64_t block_resolution,
+        const core::Device &device,
+        const std::unordered_map<std::string, int> &name_attr_map) {
     core::Device host("CPU:0");
-
-    core::Tensor active_buf_indices_i32 = block_hashmap_->GetActiveIndices();
-    core::Tensor active_indices = active_buf_indices_i32.To(core::Int64);
-
     std::unordered_map<std::string, core::Tensor> output;
 
     // Save name attributes
-    output.emplace("voxel_size", core::Tensor(std::vector<float>{voxel_size_},
+    output.emplace("voxel_size", core::Tensor(std::vector<float>{voxel_size},
                                               {1}, core::Float32, host));
     output.emplace("block_resolution",
-                   core::Tensor(std::vector<int64_t>{block_resolution_}, {1},
+                   core::Tensor(std::vector<int64_t>{block_resolution}, {1},
                                 core::Int64, host));
     // Placeholder
-    output.emplace(block_hashmap_->GetDevice().ToString(),
+    output.emplace(device.ToString(),
                    core::Tensor::Zeros({}, core::Dtype::UInt8, host));
 
-    for (auto &it : name_attr_map_) {
+    for (auto &it : name_attr_map) {
         // Workaround, as we don't support char tensors now.
         output.emplace(fmt::format("attr_name_{}", it.first),
                        core::Tensor(std::vector<int>{it.second}, {1},
                                     core::Int32, host));
     }
-
-    // Save keys
-    core::Tensor active_keys = keys.IndexGet({active_indices}).To(host);
-    output.emplace("key", active_keys);
-
-    // Save SoA values and name attributes
-    for (auto &it : name_attr_map_) {
-        int value_id = it.second;
-        core::Tensor active_value_i =
-                values[value_id].IndexGet({active_indices}).To(host);
-        output.emplace(fmt::format("value_{:03d}", value_id), active_value_i);
-    }
-
-    std::string ext =
-            utility::filesystem::GetFileExtensionInLowerCase(file_name);
-    if (ext != "npz") {
-        utility::LogWarning(
-                "File name for a voxel grid should be with the extension "
-                ".npz. Saving to {}.npz",
-                file_name);
-        t::io::WriteNpz(file_name + ".npz", output);
-    } else {
-        t::io::WriteNpz(file_name, output);
-    }
+    return output;
 }
 
-VoxelBlockGrid VoxelBlockGrid::Load(const std::string &file_name) {
-    std::unordered_map<std::string, core::Tensor> tensor_map =
-            t::io::ReadNpz(file_name);
-
+// Construct an empty voxel block grid with the attributes, voxel size and
+// device stored by ConstructMetadata(). The value tensors, or empty
+// placeholders of them, give the attribute dtypes and channels.
+static VoxelBlockGrid ConstructFromMetadata(
+        const std::unordered_map<std::string, core::Tensor> &tensor_map,
+        int64_t block_count) {
     std::string prefix = "attr_name_";
     std::unordered_map<int, std::string> inv_attr_map;
 
@@ -575,8 +558,6 @@ VoxelBlockGrid VoxelBlockGrid::Load(const std::string &file_name) {
     core::Device device(device_str);
 
     std::vector<std::string> attr_names(inv_attr_map.size());
-
-    std::vector<core::Tensor> soa_value_tensor(inv_attr_map.size());
     std::vector<core::Dtype> attr_dtypes(inv_attr_map.size());
     std::vector<core::SizeVector> attr_channels(inv_attr_map.size());
 
@@ -586,10 +567,8 @@ VoxelBlockGrid VoxelBlockGrid::Load(const std::string &file_name) {
         int value_id = v.first;
         attr_names[value_id] = v.second;
 
-        core::Tensor value_i =
+        const core::Tensor &value_i =
                 tensor_map.at(fmt::format("value_{:03d}", value_id));
-
-        soa_value_tensor[value_id] = value_i.To(device);
         attr_dtypes[value_id] = value_i.GetDtype();
 
         core::SizeVector value_i_shape = value_i.GetShape();
@@ -598,17 +577,332 @@ VoxelBlockGrid VoxelBlockGrid::Load(const std::string &file_name) {
         attr_channels[value_id] = value_i_shape;
     }
 
-    core::Tensor keys = tensor_map.at("key").To(device);
     float voxel_size = tensor_map.at("voxel_size")[0].Item<float>();
     int block_resolution = tensor_map.at("block_resolution")[0].Item<int64_t>();
 
-    VoxelBlockGrid vbg(attr_names, attr_dtypes, attr_channels, voxel_size,
-                       block_resolution, keys.GetLength(), device);
+    return VoxelBlockGrid(attr_names, attr_dtypes, attr_channels, voxel_size,
+                          block_resolution, block_count, device);
+}
+
+void VoxelBlockGrid::Save(const std::string &file_name) const {
+    AssertInitialized();
+    // TODO(wei): provide 'GetActiveKeyValues' functionality.
+    core::Tensor keys = block_hashmap_->GetKeyTensor();
+    std::vector<core::Tensor> values = block_hashmap_->GetValueTensors();
+
+    core::Device host("CPU:0");
+
+    core::Tensor active_buf_indices_i32 = block_hashmap_->GetActiveIndices();
+    core::Tensor active_indices = active_buf_indices_i32.To(core::Int64);
+
+    std::unordered_map<std::string, core::Tensor> output =
+            ConstructMetadata(voxel_size_, block_resolution_,
+                              block_hashmap_->GetDevice(), name_attr_map_);
+
+    // Save keys
+    core::Tensor active_keys = keys.IndexGet({active_indices}).To(host);
+    output.emplace("key", active_keys);
+
+    // Save SoA values and name attributes
+    for (auto &it : name_attr_map_) {
+        int value_id = it.second;
+        core::Tensor active_value_i =
+                values[value_id].IndexGet({active_indices}).To(host);
+        output.emplace(fmt::format("value_{:03d}", value_id), active_value_i);
+    }
+
+    std::string ext =
+            utility::filesystem::GetFileExtensionInLowerCase(file_name);
+    if (ext != "npz") {
+        utility::LogWarning(
+                "File name for a voxel grid should be with the extension "
+                ".npz. Saving to {}.npz",
+                file_name);
+        t::io::WriteNpz(file_name + ".npz", output);
+    } else {
+        t::io::WriteNpz(file_name, output);
+    }
+}
+
+VoxelBlockGrid VoxelBlockGrid::Load(const std::string &file_name) {
+    std::unordered_map<std::string, core::Tensor> tensor_map =
+            t::io::ReadNpz(file_name);
+
+    core::Tensor keys = tensor_map.at("key");
+    VoxelBlockGrid vbg = ConstructFromMetadata(tensor_map, keys.GetLength());
+    core::Device device = vbg.block_hashmap_->GetDevice();
+
+    std::vector<core::Tensor> soa_value_tensor(vbg.name_attr_map_.size());
+    for (size_t value_id = 0; value_id < soa_value_tensor.size(); ++value_id) {
+        soa_value_tensor[value_id] =
+                tensor_map.at(fmt::format("value_{:03d}", value_id))
+                        .To(device);
+    }
+
     auto block_hashmap = vbg.GetHashMap();
-    block_hashmap.Insert(keys, soa_value_tensor);
+    block_hashmap.Insert(keys.To(device), soa_value_tensor);
+    return vbg;
+}
+
+static const std::string kBlockStoreIndex = "index.npz";
+
+static std::string GetBlockStoreSegmentPath(const std::string &dir_name,
+                                            int64_t segment) {
+    return fmt::format("{}/blocks_{:06d}.npz", dir_name, segment);
+}
+
+void VoxelBlockGrid::SaveBlockStore(const std::string &dir_name) {
+    AssertInitialized();
+    core::Device host("CPU:0");
+    const std::string index_path = dir_name + "/" + kBlockStoreIndex;
+
+    if (!utility::filesystem::DirectoryExists(dir_name) &&
+        !utility::filesystem::MakeDirectoryHierarchy(dir_name)) {
+        utility::LogError("Unable to create block store directory {}.",
+                          dir_name);
+    }
+
+    // Read the previous index. Its blocks are only kept if this grid was
+    // saved to or loaded from the same store, otherwise all blocks are
+    // written and the old segments are dropped.
+    bool incremental = false;
+    core::Tensor old_keys, old_segments, old_rows;
+    int64_t next_segment = 0;
+    if (utility::filesystem::FileExists(index_path)) {
+        std::unordered_map<std::string, core::Tensor> old_index =
+                t::io::ReadNpz(index_path);
+        old_keys = old_index.at("key");
+        old_segments = old_index.at("segment");
+        old_rows = old_index.at("row");
+        next_segment = old_index.at("next_segment")[0].Item<int64_t>();
+        incremental = dir_name == block_store_dir_;
+    }
+
+    core::Tensor active_indices =
+            block_hashmap_->GetActiveIndices().To(core::Int64);
+    core::Tensor save_indices = active_indices;
+    if (incremental &&
+        dirty_mask_.GetLength() == block_hashmap_->GetCapacity()) {
+        save_indices = active_indices.IndexGet(
+                {dirty_mask_.IndexGet({active_indices}).To(core::Bool)});
+    }
+    const int64_t num_saved = save_indices.GetLength();
+
+    // Write the modified blocks as a new segment.
+    core::Tensor saved_keys = block_hashmap_->GetKeyTensor()
+                                      .IndexGet({save_indices})
+                                      .To(host);
+    const int64_t segment = next_segment;
+    if (num_saved > 0) {
+        std::unordered_map<std::string, core::Tensor> output;
+        output.emplace("key", saved_keys);
+        for (auto &it : name_attr_map_) {
+            int value_id = it.second;
+            output.emplace(fmt::format("value_{:03d}", value_id),
+                           block_hashmap_->GetValueTensor(value_id)
+                                   .IndexGet({save_indices})
+                                   .To(host));
+        }
+        t::io::WriteNpz(GetBlockStoreSegmentPath(dir_name, segment), output);
+        ++next_segment;
+    }
+
+    // Merge the new segment into the index. Entries of rewritten blocks
+    // point to the new segment.
+    std::vector<Eigen::Vector3i> keys;
+    std::vector<int64_t> segments;
+    std::vector<int64_t> rows;
+    std::unordered_map<Eigen::Vector3i, int64_t,
+                       utility::hash_eigen<Eigen::Vector3i>>
+            key_to_entry;
+    std::unordered_set<int64_t> old_segment_set;
+    if (old_keys.NumElements() > 0) {
+        const int *old_keys_ptr = old_keys.GetDataPtr<int>();
+        const int64_t *old_segments_ptr = old_segments.GetDataPtr<int64_t>();
+        const int64_t *old_rows_ptr = old_rows.GetDataPtr<int64_t>();
+        for (int64_t i = 0; i < old_keys.GetLength(); ++i) {
+            old_segment_set.insert(old_segments_ptr[i]);
+            if (!incremental) {
+                continue;
+            }
+            Eigen::Vector3i key(old_keys_ptr[3 * i], old_keys_ptr[3 * i + 1],
+                                old_keys_ptr[3 * i + 2]);
+            key_to_entry[key] = static_cast<int64_t>(keys.size());
+            keys.push_back(key);
+            segments.push_back(old_segments_ptr[i]);
+            rows.push_back(old_rows_ptr[i]);
+        }
+    }
+    const int *saved_keys_ptr = saved_keys.GetDataPtr<int>();
+    for (int64_t i = 0; i < num_saved; ++i) {
+        Eigen::Vector3i key(saved_keys_ptr[3 * i], saved_keys_ptr[3 * i + 1],
+                            saved_keys_ptr[3 * i + 2]);
+        auto it = key_to_entry.find(key);
+        if (it == key_to_entry.end()) {
+            key_to_entry.emplace(key, static_cast<int64_t>(keys.size()));
+            keys.push_back(key);
+            segments.push_back(segment);
+            rows.push_back(i);
+        } else {
+            segments[it->second] = segment;
+            rows[it->second] = i;
+        }
+    }
+
+    const int64_t num_entries = static_cast<int64_t>(keys.size());
+    std::vector<int> keys_flat(3 * num_entries);
+    for (int64_t i = 0; i < num_entries; ++i) {
+        keys_flat[3 * i + 0] = keys[i](0);
+        keys_flat[3 * i + 1] = keys[i](1);
+        keys_flat[3 * i + 2] = keys[i](2);
+    }
+
+    std::unordered_map<std::string, core::Tensor> index =
+            ConstructMetadata(voxel_size_, block_resolution_,
+                              block_hashmap_->GetDevice(), name_attr_map_);
+    index.emplace("key",
+                  core::Tensor(keys_flat, {num_entries, 3}, core::Int32, host));
+    index.emplace("segment",
+                  core::Tensor(segments, {num_entries}, core::Int64, host));
+    index.emplace("row", core::Tensor(rows, {num_entries}, core::Int64, host));
+    index.emplace("next_segment",
+                  core::Tensor(std::vector<int64_t>{next_segment}, {1},
+                               core::Int64, host));
+    // Empty value tensors keep the attribute dtypes and shapes.
+    for (auto &it : name_attr_map_) {
+        int value_id = it.second;
+        core::SizeVector shape =
+                block_hashmap_->GetValueTensor(value_id).GetShape();
+        shape[0] = 0;
+        index.emplace(fmt::format("value_{:03d}", value_id),
+                      core::Tensor(shape,
+                                   block_hashmap_->GetValueTensor(value_id)
+                                           .GetDtype(),
+                                   host));
+    }
+
+    // Replace the index in one step, so an interrupted save leaves the
+    // previous checkpoint intact.
+    const std::string tmp_index_path = dir_name + "/index_tmp.npz";
+    t::io::WriteNpz(tmp_index_path, index);
+    if (std::rename(tmp_index_path.c_str(), index_path.c_str()) != 0) {
+        utility::filesystem::RemoveFile(index_path);
+        if (std::rename(tmp_index_path.c_str(), index_path.c_str()) != 0) {
+            utility::LogError("Unable to write block store index {}.",
+                              index_path);
+        }
+    }
+
+    // Drop segments that no block refers to any more.
+    std::unordered_set<int64_t> live_segments(segments.begin(),
+                                              segments.end());
+    for (int64_t old_segment : old_segment_set) {
+        if (live_segments.count(old_segment) == 0) {
+            utility::filesystem::RemoveFile(
+                    GetBlockStoreSegmentPath(dir_name, old_segment));
+        }
+    }
+
+    dirty_mask_ = core::Tensor::Zeros({block_hashmap_->GetCapacity()},
+                                      core::UInt8, block_hashmap_->GetDevice());
+    block_store_dir_ = dir_name;
+}
+
+VoxelBlockGrid VoxelBlockGrid::LoadBlockStore(
+        const std::string &dir_name, const core::Tensor &block_coords) {
+    core::Device host("CPU:0");
+    std::unordered_map<std::string, core::Tensor> index =
+            t::io::ReadNpz(dir_name + "/" + kBlockStoreIndex);
+    core::Tensor keys = index.at("key");
+    core::Tensor segments = index.at("segment");
+    core::Tensor rows = index.at("row");
+    const int *keys_ptr = keys.GetDataPtr<int>();
+    const int64_t *segments_ptr = segments.GetDataPtr<int64_t>();
+    const int64_t *rows_ptr = rows.GetDataPtr<int64_t>();
+
+    // Select the index entries to load.
+    std::vector<int64_t> entries;
+    if (block_coords.NumElements() == 0) {
+        entries.resize(keys.GetLength());
+        std::iota(entries.begin(), entries.end(), 0);
+    } else {
+        core::AssertTensorShape(block_coords, {utility::nullopt, 3});
+        core::AssertTensorDtype(block_coords, core::Int32);
+        std::unordered_map<Eigen::Vector3i, int64_t,
+                           utility::hash_eigen<Eigen::Vector3i>>
+                key_to_entry;
+        for (int64_t i = 0; i < keys.GetLength(); ++i) {
+            key_to_entry.emplace(Eigen::Vector3i(keys_ptr[3 * i],
+                                                 keys_ptr[3 * i + 1],
+                                                 keys_ptr[3 * i + 2]),
+                                 i);
+        }
+        core::Tensor coords = block_coords.To(host).Contiguous();
+        const int *coords_ptr = coords.GetDataPtr<int>();
+        std::unordered_set<int64_t> selected;
+        for (int64_t i = 0; i < coords.GetLength(); ++i) {
+            auto it = key_to_entry.find(Eigen::Vector3i(coords_ptr[3 * i],
+                                                        coords_ptr[3 * i + 1],
+                                                        coords_ptr[3 * i + 2]));
+            if (it != key_to_entry.end() &&
+                selected.insert(it->second).second) {
+                entries.push_back(it->second);
+            }
+        }
+    }
+
+    // Group the entries by segment, so each segment file is read once.
+    std::map<int64_t, std::vector<int64_t>> segment_rows;
+    for (int64_t entry : entries) {
+        segment_rows[segments_ptr[entry]].push_back(rows_ptr[entry]);
+    }
+
+    VoxelBlockGrid vbg = ConstructFromMetadata(
+            index, std::max<int64_t>(static_cast<int64_t>(entries.size()), 1));
+    core::Device device = vbg.block_hashmap_->GetDevice();
+    const size_t num_attrs = vbg.name_attr_map_.size();
+
+    for (auto &it : segment_rows) {
+        std::unordered_map<std::string, core::Tensor> segment_map =
+                t::io::ReadNpz(GetBlockStoreSegmentPath(dir_name, it.first));
+        core::Tensor row_indices(it.second,
+                                 {static_cast<int64_t>(it.second.size())},
+                                 core::Int64, host);
+        std::vector<core::Tensor> values(num_attrs);
+        for (size_t value_id = 0; value_id < num_attrs; ++value_id) {
+            values[value_id] =
+                    segment_map.at(fmt::format("value_{:03d}", value_id))
+                            .IndexGet({row_indices})
+                            .To(device);
+        }
+        core::Tensor segment_keys =
+                segment_map.at("key").IndexGet({row_indices}).To(device);
+        core::Tensor buf_indices, masks;
+        vbg.block_hashmap_->Insert(segment_keys, values, buf_indices, masks);
+    }
+
+    vbg.dirty_mask_ =
+            core::Tensor::Zeros({vbg.block_hashmap_->GetCapacity()},
+                                core::UInt8, device);
+    vbg.block_store_dir_ = dir_name;
     return vbg;
 }
 
+void VoxelBlockGrid::MarkBlocksDirty(const core::Tensor &buf_indices) {
+    AssertInitialized();
+    const int64_t capacity = block_hashmap_->GetCapacity();
+    core::Device device = block_hashmap_->GetDevice();
+    if (dirty_mask_.GetLength() != capacity) {
+        // The hash map was rehashed and blocks moved, mark all of them.
+        dirty_mask_ = core::Tensor::Ones({capacity}, core::UInt8, device);
+        return;
+    }
+    core::Tensor indices = buf_indices.To(device, core::Int64).Flatten();
+    dirty_mask_.IndexSet(
+            {indices},
+            core::Tensor::Ones({indices.GetLength()}, core::UInt8, device));
+}
+
 void VoxelBlockGrid::AssertInitialized() const {
     if (block_hashmap_ == nullptr) {
         utility::LogError("VoxelBlockGrid not initialized.");
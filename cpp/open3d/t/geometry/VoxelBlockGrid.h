@@ -237,6 +237,30 @@ public:
     /// Load a voxel block grid from a .npz file.
     static VoxelBlockGrid Load(const std::string &file_name);
 
+    /// Save a voxel block grid to a block store directory for incremental
+    /// checkpoints. Only blocks modified since the last save to or load from
+    /// the same store are written, as a new segment file next to an index of
+    /// all stored blocks. Segments no longer referenced are deleted.
+    /// Blocks are marked as modified by Integrate() and MarkBlocksDirty(), or
+    /// all at once when the hash map is rehashed. Blocks erased from the hash
+    /// map are kept in the store; use Save() for a compact snapshot.
+    void SaveBlockStore(const std::string &dir_name);
+
+    /// Load a voxel block grid from a block store directory.
+    /// \param dir_name The block store directory.
+    /// \param block_coords Optional (N, 3) Int32 block coordinates to load.
+    /// Only the segments holding these blocks are read, and blocks missing in
+    /// the store are skipped. Leave empty to load all the blocks.
+    /// Saving back to the store keeps the blocks that were not loaded.
+    static VoxelBlockGrid LoadBlockStore(
+            const std::string &dir_name,
+            const core::Tensor &block_coords = core::Tensor());
+
+    /// Mark the blocks at the given buffer indices as modified for the next
+    /// SaveBlockStore(). Required after changing block values with custom
+    /// operations on GetHashMap() or GetAttribute().
+    void MarkBlocksDirty(const core::Tensor &buf_indices);
+
 private:
     void AssertInitialized() const;
 
@@ -251,6 +275,14 @@ private:
 
     // Map: attribute name -> index to access the attribute in SoA.
     std::unordered_map<std::string, int> name_attr_map_;
+
+    // UInt8 mask over buffer indices of blocks modified since the last
+    // SaveBlockStore(). Reset to all true when the capacity changes, since a
+    // rehash moves the blocks.
+    core::Tensor dirty_mask_;
+
+    // Directory of the block store last saved to or loaded from.
+    std::string block_store_dir_;
 };
 }  // namespace geometry
 }  // namespace t
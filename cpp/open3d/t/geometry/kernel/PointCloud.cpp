@@ -31,6 +31,8 @@
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/TensorCheck.h"
+#include "open3d/core/hashmap/HashSet.h"
 #include "open3d/utility/Logging.h"
 
 namespace open3d {
@@ -118,6 +120,128 @@ void Project(
     }
 }
 
+/// Maps every point to the index of its voxel, numbering the voxels by the
+/// points that inserted them into a hash set.
+static void VoxelSegmentsUsingHashSet(const core::Tensor& voxel_coords,
+                                      const core::HashBackendType& backend,
+                                      core::Tensor& segment_ids,
+                                      int64_t& num_segments) {
+    const core::Device device = voxel_coords.GetDevice();
+    core::HashSet voxel_coords_hashset(voxel_coords.GetLength(), core::Int64,
+                                       {3}, device, backend);
+
+    core::Tensor buf_indices, masks;
+    voxel_coords_hashset.Insert(voxel_coords, buf_indices, masks);
+    core::Tensor voxel_buf_indices =
+            buf_indices.IndexGet({masks}).To(core::Int64);
+    num_segments = voxel_buf_indices.GetLength();
+    core::Tensor buf_to_segment = core::Tensor::Empty(
+            {voxel_coords_hashset.GetCapacity()}, core::Int64, device);
+    buf_to_segment.IndexSet(
+            {voxel_buf_indices},
+            core::Tensor::Arange(0, num_segments, 1, core::Int64, device));
+    voxel_coords_hashset.Find(voxel_coords, buf_indices, masks);
+    segment_ids = buf_to_segment.IndexGet({buf_indices.To(core::Int64)});
+}
+
+void VoxelSegments(const core::Tensor& voxel_coords,
+                   const core::HashBackendType& backend,
+                   core::Tensor& segment_ids,
+                   int64_t& num_segments) {
+    core::AssertTensorShape(voxel_coords, {utility::nullopt, 3});
+    core::AssertTensorDtype(voxel_coords, core::Int64);
+
+    const core::Device::DeviceType device_type =
+            voxel_coords.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        VoxelSegmentsCPU(voxel_coords, segment_ids, num_segments);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        VoxelSegmentsUsingHashSet(voxel_coords, backend, segment_ids,
+                                  num_segments);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void SegmentReduce(const core::Tensor& segment_ids,
+                   int64_t num_segments,
+                   SegmentReduction reduction,
+                   const std::vector<core::Tensor>& values,
+                   std::vector<core::Tensor>& reduced) {
+    core::AssertTensorDtype(segment_ids, core::Int64);
+
+    const core::Device::DeviceType device_type =
+            segment_ids.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        SegmentReduceCPU(segment_ids, num_segments, reduction, values,
+                         reduced);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(SegmentReduceCUDA, segment_ids, num_segments, reduction,
+                  values, reduced);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void UnionCoreNeighbors(const core::Tensor& query_indices,
+                        const core::Tensor& neighbors_index,
+                        const core::Tensor& neighbors_row_splits,
+                        const core::Tensor& is_core,
+                        core::Tensor& parents) {
+    core::AssertTensorDtype(query_indices, core::Int64);
+    core::AssertTensorDtype(neighbors_index, core::Int32);
+    core::AssertTensorDtype(neighbors_row_splits, core::Int64);
+    core::AssertTensorDtype(is_core, core::Bool);
+    core::AssertTensorDtype(parents, core::Int32);
+
+    const core::Device::DeviceType device_type = parents.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        UnionCoreNeighborsCPU(query_indices, neighbors_index,
+                              neighbors_row_splits, is_core, parents);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(UnionCoreNeighborsCUDA, query_indices, neighbors_index,
+                  neighbors_row_splits, is_core, parents);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void CompressUnionFind(core::Tensor& parents) {
+    core::AssertTensorDtype(parents, core::Int32);
+
+    const core::Device::DeviceType device_type = parents.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        CompressUnionFindCPU(parents);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(CompressUnionFindCUDA, parents);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void AssignBorderLabels(const core::Tensor& query_indices,
+                        const core::Tensor& neighbors_index,
+                        const core::Tensor& neighbors_row_splits,
+                        const core::Tensor& is_core,
+                        core::Tensor& labels) {
+    core::AssertTensorDtype(query_indices, core::Int64);
+    core::AssertTensorDtype(neighbors_index, core::Int32);
+    core::AssertTensorDtype(neighbors_row_splits, core::Int64);
+    core::AssertTensorDtype(is_core, core::Bool);
+    core::AssertTensorDtype(labels, core::Int32);
+
+    const core::Device::DeviceType device_type = labels.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        AssignBorderLabelsCPU(query_indices, neighbors_index,
+                              neighbors_row_splits, is_core, labels);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(AssignBorderLabelsCUDA, query_indices, neighbors_index,
+                  neighbors_row_splits, is_core, labels);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
 }  // namespace pointcloud
 }  // namespace kernel
 }  // namespace geometry
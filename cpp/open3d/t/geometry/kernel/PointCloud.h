@@ -27,8 +27,10 @@
 #pragma once
 
 #include <unordered_map>
+#include <vector>
 
 #include "open3d/core/Tensor.h"
+#include "open3d/core/hashmap/HashMap.h"
 
 namespace open3d {
 namespace t {
@@ -36,6 +38,14 @@ namespace geometry {
 namespace kernel {
 namespace pointcloud {
 
+/// Reduction applied to the rows of a tensor that share a segment id.
+enum class SegmentReduction {
+    Mean,   ///< Average of the rows, rounded for integer dtypes.
+    Min,    ///< Element-wise minimum of the rows.
+    Max,    ///< Element-wise maximum of the rows.
+    First,  ///< The row with the lowest index.
+};
+
 void Unproject(const core::Tensor& depth,
                utility::optional<std::reference_wrapper<const core::Tensor>>
                        image_colors,
@@ -57,6 +67,44 @@ void Project(
         float depth_scale,
         float depth_max);
 
+/// Maps every point to the index of its voxel, given the Int64 voxel
+/// coordinates \p voxel_coords of shape (N, 3). On CPU the voxels are
+/// numbered in lexicographic order of their coordinates; on CUDA they are
+/// grouped with a hash set of type \p backend.
+void VoxelSegments(const core::Tensor& voxel_coords,
+                   const core::HashBackendType& backend,
+                   core::Tensor& segment_ids,
+                   int64_t& num_segments);
+
+/// Reduces the rows of each tensor in \p values by segment, see
+/// SegmentReduceCPU.
+void SegmentReduce(const core::Tensor& segment_ids,
+                   int64_t num_segments,
+                   SegmentReduction reduction,
+                   const std::vector<core::Tensor>& values,
+                   std::vector<core::Tensor>& reduced);
+
+/// Links the core points \p query_indices with their core neighbors in the
+/// union-find forest \p parents, where every tree is rooted at its lowest
+/// point index. The neighbors of query i are
+/// neighbors_index[neighbors_row_splits[i]:neighbors_row_splits[i + 1]].
+void UnionCoreNeighbors(const core::Tensor& query_indices,
+                        const core::Tensor& neighbors_index,
+                        const core::Tensor& neighbors_row_splits,
+                        const core::Tensor& is_core,
+                        core::Tensor& parents);
+
+/// Points every node of the union-find forest \p parents to its root.
+void CompressUnionFind(core::Tensor& parents);
+
+/// Labels the non-core points \p query_indices with the smallest label of
+/// their core neighbors, or -1 if they have none.
+void AssignBorderLabels(const core::Tensor& query_indices,
+                        const core::Tensor& neighbors_index,
+                        const core::Tensor& neighbors_row_splits,
+                        const core::Tensor& is_core,
+                        core::Tensor& labels);
+
 void UnprojectCPU(
         const core::Tensor& depth,
         utility::optional<std::reference_wrapper<const core::Tensor>>
@@ -103,6 +151,73 @@ void ProjectCUDA(
         float depth_max);
 #endif
 
+void FarthestPointDownSampleCPU(const core::Tensor& points,
+                                int64_t num_samples,
+                                core::Tensor& sample_indices);
+
+#ifdef BUILD_CUDA_MODULE
+void FarthestPointDownSampleCUDA(const core::Tensor& points,
+                                 int64_t num_samples,
+                                 core::Tensor& sample_indices);
+#endif
+
+/// Maps every point to the index of its voxel by sorting the Int64 voxel
+/// coordinates \p voxel_coords of shape (N, 3). Voxels are numbered in
+/// lexicographic order of their coordinates.
+void VoxelSegmentsCPU(const core::Tensor& voxel_coords,
+                      core::Tensor& segment_ids,
+                      int64_t& num_segments);
+
+/// Reduces the rows of each tensor in \p values by segment. \p segment_ids
+/// is an Int64 tensor of shape (N,) with values in [0, num_segments), and
+/// every tensor in \p values has N rows. Row i of each tensor in \p reduced
+/// holds the reduction of the rows of segment i. Values of any dtype are
+/// supported. Means are accumulated in Float64, so the mean of Int64 or
+/// UInt64 values above 2^53 is not exact; min and max are exact.
+void SegmentReduceCPU(const core::Tensor& segment_ids,
+                      int64_t num_segments,
+                      SegmentReduction reduction,
+                      const std::vector<core::Tensor>& values,
+                      std::vector<core::Tensor>& reduced);
+
+#ifdef BUILD_CUDA_MODULE
+void SegmentReduceCUDA(const core::Tensor& segment_ids,
+                       int64_t num_segments,
+                       SegmentReduction reduction,
+                       const std::vector<core::Tensor>& values,
+                       std::vector<core::Tensor>& reduced);
+#endif
+
+void UnionCoreNeighborsCPU(const core::Tensor& query_indices,
+                           const core::Tensor& neighbors_index,
+                           const core::Tensor& neighbors_row_splits,
+                           const core::Tensor& is_core,
+                           core::Tensor& parents);
+
+void CompressUnionFindCPU(core::Tensor& parents);
+
+void AssignBorderLabelsCPU(const core::Tensor& query_indices,
+                           const core::Tensor& neighbors_index,
+                           const core::Tensor& neighbors_row_splits,
+                           const core::Tensor& is_core,
+                           core::Tensor& labels);
+
+#ifdef BUILD_CUDA_MODULE
+void UnionCoreNeighborsCUDA(const core::Tensor& query_indices,
+                            const core::Tensor& neighbors_index,
+                            const core::Tensor& neighbors_row_splits,
+                            const core::Tensor& is_core,
+                            core::Tensor& parents);
+
+void CompressUnionFindCUDA(core::Tensor& parents);
+
+void AssignBorderLabelsCUDA(const core::Tensor& query_indices,
+                            const core::Tensor& neighbors_index,
+                            const core::Tensor& neighbors_row_splits,
+                            const core::Tensor& is_core,
+                            core::Tensor& labels);
+#endif
+
 void EstimateCovariancesUsingHybridSearchCPU(const core::Tensor& points,
                                              core::Tensor& covariances,
                                              const double& radius,
@@ -24,7 +24,18 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <tbb/parallel_sort.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
 #include "open3d/t/geometry/kernel/PointCloudImpl.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace t {
@@ -98,6 +109,344 @@ void ProjectCPU(
     });
 }
 
+void FarthestPointDownSampleCPU(const core::Tensor& points,
+                                int64_t num_samples,
+                                core::Tensor& sample_indices) {
+    const int64_t num_points = points.GetLength();
+    sample_indices = core::Tensor::Empty({num_samples}, core::Int64,
+                                         points.GetDevice());
+    int64_t* sample_indices_ptr = sample_indices.GetDataPtr<int64_t>();
+
+    // Each iteration updates the distances and finds the farthest point in
+    // one pass, split into one chunk of points per thread. The chunk maxima
+    // are reduced in order, so ties resolve to the lowest index as in a
+    // serial scan.
+    const int64_t kMinChunkSize = 4096;
+    const int64_t num_chunks = std::max<int64_t>(
+            1, std::min<int64_t>(utility::EstimateMaxThreads(),
+                                 num_points / kMinChunkSize));
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        // Coordinates in structure of arrays layout for vectorized loads.
+        core::Tensor coords = points.T().Contiguous();
+        const scalar_t* x_ptr = coords.GetDataPtr<scalar_t>();
+        const scalar_t* y_ptr = x_ptr + num_points;
+        const scalar_t* z_ptr = y_ptr + num_points;
+
+        std::vector<scalar_t> distances(
+                num_points, std::numeric_limits<scalar_t>::infinity());
+        std::vector<scalar_t> chunk_max_dists(num_chunks);
+        std::vector<int64_t> chunk_max_indices(num_chunks);
+
+        int64_t farthest_index = 0;
+        for (int64_t i = 0; i < num_samples; ++i) {
+            sample_indices_ptr[i] = farthest_index;
+            const scalar_t sx = x_ptr[farthest_index];
+            const scalar_t sy = y_ptr[farthest_index];
+            const scalar_t sz = z_ptr[farthest_index];
+            core::ParallelFor(
+                    core::Device("CPU:0"), num_chunks, [&](int64_t chunk) {
+                        const int64_t begin = num_points * chunk / num_chunks;
+                        const int64_t end =
+                                num_points * (chunk + 1) / num_chunks;
+                        scalar_t max_dist = 0;
+                        int64_t max_index = farthest_index;
+                        for (int64_t j = begin; j < end; ++j) {
+                            const scalar_t dx = x_ptr[j] - sx;
+                            const scalar_t dy = y_ptr[j] - sy;
+                            const scalar_t dz = z_ptr[j] - sz;
+                            const scalar_t dist = std::min(
+                                    distances[j], dx * dx + dy * dy + dz * dz);
+                            distances[j] = dist;
+                            if (dist > max_dist) {
+                                max_dist = dist;
+                                max_index = j;
+                            }
+                        }
+                        chunk_max_dists[chunk] = max_dist;
+                        chunk_max_indices[chunk] = max_index;
+                    });
+            scalar_t max_dist = 0;
+            for (int64_t chunk = 0; chunk < num_chunks; ++chunk) {
+                if (chunk_max_dists[chunk] > max_dist) {
+                    max_dist = chunk_max_dists[chunk];
+                    farthest_index = chunk_max_indices[chunk];
+                }
+            }
+        }
+    });
+}
+
+void VoxelSegmentsCPU(const core::Tensor& voxel_coords,
+                      core::Tensor& segment_ids,
+                      int64_t& num_segments) {
+    const int64_t num_points = voxel_coords.GetLength();
+    const core::Tensor coords = voxel_coords.Contiguous();
+    const int64_t* coords_ptr = coords.GetDataPtr<int64_t>();
+    segment_ids = core::Tensor::Empty({num_points}, core::Int64,
+                                      voxel_coords.GetDevice());
+    int64_t* segment_ids_ptr = segment_ids.GetDataPtr<int64_t>();
+    num_segments = 0;
+    if (num_points == 0) {
+        return;
+    }
+
+    // Coordinates are packed into one 64-bit key relative to the minimum
+    // bound when the voxel range fits, so sorting compares integers only.
+    int64_t min_coords[3], max_coords[3];
+    for (int d = 0; d < 3; ++d) {
+        min_coords[d] = max_coords[d] = coords_ptr[d];
+    }
+    for (int64_t i = 1; i < num_points; ++i) {
+        for (int d = 0; d < 3; ++d) {
+            min_coords[d] = std::min(min_coords[d], coords_ptr[3 * i + d]);
+            max_coords[d] = std::max(max_coords[d], coords_ptr[3 * i + d]);
+        }
+    }
+    int bits[3];
+    for (int d = 0; d < 3; ++d) {
+        const uint64_t range = static_cast<uint64_t>(max_coords[d]) -
+                               static_cast<uint64_t>(min_coords[d]);
+        bits[d] = 0;
+        while (bits[d] < 64 && (range >> bits[d]) != 0) {
+            ++bits[d];
+        }
+    }
+
+    // Sorting (key, index) pairs keeps the points of a voxel in input order.
+    std::vector<std::pair<uint64_t, int64_t>> sorted(num_points);
+    if (bits[0] + bits[1] + bits[2] < 64) {
+        core::ParallelFor(core::Device("CPU:0"), num_points, [&](int64_t i) {
+            const int64_t* p = coords_ptr + 3 * i;
+            const uint64_t x = static_cast<uint64_t>(p[0] - min_coords[0]);
+            const uint64_t y = static_cast<uint64_t>(p[1] - min_coords[1]);
+            const uint64_t z = static_cast<uint64_t>(p[2] - min_coords[2]);
+            sorted[i] = {(((x << bits[1]) | y) << bits[2]) | z, i};
+        });
+        tbb::parallel_sort(sorted.begin(), sorted.end());
+    } else {
+        for (int64_t i = 0; i < num_points; ++i) {
+            sorted[i] = {0, i};
+        }
+        tbb::parallel_sort(
+                sorted.begin(), sorted.end(),
+                [&](const std::pair<uint64_t, int64_t>& a,
+                    const std::pair<uint64_t, int64_t>& b) {
+                    const int64_t* pa = coords_ptr + 3 * a.second;
+                    const int64_t* pb = coords_ptr + 3 * b.second;
+                    return std::lexicographical_compare(pa, pa + 3, pb,
+                                                        pb + 3) ||
+                           (std::equal(pa, pa + 3, pb) && a.second < b.second);
+                });
+    }
+
+    const int64_t* prev = coords_ptr + 3 * sorted[0].second;
+    for (const auto& key_index : sorted) {
+        const int64_t* p = coords_ptr + 3 * key_index.second;
+        if (!std::equal(p, p + 3, prev)) {
+            ++num_segments;
+            prev = p;
+        }
+        segment_ids_ptr[key_index.second] = num_segments;
+    }
+    ++num_segments;
+}
+
+// The union-find forest is updated in place by several threads, so the
+// Int32 parents are accessed as atomics.
+static_assert(sizeof(std::atomic<int32_t>) == sizeof(int32_t),
+              "std::atomic<int32_t> must have the size of int32_t.");
+
+/// Returns the root of \p x, halving the path on the way.
+static int32_t FindRoot(std::atomic<int32_t>* parents, int32_t x) {
+    int32_t parent = parents[x].load(std::memory_order_relaxed);
+    while (parent != x) {
+        const int32_t grandparent =
+                parents[parent].load(std::memory_order_relaxed);
+        // A non-root never becomes a root again, so pointing it to an
+        // ancestor is safe under concurrent updates.
+        if (grandparent != parent) {
+            parents[x].store(grandparent, std::memory_order_relaxed);
+        }
+        x = parent;
+        parent = grandparent;
+    }
+    return x;
+}
+
+/// Merges the trees of \p a and \p b, linking the larger root under the
+/// smaller one.
+static void Union(std::atomic<int32_t>* parents, int32_t a, int32_t b) {
+    while (true) {
+        a = FindRoot(parents, a);
+        b = FindRoot(parents, b);
+        if (a == b) {
+            return;
+        }
+        if (a < b) {
+            std::swap(a, b);
+        }
+        int32_t expected = a;
+        if (parents[a].compare_exchange_strong(expected, b)) {
+            return;
+        }
+    }
+}
+
+void UnionCoreNeighborsCPU(const core::Tensor& query_indices,
+                           const core::Tensor& neighbors_index,
+                           const core::Tensor& neighbors_row_splits,
+                           const core::Tensor& is_core,
+                           core::Tensor& parents) {
+    const int64_t* query_indices_ptr = query_indices.GetDataPtr<int64_t>();
+    const int32_t* neighbors_index_ptr = neighbors_index.GetDataPtr<int32_t>();
+    const int64_t* row_splits_ptr = neighbors_row_splits.GetDataPtr<int64_t>();
+    const bool* is_core_ptr = is_core.GetDataPtr<bool>();
+    std::atomic<int32_t>* parents_ptr =
+            reinterpret_cast<std::atomic<int32_t>*>(
+                    parents.GetDataPtr<int32_t>());
+
+    core::ParallelFor(
+            core::Device("CPU:0"), query_indices.GetLength(), [&](int64_t i) {
+                const int32_t query =
+                        static_cast<int32_t>(query_indices_ptr[i]);
+                for (int64_t k = row_splits_ptr[i]; k < row_splits_ptr[i + 1];
+                     ++k) {
+                    // Every edge between core points is seen from both ends,
+                    // so linking it from one end is enough.
+                    const int32_t neighbor = neighbors_index_ptr[k];
+                    if (neighbor < query && is_core_ptr[neighbor]) {
+                        Union(parents_ptr, query, neighbor);
+                    }
+                }
+            });
+}
+
+void CompressUnionFindCPU(core::Tensor& parents) {
+    std::atomic<int32_t>* parents_ptr =
+            reinterpret_cast<std::atomic<int32_t>*>(
+                    parents.GetDataPtr<int32_t>());
+    core::ParallelFor(
+            core::Device("CPU:0"), parents.GetLength(), [&](int64_t i) {
+                const int32_t root =
+                        FindRoot(parents_ptr, static_cast<int32_t>(i));
+                parents_ptr[i].store(root, std::memory_order_relaxed);
+            });
+}
+
+void AssignBorderLabelsCPU(const core::Tensor& query_indices,
+                           const core::Tensor& neighbors_index,
+                           const core::Tensor& neighbors_row_splits,
+                           const core::Tensor& is_core,
+                           core::Tensor& labels) {
+    const int64_t* query_indices_ptr = query_indices.GetDataPtr<int64_t>();
+    const int32_t* neighbors_index_ptr = neighbors_index.GetDataPtr<int32_t>();
+    const int64_t* row_splits_ptr = neighbors_row_splits.GetDataPtr<int64_t>();
+    const bool* is_core_ptr = is_core.GetDataPtr<bool>();
+    int32_t* labels_ptr = labels.GetDataPtr<int32_t>();
+
+    core::ParallelFor(
+            core::Device("CPU:0"), query_indices.GetLength(), [&](int64_t i) {
+                int32_t label = -1;
+                for (int64_t k = row_splits_ptr[i]; k < row_splits_ptr[i + 1];
+                     ++k) {
+                    const int32_t neighbor = neighbors_index_ptr[k];
+                    if (is_core_ptr[neighbor] &&
+                        (label < 0 || labels_ptr[neighbor] < label)) {
+                        label = labels_ptr[neighbor];
+                    }
+                }
+                labels_ptr[query_indices_ptr[i]] = label;
+            });
+}
+
+template <typename scalar_t>
+static scalar_t CastMean(double mean) {
+    return std::is_integral<scalar_t>::value
+                   ? static_cast<scalar_t>(std::round(mean))
+                   : static_cast<scalar_t>(mean);
+}
+
+void SegmentReduceCPU(const core::Tensor& segment_ids,
+                      int64_t num_segments,
+                      SegmentReduction reduction,
+                      const std::vector<core::Tensor>& values,
+                      std::vector<core::Tensor>& reduced) {
+    const int64_t num_rows = segment_ids.GetLength();
+    const core::Tensor segment_ids_c = segment_ids.Contiguous();
+    const int64_t* segment_ids_ptr = segment_ids_c.GetDataPtr<int64_t>();
+
+    // Counting sort of the row indices by segment id. The sort is stable, so
+    // the rows of each segment are contiguous in `order` and keep their input
+    // order, and every segment is then reduced by one thread.
+    std::vector<int64_t> offsets(num_segments + 1, 0);
+    for (int64_t i = 0; i < num_rows; ++i) {
+        ++offsets[segment_ids_ptr[i] + 1];
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    std::vector<int64_t> cursors(offsets.begin(), offsets.end() - 1);
+    std::vector<int64_t> order(num_rows);
+    for (int64_t i = 0; i < num_rows; ++i) {
+        order[cursors[segment_ids_ptr[i]]++] = i;
+    }
+
+    reduced.clear();
+    if (reduction == SegmentReduction::First) {
+        core::Tensor first_indices =
+                core::Tensor::Empty({num_segments}, core::Int64);
+        int64_t* first_indices_ptr = first_indices.GetDataPtr<int64_t>();
+        for (int64_t s = 0; s < num_segments; ++s) {
+            first_indices_ptr[s] = order[offsets[s]];
+        }
+        for (const core::Tensor& value : values) {
+            reduced.push_back(value.IndexGet({first_indices}));
+        }
+        return;
+    }
+
+    for (const core::Tensor& value : values) {
+        const core::Tensor value_c = value.Contiguous();
+        const int64_t stride = value_c.GetStride(0);
+        core::SizeVector shape = value_c.GetShape();
+        shape[0] = num_segments;
+        core::Tensor result = core::Tensor::Empty(shape, value_c.GetDtype(),
+                                                  value.GetDevice());
+
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(value_c.GetDtype(), [&]() {
+            const scalar_t* src_ptr = value_c.GetDataPtr<scalar_t>();
+            scalar_t* dst_ptr = result.GetDataPtr<scalar_t>();
+            core::ParallelFor(
+                    core::Device("CPU:0"), num_segments, [&](int64_t s) {
+                        const int64_t begin = offsets[s];
+                        const int64_t end = offsets[s + 1];
+                        scalar_t* dst = dst_ptr + s * stride;
+                        const scalar_t* first = src_ptr + order[begin] * stride;
+                        std::copy(first, first + stride, dst);
+                        if (reduction == SegmentReduction::Mean) {
+                            for (int64_t c = 0; c < stride; ++c) {
+                                double sum = 0;
+                                for (int64_t k = begin; k < end; ++k) {
+                                    sum += src_ptr[order[k] * stride + c];
+                                }
+                                dst[c] = CastMean<scalar_t>(
+                                        sum / static_cast<double>(end - begin));
+                            }
+                            return;
+                        }
+                        for (int64_t k = begin + 1; k < end; ++k) {
+                            const scalar_t* src = src_ptr + order[k] * stride;
+                            for (int64_t c = 0; c < stride; ++c) {
+                                dst[c] = reduction == SegmentReduction::Min
+                                                 ? std::min(dst[c], src[c])
+                                                 : std::max(dst[c], src[c]);
+                            }
+                        }
+                    });
+        });
+        reduced.push_back(result);
+    }
+}
+
 }  // namespace pointcloud
 }  // namespace kernel
 }  // namespace geometry
@@ -24,6 +24,8 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <limits>
+
 #include "open3d/t/geometry/kernel/PointCloudImpl.h"
 
 namespace open3d {
@@ -116,6 +118,309 @@ void ProjectCUDA(
             });
 }
 
+void FarthestPointDownSampleCUDA(const core::Tensor& points,
+                                 int64_t num_samples,
+                                 core::Tensor& sample_indices) {
+    const core::Device device = points.GetDevice();
+    const int64_t num_points = points.GetLength();
+    sample_indices = core::Tensor::Zeros({num_samples}, core::Int64, device);
+    int64_t* sample_indices_ptr = sample_indices.GetDataPtr<int64_t>();
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        core::Tensor distances = core::Tensor::Full(
+                {num_points}, std::numeric_limits<scalar_t>::infinity(),
+                points.GetDtype(), device);
+        const scalar_t* points_ptr = points.GetDataPtr<scalar_t>();
+        scalar_t* distances_ptr = distances.GetDataPtr<scalar_t>();
+
+        for (int64_t i = 1; i < num_samples; ++i) {
+            // The previous sample is read on the device, so the loop does not
+            // synchronize with the host.
+            core::ParallelFor(
+                    device, num_points, [=] OPEN3D_DEVICE(int64_t j) {
+                        const int64_t s = sample_indices_ptr[i - 1];
+                        const scalar_t dx =
+                                points_ptr[3 * j + 0] - points_ptr[3 * s + 0];
+                        const scalar_t dy =
+                                points_ptr[3 * j + 1] - points_ptr[3 * s + 1];
+                        const scalar_t dz =
+                                points_ptr[3 * j + 2] - points_ptr[3 * s + 2];
+                        const scalar_t dist = dx * dx + dy * dy + dz * dz;
+                        if (dist < distances_ptr[j]) {
+                            distances_ptr[j] = dist;
+                        }
+                    });
+            sample_indices.Slice(0, i, i + 1) =
+                    distances.ArgMax({0}).Reshape({1});
+        }
+    });
+}
+
+/// Returns the root of \p x, halving the path on the way. Parents are read
+/// through a volatile pointer to see the links made by other threads.
+static __device__ int32_t FindRoot(volatile int32_t* parents, int32_t x) {
+    int32_t parent = parents[x];
+    while (parent != x) {
+        const int32_t grandparent = parents[parent];
+        // A non-root never becomes a root again, so pointing it to an
+        // ancestor is safe under concurrent updates.
+        if (grandparent != parent) {
+            parents[x] = grandparent;
+        }
+        x = parent;
+        parent = grandparent;
+    }
+    return x;
+}
+
+/// Merges the trees of \p a and \p b, linking the larger root under the
+/// smaller one.
+static __device__ void Union(int32_t* parents, int32_t a, int32_t b) {
+    while (true) {
+        a = FindRoot(parents, a);
+        b = FindRoot(parents, b);
+        if (a == b) {
+            return;
+        }
+        if (a < b) {
+            const int32_t tmp = a;
+            a = b;
+            b = tmp;
+        }
+        if (atomicCAS(&parents[a], a, b) == a) {
+            return;
+        }
+    }
+}
+
+void UnionCoreNeighborsCUDA(const core::Tensor& query_indices,
+                            const core::Tensor& neighbors_index,
+                            const core::Tensor& neighbors_row_splits,
+                            const core::Tensor& is_core,
+                            core::Tensor& parents) {
+    const int64_t* query_indices_ptr = query_indices.GetDataPtr<int64_t>();
+    const int32_t* neighbors_index_ptr = neighbors_index.GetDataPtr<int32_t>();
+    const int64_t* row_splits_ptr = neighbors_row_splits.GetDataPtr<int64_t>();
+    const bool* is_core_ptr = is_core.GetDataPtr<bool>();
+    int32_t* parents_ptr = parents.GetDataPtr<int32_t>();
+
+    core::ParallelFor(
+            parents.GetDevice(), query_indices.GetLength(),
+            [=] OPEN3D_DEVICE(int64_t i) {
+                const int32_t query =
+                        static_cast<int32_t>(query_indices_ptr[i]);
+                for (int64_t k = row_splits_ptr[i]; k < row_splits_ptr[i + 1];
+                     ++k) {
+                    const int32_t neighbor = neighbors_index_ptr[k];
+                    if (neighbor < query && is_core_ptr[neighbor]) {
+                        Union(parents_ptr, query, neighbor);
+                    }
+                }
+            });
+}
+
+void CompressUnionFindCUDA(core::Tensor& parents) {
+    int32_t* parents_ptr = parents.GetDataPtr<int32_t>();
+    core::ParallelFor(parents.GetDevice(), parents.GetLength(),
+                      [=] OPEN3D_DEVICE(int64_t i) {
+                          parents_ptr[i] = FindRoot(parents_ptr,
+                                                    static_cast<int32_t>(i));
+                      });
+}
+
+void AssignBorderLabelsCUDA(const core::Tensor& query_indices,
+                            const core::Tensor& neighbors_index,
+                            const core::Tensor& neighbors_row_splits,
+                            const core::Tensor& is_core,
+                            core::Tensor& labels) {
+    const int64_t* query_indices_ptr = query_indices.GetDataPtr<int64_t>();
+    const int32_t* neighbors_index_ptr = neighbors_index.GetDataPtr<int32_t>();
+    const int64_t* row_splits_ptr = neighbors_row_splits.GetDataPtr<int64_t>();
+    const bool* is_core_ptr = is_core.GetDataPtr<bool>();
+    int32_t* labels_ptr = labels.GetDataPtr<int32_t>();
+
+    core::ParallelFor(
+            labels.GetDevice(), query_indices.GetLength(),
+            [=] OPEN3D_DEVICE(int64_t i) {
+                int32_t label = -1;
+                for (int64_t k = row_splits_ptr[i]; k < row_splits_ptr[i + 1];
+                     ++k) {
+                    const int32_t neighbor = neighbors_index_ptr[k];
+                    if (is_core_ptr[neighbor] &&
+                        (label < 0 || labels_ptr[neighbor] < label)) {
+                        label = labels_ptr[neighbor];
+                    }
+                }
+                labels_ptr[query_indices_ptr[i]] = label;
+            });
+}
+
+/// Atomically replaces *address with value if value is smaller (kIsMin) or
+/// larger (!kIsMin).
+template <bool kIsMin>
+__device__ void AtomicMinMaxDouble(double* address, double value) {
+    unsigned long long int* address_as_ull =
+            reinterpret_cast<unsigned long long int*>(address);
+    unsigned long long int old = *address_as_ull, assumed;
+    while (kIsMin ? value < __longlong_as_double(old)
+                  : value > __longlong_as_double(old)) {
+        assumed = old;
+        old = atomicCAS(address_as_ull, assumed, __double_as_longlong(value));
+        if (old == assumed) {
+            break;
+        }
+    }
+}
+
+__device__ void AtomicSegmentReduce(double* address,
+                                    double value,
+                                    SegmentReduction reduction) {
+    if (reduction == SegmentReduction::Mean) {
+        atomicAdd(address, value);
+    } else if (reduction == SegmentReduction::Min) {
+        AtomicMinMaxDouble<true>(address, value);
+    } else {
+        AtomicMinMaxDouble<false>(address, value);
+    }
+}
+
+// Integer values are only reduced with min and max, which need no rounding.
+template <typename acc_t>
+__device__ void AtomicSegmentReduce(acc_t* address,
+                                    acc_t value,
+                                    SegmentReduction reduction) {
+    if (reduction == SegmentReduction::Min) {
+        atomicMin(address, value);
+    } else {
+        atomicMax(address, value);
+    }
+}
+
+template <typename scalar_t, typename acc_t>
+void SegmentAccumulateCUDA(const core::Device& device,
+                           const int64_t* segment_ids_ptr,
+                           int64_t num_rows,
+                           int64_t stride,
+                           SegmentReduction reduction,
+                           const scalar_t* src_ptr,
+                           acc_t* result_ptr) {
+    core::ParallelFor(device, num_rows * stride, [=] OPEN3D_DEVICE(int64_t w) {
+        const int64_t i = w / stride;
+        const int64_t c = w % stride;
+        AtomicSegmentReduce(result_ptr + segment_ids_ptr[i] * stride + c,
+                            static_cast<acc_t>(src_ptr[w]), reduction);
+    });
+}
+
+void SegmentReduceCUDA(const core::Tensor& segment_ids,
+                       int64_t num_segments,
+                       SegmentReduction reduction,
+                       const std::vector<core::Tensor>& values,
+                       std::vector<core::Tensor>& reduced) {
+    const core::Device device = segment_ids.GetDevice();
+    const int64_t num_rows = segment_ids.GetLength();
+    const core::Tensor segment_ids_c = segment_ids.Contiguous();
+    const int64_t* segment_ids_ptr = segment_ids_c.GetDataPtr<int64_t>();
+
+    reduced.clear();
+    if (reduction == SegmentReduction::First) {
+        core::Tensor first_indices = core::Tensor::Full(
+                {num_segments}, num_rows, core::Int64, device);
+        unsigned long long int* first_indices_ptr =
+                reinterpret_cast<unsigned long long int*>(
+                        first_indices.GetDataPtr<int64_t>());
+        core::ParallelFor(device, num_rows, [=] OPEN3D_DEVICE(int64_t i) {
+            atomicMin(&first_indices_ptr[segment_ids_ptr[i]],
+                      static_cast<unsigned long long int>(i));
+        });
+        for (const core::Tensor& value : values) {
+            reduced.push_back(value.IndexGet({first_indices}));
+        }
+        return;
+    }
+
+    core::Tensor counts;
+    if (reduction == SegmentReduction::Mean) {
+        counts = core::Tensor::Zeros({num_segments}, core::Float64, device);
+        double* counts_ptr = counts.GetDataPtr<double>();
+        core::ParallelFor(device, num_rows, [=] OPEN3D_DEVICE(int64_t i) {
+            atomicAdd(&counts_ptr[segment_ids_ptr[i]], 1.0);
+        });
+    }
+
+    // Rows are accumulated with atomics and converted back to the dtype of
+    // each tensor at the end. Means and floating point values use Float64,
+    // min and max of integer and Bool values use 64-bit integers so that
+    // they stay exact.
+    for (const core::Tensor& value : values) {
+        const core::Tensor value_c = value.Contiguous();
+        const core::Dtype dtype = value_c.GetDtype();
+        const int64_t stride = value_c.GetStride(0);
+        core::SizeVector shape = value_c.GetShape();
+        shape[0] = num_segments;
+
+        core::Dtype acc_dtype = core::Float64;
+        if (reduction != SegmentReduction::Mean && dtype != core::Float32 &&
+            dtype != core::Float64) {
+            acc_dtype = dtype == core::UInt64 ? core::UInt64 : core::Int64;
+        }
+        core::Tensor result;
+        if (reduction == SegmentReduction::Mean) {
+            result = core::Tensor::Zeros(shape, acc_dtype, device);
+        } else if (acc_dtype == core::Float64) {
+            const double inf = std::numeric_limits<double>::infinity();
+            result = core::Tensor::Full(
+                    shape, reduction == SegmentReduction::Min ? inf : -inf,
+                    acc_dtype, device);
+        } else if (acc_dtype == core::Int64) {
+            result = core::Tensor::Full(
+                    shape,
+                    reduction == SegmentReduction::Min
+                            ? std::numeric_limits<int64_t>::max()
+                            : std::numeric_limits<int64_t>::min(),
+                    acc_dtype, device);
+        } else {
+            result = core::Tensor::Full(
+                    shape,
+                    reduction == SegmentReduction::Min
+                            ? std::numeric_limits<uint64_t>::max()
+                            : std::numeric_limits<uint64_t>::min(),
+                    acc_dtype, device);
+        }
+
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype, [&]() {
+            const scalar_t* src_ptr = value_c.GetDataPtr<scalar_t>();
+            if (acc_dtype == core::Float64) {
+                SegmentAccumulateCUDA(device, segment_ids_ptr, num_rows,
+                                      stride, reduction, src_ptr,
+                                      result.GetDataPtr<double>());
+            } else if (acc_dtype == core::Int64) {
+                SegmentAccumulateCUDA(
+                        device, segment_ids_ptr, num_rows, stride, reduction,
+                        src_ptr,
+                        reinterpret_cast<long long int*>(
+                                result.GetDataPtr<int64_t>()));
+            } else {
+                SegmentAccumulateCUDA(
+                        device, segment_ids_ptr, num_rows, stride, reduction,
+                        src_ptr,
+                        reinterpret_cast<unsigned long long int*>(
+                                result.GetDataPtr<uint64_t>()));
+            }
+        });
+
+        if (reduction == SegmentReduction::Mean) {
+            core::SizeVector counts_shape(shape.size(), 1);
+            counts_shape[0] = num_segments;
+            result = result / counts.Reshape(counts_shape);
+            if (dtype != core::Float32 && dtype != core::Float64) {
+                result = result.Round();
+            }
+        }
+        reduced.push_back(result.To(dtype));
+    }
+}
+
 }  // namespace pointcloud
 }  // namespace kernel
 }  // namespace geometry
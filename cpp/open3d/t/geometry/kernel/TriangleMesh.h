@@ -0,0 +1,68 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace trianglemesh {
+
+/// Simplifies the mesh with Float64 \p vertex_positions of shape (N, 3) and
+/// Int64 \p triangle_indices of shape (M, 3) by quadric error edge collapses.
+/// Every round collapses a batch of the cheapest edges whose one-rings do not
+/// overlap, so the collapses of a round can be applied in parallel.
+///
+/// \param target_number_of_triangles The decimation stops once the mesh has
+/// at most this many triangles.
+/// \param maximum_error Edges with a larger quadric error are not collapsed.
+/// \param boundary_weight Weight of the quadrics that preserve boundaries.
+/// \param new_vertex_positions Float64 positions of the N' remaining
+/// vertices.
+/// \param new_triangle_indices Int64 indices into the remaining vertices of
+/// the M' remaining triangles.
+/// \param vertex_segment_ids Int64 tensor of shape (N,) with the remaining
+/// vertex each input vertex has been collapsed into.
+/// \param triangle_ids Int64 tensor of shape (M',) with the input triangle
+/// each remaining triangle originates from.
+void SimplifyQuadricDecimationCPU(const core::Tensor& vertex_positions,
+                                  const core::Tensor& triangle_indices,
+                                  int64_t target_number_of_triangles,
+                                  double maximum_error,
+                                  double boundary_weight,
+                                  core::Tensor& new_vertex_positions,
+                                  core::Tensor& new_triangle_indices,
+                                  core::Tensor& vertex_segment_ids,
+                                  core::Tensor& triangle_ids);
+
+}  // namespace trianglemesh
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,487 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <tbb/parallel_sort.h>
+
+#include <Eigen/Core>
+#include <Eigen/Dense>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/TensorCheck.h"
+#include "open3d/t/geometry/kernel/TriangleMesh.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace trianglemesh {
+
+/// Each round only considers this fraction of the cheapest collapsible edges,
+/// so that a batch does not reach for expensive edges while cheaper ones are
+/// merely blocked by the current batch.
+static constexpr double kCandidateFraction = 0.25;
+
+/// Error quadric that is used to minimize the squared distance of a point to
+/// its neighbouring triangle planes.
+/// Cf. "Surface Simplification Using Quadric Error Metrics" by Garland and
+/// Heckbert.
+struct Quadric {
+    Quadric() : A_(Eigen::Matrix3d::Zero()), b_(Eigen::Vector3d::Zero()) {}
+
+    Quadric(const Eigen::Vector4d& plane, double weight) {
+        const Eigen::Vector3d n = plane.head<3>();
+        A_ = weight * n * n.transpose();
+        b_ = weight * plane(3) * n;
+        c_ = weight * plane(3) * plane(3);
+    }
+
+    Quadric& operator+=(const Quadric& other) {
+        A_ += other.A_;
+        b_ += other.b_;
+        c_ += other.c_;
+        return *this;
+    }
+
+    Quadric operator+(const Quadric& other) const {
+        Quadric res = *this;
+        res += other;
+        return res;
+    }
+
+    double Eval(const Eigen::Vector3d& v) const {
+        return v.dot(A_ * v) + 2 * b_.dot(v) + c_;
+    }
+
+    bool IsInvertible() const { return std::fabs(A_.determinant()) > 1e-4; }
+
+    Eigen::Vector3d Minimum() const { return -A_.ldlt().solve(b_); }
+
+    Eigen::Matrix3d A_;
+    Eigen::Vector3d b_;
+    double c_ = 0;
+};
+
+/// Triangle side, stored with its end points in ascending order.
+struct HalfEdge {
+    int64_t v0_;
+    int64_t v1_;
+    int64_t triangle_;
+    int64_t corner_;
+
+    bool operator<(const HalfEdge& other) const {
+        return std::tie(v0_, v1_, triangle_) <
+               std::tie(other.v0_, other.v1_, other.triangle_);
+    }
+};
+
+/// Unique edge, made of half_edges[first_:first_ + count_].
+struct Edge {
+    int64_t v0_;
+    int64_t v1_;
+    int64_t first_;
+    int64_t count_;
+};
+
+static Eigen::Vector4d ComputeTrianglePlane(const Eigen::Vector3d& p0,
+                                            const Eigen::Vector3d& p1,
+                                            const Eigen::Vector3d& p2) {
+    Eigen::Vector3d abc = (p1 - p0).cross(p2 - p0);
+    const double norm = abc.norm();
+    // If the three points are co-linear, return invalid plane.
+    if (norm == 0) {
+        return Eigen::Vector4d(0, 0, 0, 0);
+    }
+    abc /= norm;
+    return Eigen::Vector4d(abc(0), abc(1), abc(2), -abc.dot(p0));
+}
+
+/// Lists the triangles of every vertex v in
+/// vertex_triangles[offsets[v]:offsets[v + 1]].
+static void BuildVertexTriangles(const std::vector<int64_t>& triangles,
+                                 int64_t num_vertices,
+                                 std::vector<int64_t>& offsets,
+                                 std::vector<int64_t>& vertex_triangles) {
+    const int64_t num_corners = static_cast<int64_t>(triangles.size());
+    offsets.assign(num_vertices + 1, 0);
+    std::atomic<int64_t>* counts_ptr =
+            reinterpret_cast<std::atomic<int64_t>*>(offsets.data() + 1);
+    core::ParallelFor(core::Device("CPU:0"), num_corners, [&](int64_t i) {
+        counts_ptr[triangles[i]].fetch_add(1, std::memory_order_relaxed);
+    });
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    std::vector<int64_t> cursors(offsets.begin(), offsets.end() - 1);
+    std::atomic<int64_t>* cursors_ptr =
+            reinterpret_cast<std::atomic<int64_t>*>(cursors.data());
+    vertex_triangles.resize(num_corners);
+    core::ParallelFor(core::Device("CPU:0"), num_corners, [&](int64_t i) {
+        const int64_t pos = cursors_ptr[triangles[i]].fetch_add(
+                1, std::memory_order_relaxed);
+        vertex_triangles[pos] = i / 3;
+    });
+}
+
+/// Groups the sides of all triangles into unique edges.
+static void BuildEdges(const std::vector<int64_t>& triangles,
+                       std::vector<HalfEdge>& half_edges,
+                       std::vector<Edge>& edges) {
+    const int64_t num_corners = static_cast<int64_t>(triangles.size());
+    half_edges.resize(num_corners);
+    core::ParallelFor(core::Device("CPU:0"), num_corners, [&](int64_t i) {
+        const int64_t t = i / 3;
+        const int64_t v0 = triangles[i];
+        const int64_t v1 = triangles[3 * t + (i + 1) % 3];
+        half_edges[i] = {std::min(v0, v1), std::max(v0, v1), t, i % 3};
+    });
+    tbb::parallel_sort(half_edges.begin(), half_edges.end());
+
+    edges.clear();
+    for (int64_t i = 0; i < num_corners; ++i) {
+        const HalfEdge& half_edge = half_edges[i];
+        if (!edges.empty() && edges.back().v0_ == half_edge.v0_ &&
+            edges.back().v1_ == half_edge.v1_) {
+            ++edges.back().count_;
+        } else {
+            edges.push_back({half_edge.v0_, half_edge.v1_, i, 1});
+        }
+    }
+}
+
+/// Returns true if moving \p vertex to \p target flips the normal of one of
+/// its triangles that does not also contain \p other.
+static bool FlipsTriangle(int64_t vertex,
+                          int64_t other,
+                          const Eigen::Vector3d& target,
+                          const std::vector<Eigen::Vector3d>& positions,
+                          const std::vector<int64_t>& triangles,
+                          const std::vector<int64_t>& offsets,
+                          const std::vector<int64_t>& vertex_triangles) {
+    for (int64_t i = offsets[vertex]; i < offsets[vertex + 1]; ++i) {
+        const int64_t* triangle = &triangles[3 * vertex_triangles[i]];
+        if (triangle[0] == other || triangle[1] == other ||
+            triangle[2] == other) {
+            continue;
+        }
+        Eigen::Vector3d verts[3];
+        for (int k = 0; k < 3; ++k) {
+            verts[k] = positions[triangle[k]];
+        }
+        const Eigen::Vector3d norm_before =
+                (verts[1] - verts[0]).cross(verts[2] - verts[0]);
+        for (int k = 0; k < 3; ++k) {
+            if (triangle[k] == vertex) {
+                verts[k] = target;
+            }
+        }
+        const Eigen::Vector3d norm_after =
+                (verts[1] - verts[0]).cross(verts[2] - verts[0]);
+        if (norm_before.dot(norm_after) < 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/// Computes the error quadrics of all vertices, including the perpendicular
+/// plane quadrics of the boundary edges.
+static void ComputeQuadrics(const std::vector<Eigen::Vector3d>& positions,
+                            const std::vector<int64_t>& triangles,
+                            const std::vector<int64_t>& offsets,
+                            const std::vector<int64_t>& vertex_triangles,
+                            const std::vector<HalfEdge>& half_edges,
+                            const std::vector<Edge>& edges,
+                            double boundary_weight,
+                            std::vector<Quadric>& quadrics) {
+    const int64_t num_triangles = static_cast<int64_t>(triangles.size()) / 3;
+    std::vector<Quadric> triangle_quadrics(num_triangles);
+    std::vector<double> triangle_areas(num_triangles);
+    core::ParallelFor(core::Device("CPU:0"), num_triangles, [&](int64_t t) {
+        const Eigen::Vector3d& p0 = positions[triangles[3 * t + 0]];
+        const Eigen::Vector3d& p1 = positions[triangles[3 * t + 1]];
+        const Eigen::Vector3d& p2 = positions[triangles[3 * t + 2]];
+        triangle_areas[t] = 0.5 * (p1 - p0).cross(p2 - p0).norm();
+        triangle_quadrics[t] = Quadric(ComputeTrianglePlane(p0, p1, p2),
+                                       triangle_areas[t]);
+    });
+
+    const int64_t num_vertices = static_cast<int64_t>(quadrics.size());
+    core::ParallelFor(core::Device("CPU:0"), num_vertices, [&](int64_t v) {
+        for (int64_t i = offsets[v]; i < offsets[v + 1]; ++i) {
+            quadrics[v] += triangle_quadrics[vertex_triangles[i]];
+        }
+    });
+
+    // Boundary edges are rare, so their quadrics are added serially.
+    for (const Edge& edge : edges) {
+        if (edge.count_ != 1) {
+            continue;
+        }
+        const HalfEdge& half_edge = half_edges[edge.first_];
+        const int64_t* triangle = &triangles[3 * half_edge.triangle_];
+        const int64_t v0 = triangle[half_edge.corner_];
+        const int64_t v1 = triangle[(half_edge.corner_ + 1) % 3];
+        const int64_t v2 = triangle[(half_edge.corner_ + 2) % 3];
+        const Eigen::Vector3d& p0 = positions[v0];
+        const Eigen::Vector3d& p1 = positions[v1];
+        const Eigen::Vector3d& p2 = positions[v2];
+        const Eigen::Vector3d p2p = (p2 - p0).cross(p2 - p1);
+        const Quadric quadric(ComputeTrianglePlane(p0, p1, p2p),
+                              triangle_areas[half_edge.triangle_] *
+                                      boundary_weight);
+        quadrics[v0] += quadric;
+        quadrics[v1] += quadric;
+    }
+}
+
+void SimplifyQuadricDecimationCPU(const core::Tensor& vertex_positions,
+                                  const core::Tensor& triangle_indices,
+                                  int64_t target_number_of_triangles,
+                                  double maximum_error,
+                                  double boundary_weight,
+                                  core::Tensor& new_vertex_positions,
+                                  core::Tensor& new_triangle_indices,
+                                  core::Tensor& vertex_segment_ids,
+                                  core::Tensor& triangle_ids) {
+    core::AssertTensorDtype(vertex_positions, core::Float64);
+    core::AssertTensorDtype(triangle_indices, core::Int64);
+
+    const core::Device device("CPU:0");
+    const int64_t num_vertices = vertex_positions.GetLength();
+    int64_t num_triangles = triangle_indices.GetLength();
+
+    const core::Tensor vertex_positions_c = vertex_positions.Contiguous();
+    const double* vertex_positions_ptr =
+            vertex_positions_c.GetDataPtr<double>();
+    std::vector<Eigen::Vector3d> positions(num_vertices);
+    core::ParallelFor(device, num_vertices, [&](int64_t v) {
+        positions[v] = Eigen::Vector3d(vertex_positions_ptr[3 * v + 0],
+                                       vertex_positions_ptr[3 * v + 1],
+                                       vertex_positions_ptr[3 * v + 2]);
+    });
+    const core::Tensor triangle_indices_c = triangle_indices.Contiguous();
+    const int64_t* triangle_indices_ptr =
+            triangle_indices_c.GetDataPtr<int64_t>();
+    std::vector<int64_t> triangles(triangle_indices_ptr,
+                                   triangle_indices_ptr + 3 * num_triangles);
+    std::vector<int64_t> triangle_origins(num_triangles);
+    std::iota(triangle_origins.begin(), triangle_origins.end(), 0);
+
+    // Every collapsed vertex points to the vertex it has been collapsed into.
+    std::vector<int64_t> parents(num_vertices);
+    std::iota(parents.begin(), parents.end(), 0);
+    std::vector<Quadric> quadrics(num_vertices);
+
+    std::vector<int64_t> offsets, vertex_triangles;
+    std::vector<HalfEdge> half_edges;
+    std::vector<Edge> edges;
+    std::vector<Eigen::Vector3d> vbars;
+    std::vector<double> costs;
+    std::vector<uint8_t> collapsible;
+    std::vector<int64_t> candidates, selected;
+    std::vector<uint8_t> locked(num_vertices);
+    std::vector<uint8_t> triangle_alive;
+    bool first_round = true;
+    while (num_triangles > target_number_of_triangles) {
+        BuildVertexTriangles(triangles, num_vertices, offsets,
+                             vertex_triangles);
+        BuildEdges(triangles, half_edges, edges);
+        if (first_round) {
+            ComputeQuadrics(positions, triangles, offsets, vertex_triangles,
+                            half_edges, edges, boundary_weight, quadrics);
+            first_round = false;
+        }
+
+        // Compute the optimal position and the cost of every edge. The
+        // one-rings of the edges collapsed in a round do not overlap, so the
+        // flip test against the positions at the start of the round holds
+        // for the whole round.
+        const int64_t num_edges = static_cast<int64_t>(edges.size());
+        vbars.resize(num_edges);
+        costs.resize(num_edges);
+        collapsible.resize(num_edges);
+        core::ParallelFor(device, num_edges, [&](int64_t e) {
+            const int64_t v0 = edges[e].v0_;
+            const int64_t v1 = edges[e].v1_;
+            const Quadric qbar = quadrics[v0] + quadrics[v1];
+            double cost;
+            Eigen::Vector3d vbar;
+            if (qbar.IsInvertible()) {
+                vbar = qbar.Minimum();
+                cost = qbar.Eval(vbar);
+            } else {
+                const Eigen::Vector3d& p0 = positions[v0];
+                const Eigen::Vector3d& p1 = positions[v1];
+                const Eigen::Vector3d pmid = (p0 + p1) / 2;
+                const double cost0 = qbar.Eval(p0);
+                const double cost1 = qbar.Eval(p1);
+                const double costmid = qbar.Eval(pmid);
+                cost = std::min(cost0, std::min(cost1, costmid));
+                if (cost == costmid) {
+                    vbar = pmid;
+                } else if (cost == cost0) {
+                    vbar = p0;
+                } else {
+                    vbar = p1;
+                }
+            }
+            vbars[e] = vbar;
+            costs[e] = cost;
+            collapsible[e] =
+                    cost <= maximum_error &&
+                    !FlipsTriangle(v0, v1, vbar, positions, triangles,
+                                   offsets, vertex_triangles) &&
+                    !FlipsTriangle(v1, v0, vbar, positions, triangles,
+                                   offsets, vertex_triangles);
+        });
+
+        candidates.clear();
+        for (int64_t e = 0; e < num_edges; ++e) {
+            if (collapsible[e]) {
+                candidates.push_back(e);
+            }
+        }
+        if (candidates.empty()) {
+            break;
+        }
+        tbb::parallel_sort(candidates.begin(), candidates.end(),
+                           [&](int64_t a, int64_t b) {
+                               return std::tie(costs[a], a) <
+                                      std::tie(costs[b], b);
+                           });
+
+        // Greedily select the cheapest edges with disjoint one-rings, until
+        // the collapses would reach the target.
+        const int64_t num_candidates = std::max<int64_t>(
+                1, static_cast<int64_t>(
+                           std::ceil(candidates.size() * kCandidateFraction)));
+        std::fill(locked.begin(), locked.end(), 0);
+        selected.clear();
+        int64_t num_removed = 0;
+        for (int64_t i = 0; i < num_candidates; ++i) {
+            if (num_triangles - num_removed <= target_number_of_triangles) {
+                break;
+            }
+            const Edge& edge = edges[candidates[i]];
+            if (locked[edge.v0_] || locked[edge.v1_]) {
+                continue;
+            }
+            selected.push_back(candidates[i]);
+            num_removed += edge.count_;
+            for (const int64_t v : {edge.v0_, edge.v1_}) {
+                for (int64_t j = offsets[v]; j < offsets[v + 1]; ++j) {
+                    const int64_t t = vertex_triangles[j];
+                    locked[triangles[3 * t + 0]] = 1;
+                    locked[triangles[3 * t + 1]] = 1;
+                    locked[triangles[3 * t + 2]] = 1;
+                }
+            }
+        }
+
+        // Collapse v1 into v0 for all selected edges.
+        core::ParallelFor(
+                device, static_cast<int64_t>(selected.size()),
+                [&](int64_t i) {
+                    const int64_t e = selected[i];
+                    const int64_t v0 = edges[e].v0_;
+                    const int64_t v1 = edges[e].v1_;
+                    positions[v0] = vbars[e];
+                    quadrics[v0] += quadrics[v1];
+                    parents[v1] = v0;
+                });
+
+        // Reconnect the triangles and drop the ones that became degenerate.
+        triangle_alive.resize(num_triangles);
+        core::ParallelFor(device, num_triangles, [&](int64_t t) {
+            int64_t* triangle = &triangles[3 * t];
+            triangle[0] = parents[triangle[0]];
+            triangle[1] = parents[triangle[1]];
+            triangle[2] = parents[triangle[2]];
+            triangle_alive[t] = triangle[0] != triangle[1] &&
+                                triangle[1] != triangle[2] &&
+                                triangle[2] != triangle[0];
+        });
+        int64_t next_free = 0;
+        for (int64_t t = 0; t < num_triangles; ++t) {
+            if (triangle_alive[t]) {
+                std::copy(&triangles[3 * t], &triangles[3 * t + 3],
+                          &triangles[3 * next_free]);
+                triangle_origins[next_free] = triangle_origins[t];
+                ++next_free;
+            }
+        }
+        num_triangles = next_free;
+        triangles.resize(3 * num_triangles);
+        triangle_origins.resize(num_triangles);
+    }
+
+    // Number the remaining vertices and map every vertex to its root.
+    std::vector<int64_t> new_ids(num_vertices);
+    int64_t num_new_vertices = 0;
+    for (int64_t v = 0; v < num_vertices; ++v) {
+        new_ids[v] = parents[v] == v ? num_new_vertices++ : -1;
+    }
+
+    new_vertex_positions =
+            core::Tensor::Empty({num_new_vertices, 3}, core::Float64, device);
+    double* new_vertex_positions_ptr =
+            new_vertex_positions.GetDataPtr<double>();
+    vertex_segment_ids =
+            core::Tensor::Empty({num_vertices}, core::Int64, device);
+    int64_t* vertex_segment_ids_ptr = vertex_segment_ids.GetDataPtr<int64_t>();
+    core::ParallelFor(device, num_vertices, [&](int64_t v) {
+        int64_t root = v;
+        while (parents[root] != root) {
+            root = parents[root];
+        }
+        vertex_segment_ids_ptr[v] = new_ids[root];
+        if (root == v) {
+            Eigen::Map<Eigen::Vector3d>(new_vertex_positions_ptr +
+                                        3 * new_ids[v]) = positions[v];
+        }
+    });
+
+    new_triangle_indices =
+            core::Tensor::Empty({num_triangles, 3}, core::Int64, device);
+    int64_t* new_triangle_indices_ptr =
+            new_triangle_indices.GetDataPtr<int64_t>();
+    core::ParallelFor(device, 3 * num_triangles, [&](int64_t i) {
+        new_triangle_indices_ptr[i] = new_ids[triangles[i]];
+    });
+    triangle_ids = core::Tensor(triangle_origins, {num_triangles},
+                                core::Int64, device);
+}
+
+}  // namespace trianglemesh
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
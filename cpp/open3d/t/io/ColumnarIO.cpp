@@ -0,0 +1,878 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/ColumnarIO.h"
+
+#include <liblzf/lzf.h>
+#include <zlib.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include "open3d/core/Blob.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/t/io/PointCloudIO.h"
+#include "open3d/t/io/TriangleMeshIO.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+static constexpr char kColumnarMagic[8] = {'O', '3', 'D', 'C',
+                                           'O', 'L', '0', '1'};
+static constexpr int64_t kColumnarAlignment = 64;
+// Directory offset and size, directory CRC32 and the magic.
+static constexpr int64_t kColumnarFooterSize = 8 + 8 + 4 + 8;
+
+enum class ColumnarGeometryType : uint32_t {
+    PointCloud = 1,
+    TriangleMesh = 2,
+};
+
+namespace {
+
+/// Stored chunk of a column.
+struct ColumnarChunk {
+    ColumnCompression compression_ = ColumnCompression::None;
+    uint64_t offset_ = 0;
+    uint64_t size_ = 0;
+    uint32_t crc_ = 0;
+};
+
+struct ColumnarColumn {
+    std::string name_;
+    core::Dtype dtype_;
+    /// Shape of one element, e.g. {3} for positions.
+    core::SizeVector element_shape_;
+    std::vector<ColumnarChunk> chunks_;
+};
+
+struct ColumnarTable {
+    std::string name_;
+    int64_t length_ = 0;
+    int64_t chunk_size_ = 0;
+    /// Min and max corner of the positions of every chunk, if the table has
+    /// positions.
+    std::vector<double> chunk_bounds_;
+    std::vector<ColumnarColumn> columns_;
+
+    int64_t GetNumChunks() const {
+        return chunk_size_ > 0 ? (length_ + chunk_size_ - 1) / chunk_size_ : 0;
+    }
+    int64_t GetChunkLength(int64_t chunk) const {
+        return std::min(chunk_size_, length_ - chunk * chunk_size_);
+    }
+    const ColumnarColumn *FindColumn(const std::string &name) const {
+        for (const ColumnarColumn &column : columns_) {
+            if (column.name_ == name) return &column;
+        }
+        return nullptr;
+    }
+};
+
+/// Serializes the directory.
+class DirectoryWriter {
+public:
+    template <typename T>
+    void Put(const T &value) {
+        const char *bytes = reinterpret_cast<const char *>(&value);
+        data_.insert(data_.end(), bytes, bytes + sizeof(T));
+    }
+    void PutString(const std::string &value) {
+        Put<uint32_t>(static_cast<uint32_t>(value.size()));
+        data_.insert(data_.end(), value.begin(), value.end());
+    }
+    const std::vector<char> &GetData() const { return data_; }
+
+private:
+    std::vector<char> data_;
+};
+
+/// Deserializes the directory. Reads past the end set the failed flag and
+/// return zeros.
+class DirectoryReader {
+public:
+    DirectoryReader(const char *data, int64_t size)
+        : ptr_(data), end_(data + size) {}
+
+    template <typename T>
+    T Get() {
+        T value{};
+        if (end_ - ptr_ < int64_t(sizeof(T))) {
+            failed_ = true;
+            return value;
+        }
+        std::memcpy(&value, ptr_, sizeof(T));
+        ptr_ += sizeof(T);
+        return value;
+    }
+    std::string GetString() {
+        const uint32_t size = Get<uint32_t>();
+        if (end_ - ptr_ < int64_t(size)) {
+            failed_ = true;
+            return "";
+        }
+        std::string value(ptr_, size);
+        ptr_ += size;
+        return value;
+    }
+    bool HasFailed() const { return failed_; }
+
+private:
+    const char *ptr_;
+    const char *end_;
+    bool failed_ = false;
+};
+
+}  // namespace
+
+static bool IsLittleEndian() {
+    const uint16_t one = 1;
+    return *reinterpret_cast<const uint8_t *>(&one) == 1;
+}
+
+static uint32_t ComputeCRC32(const char *data, int64_t size) {
+    uLong crc = crc32(0L, Z_NULL, 0);
+    // crc32() takes 32 bit lengths.
+    const int64_t max_step = 1 << 30;
+    for (int64_t offset = 0; offset < size; offset += max_step) {
+        crc = crc32(crc, reinterpret_cast<const Bytef *>(data + offset),
+                    static_cast<uInt>(std::min(max_step, size - offset)));
+    }
+    return static_cast<uint32_t>(crc);
+}
+
+static core::Dtype GetDtypeFromName(const std::string &name) {
+    for (const core::Dtype &dtype :
+         {core::Float32, core::Float64, core::Int8, core::Int16, core::Int32,
+          core::Int64, core::UInt8, core::UInt16, core::UInt32, core::UInt64,
+          core::Bool}) {
+        if (dtype.ToString() == name) return dtype;
+    }
+    return core::Undefined;
+}
+
+// Compresses \p size bytes into \p output. Data that does not shrink is
+// stored as is and \p compression is set to None.
+static void CompressChunk(const char *data,
+                          int64_t size,
+                          ColumnCompression &compression,
+                          std::vector<char> &output) {
+    output.clear();
+    if (compression == ColumnCompression::LZF && size > 1) {
+        output.resize(size - 1);
+        output.resize(lzf_compress(data, static_cast<unsigned int>(size),
+                                   output.data(),
+                                   static_cast<unsigned int>(size - 1)));
+    } else if (compression == ColumnCompression::Deflate && size > 0) {
+        uLongf output_size = compressBound(static_cast<uLong>(size));
+        output.resize(output_size);
+        if (compress2(reinterpret_cast<Bytef *>(output.data()), &output_size,
+                      reinterpret_cast<const Bytef *>(data),
+                      static_cast<uLong>(size),
+                      Z_DEFAULT_COMPRESSION) != Z_OK ||
+            int64_t(output_size) >= size) {
+            output_size = 0;
+        }
+        output.resize(output_size);
+    }
+    if (output.empty()) {
+        compression = ColumnCompression::None;
+        output.assign(data, data + size);
+    }
+}
+
+static bool DecompressChunk(const char *data,
+                            int64_t size,
+                            ColumnCompression compression,
+                            char *output,
+                            int64_t output_size) {
+    switch (compression) {
+        case ColumnCompression::None:
+            if (size != output_size) return false;
+            std::memcpy(output, data, size);
+            return true;
+        case ColumnCompression::LZF:
+            return int64_t(lzf_decompress(
+                           data, static_cast<unsigned int>(size), output,
+                           static_cast<unsigned int>(output_size))) ==
+                   output_size;
+        case ColumnCompression::Deflate: {
+            uLongf uncompressed_size = static_cast<uLongf>(output_size);
+            return uncompress(reinterpret_cast<Bytef *>(output),
+                              &uncompressed_size,
+                              reinterpret_cast<const Bytef *>(data),
+                              static_cast<uLong>(size)) == Z_OK &&
+                   int64_t(uncompressed_size) == output_size;
+        }
+    }
+    return false;
+}
+
+// Returns the permutation that sorts \p positions along a Morton curve.
+static core::Tensor ComputeMortonOrder(const core::Tensor &positions) {
+    const int64_t num_points = positions.GetLength();
+    const core::Tensor positions_d =
+            positions.To(core::Float64).Contiguous();
+    const double *points = positions_d.GetDataPtr<double>();
+    double min_bound[3], scale[3];
+    const core::Tensor min_t = positions_d.Min({0});
+    const core::Tensor max_t = positions_d.Max({0});
+    const int levels = 21;
+    for (int d = 0; d < 3; ++d) {
+        min_bound[d] = min_t[d].Item<double>();
+        const double extent = max_t[d].Item<double>() - min_bound[d];
+        scale[d] = extent > 0 ? ((1 << levels) - 1) / extent : 0;
+    }
+    std::vector<uint64_t> codes(num_points);
+    core::ParallelFor(core::Device("CPU:0"), num_points, [&](int64_t i) {
+        uint64_t code = 0;
+        for (int d = 0; d < 3; ++d) {
+            const double cell = (points[i * 3 + d] - min_bound[d]) * scale[d];
+            // NaN coordinates end up in cell 0.
+            const uint64_t key = cell > 0 ? static_cast<uint64_t>(cell) : 0;
+            for (int bit = 0; bit < levels; ++bit) {
+                code |= ((key >> bit) & 1) << (3 * bit + d);
+            }
+        }
+        codes[i] = code;
+    });
+    core::Tensor order = core::Tensor::Empty({num_points}, core::Int64);
+    int64_t *indices = order.GetDataPtr<int64_t>();
+    std::iota(indices, indices + num_points, int64_t(0));
+    std::stable_sort(indices, indices + num_points,
+                     [&](int64_t a, int64_t b) { return codes[a] < codes[b]; });
+    return order;
+}
+
+// Writes the attributes of \p attrs as a table. Chunk payloads are appended
+// to \p file, their locations go to \p directory.
+static bool WriteColumnarTable(FILE *file,
+                               int64_t &file_offset,
+                               const std::string &name,
+                               const geometry::TensorMap &attrs,
+                               const WriteColumnarOption &option,
+                               DirectoryWriter &directory) {
+    ColumnarTable table;
+    table.name_ = name;
+    table.chunk_size_ = option.chunk_size;
+    for (const auto &kv : attrs) {
+        if (kv.second.NumDims() == 0) {
+            utility::LogWarning("Attribute {} is a scalar.", kv.first);
+            return false;
+        }
+        if (table.columns_.empty()) {
+            table.length_ = kv.second.GetLength();
+        } else if (kv.second.GetLength() != table.length_) {
+            utility::LogWarning("Attributes of {} have different lengths.",
+                                name);
+            return false;
+        }
+        ColumnarColumn column;
+        column.name_ = kv.first;
+        column.dtype_ = kv.second.GetDtype();
+        column.element_shape_ = kv.second.GetShape();
+        column.element_shape_.erase(column.element_shape_.begin());
+        table.columns_.push_back(column);
+    }
+    // Columns are written in name order to make files reproducible.
+    std::sort(table.columns_.begin(), table.columns_.end(),
+              [](const ColumnarColumn &a, const ColumnarColumn &b) {
+                  return a.name_ < b.name_;
+              });
+    const int64_t num_chunks = table.GetNumChunks();
+
+    if (attrs.Contains("positions") &&
+        attrs.at("positions").GetShape().IsCompatible({table.length_, 3})) {
+        const core::Tensor positions = attrs.at("positions")
+                                               .To(core::Device("CPU:0"))
+                                               .To(core::Float64)
+                                               .Contiguous();
+        const double *points = positions.GetDataPtr<double>();
+        table.chunk_bounds_.resize(num_chunks * 6);
+        core::ParallelFor(core::Device("CPU:0"), num_chunks, [&](int64_t c) {
+            double *bounds = table.chunk_bounds_.data() + c * 6;
+            std::fill(bounds, bounds + 3,
+                      std::numeric_limits<double>::infinity());
+            std::fill(bounds + 3, bounds + 6,
+                      -std::numeric_limits<double>::infinity());
+            const int64_t begin = c * table.chunk_size_;
+            for (int64_t i = begin; i < begin + table.GetChunkLength(c); ++i) {
+                for (int d = 0; d < 3; ++d) {
+                    bounds[d] = std::min(bounds[d], points[i * 3 + d]);
+                    bounds[d + 3] = std::max(bounds[d + 3], points[i * 3 + d]);
+                }
+            }
+        });
+    }
+
+    for (ColumnarColumn &column : table.columns_) {
+        const core::Tensor data = attrs.at(column.name_)
+                                          .To(core::Device("CPU:0"))
+                                          .Contiguous();
+        const char *bytes = static_cast<const char *>(data.GetDataPtr());
+        const int64_t row_bytes =
+                column.element_shape_.NumElements() * column.dtype_.ByteSize();
+        std::vector<std::vector<char>> payloads(num_chunks);
+        column.chunks_.resize(num_chunks);
+        core::ParallelFor(core::Device("CPU:0"), num_chunks, [&](int64_t c) {
+            ColumnarChunk &chunk = column.chunks_[c];
+            chunk.compression_ = option.compression;
+            CompressChunk(bytes + c * table.chunk_size_ * row_bytes,
+                          table.GetChunkLength(c) * row_bytes,
+                          chunk.compression_, payloads[c]);
+            chunk.size_ = payloads[c].size();
+            chunk.crc_ = ComputeCRC32(payloads[c].data(), chunk.size_);
+        });
+        for (int64_t c = 0; c < num_chunks; ++c) {
+            static const char padding[kColumnarAlignment] = {0};
+            const int64_t padding_size =
+                    (kColumnarAlignment - file_offset % kColumnarAlignment) %
+                    kColumnarAlignment;
+            column.chunks_[c].offset_ = file_offset + padding_size;
+            if (fwrite(padding, 1, padding_size, file) !=
+                        size_t(padding_size) ||
+                fwrite(payloads[c].data(), 1, payloads[c].size(), file) !=
+                        payloads[c].size()) {
+                utility::LogWarning("Failed to write column {}.",
+                                    column.name_);
+                return false;
+            }
+            file_offset += padding_size + payloads[c].size();
+            // Releases the payload once written.
+            std::vector<char>().swap(payloads[c]);
+        }
+    }
+
+    directory.PutString(table.name_);
+    directory.Put<int64_t>(table.length_);
+    directory.Put<int64_t>(table.chunk_size_);
+    directory.Put<uint8_t>(table.chunk_bounds_.empty() ? 0 : 1);
+    for (double bound : table.chunk_bounds_) {
+        directory.Put<double>(bound);
+    }
+    directory.Put<uint32_t>(static_cast<uint32_t>(table.columns_.size()));
+    for (const ColumnarColumn &column : table.columns_) {
+        directory.PutString(column.name_);
+        directory.PutString(column.dtype_.ToString());
+        directory.Put<uint32_t>(
+                static_cast<uint32_t>(column.element_shape_.size()));
+        for (int64_t dim : column.element_shape_) {
+            directory.Put<int64_t>(dim);
+        }
+        for (const ColumnarChunk &chunk : column.chunks_) {
+            directory.Put<uint8_t>(static_cast<uint8_t>(chunk.compression_));
+            directory.Put<uint64_t>(chunk.offset_);
+            directory.Put<uint64_t>(chunk.size_);
+            directory.Put<uint32_t>(chunk.crc_);
+        }
+    }
+    return true;
+}
+
+static bool WriteColumnarFile(
+        const std::string &filename,
+        ColumnarGeometryType geometry_type,
+        const std::vector<std::pair<std::string, const geometry::TensorMap *>>
+                &tables,
+        const WriteColumnarOption &option) {
+    if (!IsLittleEndian()) {
+        utility::LogWarning(
+                "Write O3DC failed: only little-endian hosts are supported.");
+        return false;
+    }
+    if (option.chunk_size <= 0) {
+        utility::LogWarning("Write O3DC failed: invalid chunk size {}.",
+                            option.chunk_size);
+        return false;
+    }
+    utility::filesystem::CFile file;
+    if (!file.Open(filename, "wb")) {
+        utility::LogWarning("Write O3DC failed: unable to open file {}: {}",
+                            filename, file.GetError());
+        return false;
+    }
+    int64_t file_offset = sizeof(kColumnarMagic);
+    if (fwrite(kColumnarMagic, 1, sizeof(kColumnarMagic), file.GetFILE()) !=
+        sizeof(kColumnarMagic)) {
+        utility::LogWarning("Write O3DC failed: unable to write file {}.",
+                            filename);
+        return false;
+    }
+    DirectoryWriter directory;
+    directory.Put<uint32_t>(static_cast<uint32_t>(geometry_type));
+    directory.Put<uint32_t>(static_cast<uint32_t>(tables.size()));
+    for (const auto &table : tables) {
+        if (!WriteColumnarTable(file.GetFILE(), file_offset, table.first,
+                                *table.second, option, directory)) {
+            utility::LogWarning("Write O3DC failed: unable to write {}.",
+                                filename);
+            return false;
+        }
+    }
+    const std::vector<char> &directory_data = directory.GetData();
+    DirectoryWriter footer;
+    footer.Put<uint64_t>(file_offset);
+    footer.Put<uint64_t>(directory_data.size());
+    footer.Put<uint32_t>(
+            ComputeCRC32(directory_data.data(), directory_data.size()));
+    for (char c : kColumnarMagic) {
+        footer.Put<char>(c);
+    }
+    if (fwrite(directory_data.data(), 1, directory_data.size(),
+               file.GetFILE()) != directory_data.size() ||
+        fwrite(footer.GetData().data(), 1, footer.GetData().size(),
+               file.GetFILE()) != footer.GetData().size()) {
+        utility::LogWarning("Write O3DC failed: unable to write file {}.",
+                            filename);
+        return false;
+    }
+    return true;
+}
+
+namespace {
+
+/// An opened O3DC file with its parsed directory.
+class ColumnarFile {
+public:
+    /// If \p memory_map is set, raw columns are returned as views of a
+    /// copy-on-write mapping of the file, see ReadColumn().
+    bool Open(const std::string &filename,
+              ColumnarGeometryType geometry_type,
+              bool memory_map = false) {
+        filename_ = filename;
+        memory_map_ = memory_map;
+        if (!IsLittleEndian()) {
+            utility::LogWarning(
+                    "Read O3DC failed: only little-endian hosts are "
+                    "supported.");
+            return false;
+        }
+        if (!file_->Open(filename, memory_map)) {
+            utility::LogWarning("Read O3DC failed: unable to open file {}: {}",
+                                filename, file_->GetError());
+            return false;
+        }
+        const char *data = file_->GetData();
+        const int64_t size = file_->GetSize();
+        if (size < int64_t(sizeof(kColumnarMagic)) + kColumnarFooterSize ||
+            std::memcmp(data, kColumnarMagic, sizeof(kColumnarMagic)) != 0 ||
+            std::memcmp(data + size - sizeof(kColumnarMagic), kColumnarMagic,
+                        sizeof(kColumnarMagic)) != 0) {
+            utility::LogWarning("Read O3DC failed: {} is not an O3DC file.",
+                                filename);
+            return false;
+        }
+        DirectoryReader footer(data + size - kColumnarFooterSize,
+                               kColumnarFooterSize);
+        const uint64_t directory_offset = footer.Get<uint64_t>();
+        const uint64_t directory_size = footer.Get<uint64_t>();
+        const uint32_t directory_crc = footer.Get<uint32_t>();
+        if (directory_offset > uint64_t(size - kColumnarFooterSize) ||
+            directory_size >
+                    uint64_t(size - kColumnarFooterSize) - directory_offset ||
+            ComputeCRC32(data + directory_offset, directory_size) !=
+                    directory_crc) {
+            utility::LogWarning("Read O3DC failed: corrupted directory in {}.",
+                                filename);
+            return false;
+        }
+        DirectoryReader directory(data + directory_offset, directory_size);
+        if (directory.Get<uint32_t>() != uint32_t(geometry_type)) {
+            utility::LogWarning(
+                    "Read O3DC failed: {} holds a different geometry type.",
+                    filename);
+            return false;
+        }
+        tables_.resize(directory.Get<uint32_t>());
+        for (ColumnarTable &table : tables_) {
+            table.name_ = directory.GetString();
+            table.length_ = directory.Get<int64_t>();
+            table.chunk_size_ = directory.Get<int64_t>();
+            if (table.length_ < 0 || table.chunk_size_ <= 0) break;
+            const int64_t num_chunks = table.GetNumChunks();
+            if (directory.Get<uint8_t>() != 0) {
+                table.chunk_bounds_.resize(num_chunks * 6);
+                for (double &bound : table.chunk_bounds_) {
+                    bound = directory.Get<double>();
+                }
+            }
+            table.columns_.resize(directory.Get<uint32_t>());
+            for (ColumnarColumn &column : table.columns_) {
+                column.name_ = directory.GetString();
+                column.dtype_ = GetDtypeFromName(directory.GetString());
+                column.element_shape_.resize(directory.Get<uint32_t>());
+                for (int64_t &dim : column.element_shape_) {
+                    dim = directory.Get<int64_t>();
+                }
+                column.chunks_.resize(num_chunks);
+                for (ColumnarChunk &chunk : column.chunks_) {
+                    chunk.compression_ = static_cast<ColumnCompression>(
+                            directory.Get<uint8_t>());
+                    chunk.offset_ = directory.Get<uint64_t>();
+                    chunk.size_ = directory.Get<uint64_t>();
+                    chunk.crc_ = directory.Get<uint32_t>();
+                    if (chunk.offset_ > uint64_t(size) ||
+                        chunk.size_ > uint64_t(size) - chunk.offset_) {
+                        return Fail("chunk out of range");
+                    }
+                }
+                if (column.dtype_ == core::Undefined) {
+                    return Fail("unknown dtype");
+                }
+                if (directory.HasFailed()) break;
+            }
+            if (directory.HasFailed()) break;
+        }
+        if (directory.HasFailed()) {
+            return Fail("truncated directory");
+        }
+        return true;
+    }
+
+    const ColumnarTable *FindTable(const std::string &name) const {
+        for (const ColumnarTable &table : tables_) {
+            if (table.name_ == name) return &table;
+        }
+        return nullptr;
+    }
+
+    /// Reads the given chunks of a column into one tensor. With memory
+    /// mapping, chunks that are stored raw and back to back in the file are
+    /// returned as a view of the mapping, which the tensor keeps alive.
+    bool ReadColumn(const ColumnarTable &table,
+                    const ColumnarColumn &column,
+                    const std::vector<int64_t> &chunks,
+                    core::Tensor &tensor) const {
+        std::vector<int64_t> rows(chunks.size() + 1, 0);
+        for (size_t i = 0; i < chunks.size(); ++i) {
+            rows[i + 1] = rows[i] + table.GetChunkLength(chunks[i]);
+        }
+        core::SizeVector shape = column.element_shape_;
+        shape.insert(shape.begin(), rows.back());
+        const int64_t row_bytes =
+                column.element_shape_.NumElements() * column.dtype_.ByteSize();
+        const bool is_view = memory_map_ && rows.back() > 0 &&
+                             IsStoredContiguously(column, chunks, rows,
+                                                  row_bytes);
+        if (is_view) {
+            // The mapping is copy-on-write, so the tensor may be modified.
+            char *data = const_cast<char *>(file_->GetData()) +
+                         column.chunks_[chunks[0]].offset_;
+            std::shared_ptr<utility::filesystem::MappedFile> file = file_;
+            auto blob = std::make_shared<core::Blob>(
+                    core::Device("CPU:0"), data, [file](void *) {});
+            tensor = core::Tensor(shape,
+                                  core::shape_util::DefaultStrides(shape),
+                                  data, column.dtype_, blob);
+        } else {
+            tensor = core::Tensor::Empty(shape, column.dtype_);
+        }
+        char *output = static_cast<char *>(tensor.GetDataPtr());
+        std::vector<uint8_t> valid(chunks.size(), 0);
+        core::ParallelFor(
+                core::Device("CPU:0"), chunks.size(), [&](int64_t i) {
+                    const ColumnarChunk &chunk = column.chunks_[chunks[i]];
+                    const char *data = file_->GetData() + chunk.offset_;
+                    valid[i] = ComputeCRC32(data, chunk.size_) == chunk.crc_ &&
+                               (is_view ||
+                                DecompressChunk(data, chunk.size_,
+                                                chunk.compression_,
+                                                output + rows[i] * row_bytes,
+                                                (rows[i + 1] - rows[i]) *
+                                                        row_bytes));
+                });
+        if (std::find(valid.begin(), valid.end(), 0) != valid.end()) {
+            utility::LogWarning(
+                    "Read O3DC failed: corrupted chunk of column {} in {}.",
+                    column.name_, filename_);
+            return false;
+        }
+        return true;
+    }
+
+    /// Reads the given chunks of the selected columns of a table.
+    bool ReadTable(const ColumnarTable &table,
+                   const std::vector<std::string> &names,
+                   const std::vector<int64_t> &chunks,
+                   geometry::TensorMap &attrs) const {
+        std::vector<std::string> selected = names;
+        if (selected.empty()) {
+            for (const ColumnarColumn &column : table.columns_) {
+                selected.push_back(column.name_);
+            }
+        }
+        for (const std::string &name : selected) {
+            const ColumnarColumn *column = table.FindColumn(name);
+            if (column == nullptr) {
+                utility::LogWarning("Read O3DC failed: {} has no column {}.",
+                                    filename_, name);
+                return false;
+            }
+            core::Tensor tensor;
+            if (!ReadColumn(table, *column, chunks, tensor)) {
+                return false;
+            }
+            attrs[name] = tensor;
+        }
+        return true;
+    }
+
+    static std::vector<int64_t> AllChunks(const ColumnarTable &table) {
+        std::vector<int64_t> chunks(table.GetNumChunks());
+        std::iota(chunks.begin(), chunks.end(), int64_t(0));
+        return chunks;
+    }
+
+private:
+    /// Whether the chunks are stored raw, one right after the other, and
+    /// suitably aligned to be used in place. Chunks are 64-byte aligned, so
+    /// this holds for consecutive chunks when their size is a multiple of 64.
+    bool IsStoredContiguously(const ColumnarColumn &column,
+                              const std::vector<int64_t> &chunks,
+                              const std::vector<int64_t> &rows,
+                              int64_t row_bytes) const {
+        const uint64_t offset = column.chunks_[chunks[0]].offset_;
+        if ((reinterpret_cast<uintptr_t>(file_->GetData()) + offset) %
+                    column.dtype_.ByteSize() !=
+            0) {
+            return false;
+        }
+        for (size_t i = 0; i < chunks.size(); ++i) {
+            const ColumnarChunk &chunk = column.chunks_[chunks[i]];
+            if (chunk.compression_ != ColumnCompression::None ||
+                int64_t(chunk.size_) != (rows[i + 1] - rows[i]) * row_bytes ||
+                chunk.offset_ != offset + rows[i] * row_bytes) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool Fail(const std::string &reason) {
+        utility::LogWarning("Read O3DC failed: {} in {}.", reason, filename_);
+        return false;
+    }
+
+    std::string filename_;
+    bool memory_map_ = false;
+    std::shared_ptr<utility::filesystem::MappedFile> file_ =
+            std::make_shared<utility::filesystem::MappedFile>();
+    std::vector<ColumnarTable> tables_;
+};
+
+}  // namespace
+
+bool WritePointCloudToColumnar(const std::string &filename,
+                               const geometry::PointCloud &pointcloud,
+                               const WriteColumnarOption &option) {
+    geometry::TensorMap attrs = pointcloud.GetPointAttr();
+    if (option.spatial_sort && pointcloud.HasPointPositions() &&
+        pointcloud.GetPointPositions().GetShape().IsCompatible(
+                {utility::nullopt, 3})) {
+        const core::Tensor order = ComputeMortonOrder(
+                pointcloud.GetPointPositions().To(core::Device("CPU:0")));
+        for (auto &kv : attrs) {
+            kv.second = kv.second.To(core::Device("CPU:0")).IndexGet({order});
+        }
+    }
+    return WriteColumnarFile(filename, ColumnarGeometryType::PointCloud,
+                             {{"point", &attrs}}, option);
+}
+
+bool ReadPointCloudFromColumnar(const std::string &filename,
+                                geometry::PointCloud &pointcloud,
+                                const std::vector<std::string> &attributes,
+                                bool memory_map) {
+    ColumnarFile file;
+    if (!file.Open(filename, ColumnarGeometryType::PointCloud, memory_map)) {
+        return false;
+    }
+    const ColumnarTable *table = file.FindTable("point");
+    geometry::TensorMap attrs("positions");
+    if (table == nullptr ||
+        !file.ReadTable(*table, attributes, ColumnarFile::AllChunks(*table),
+                        attrs)) {
+        return false;
+    }
+    pointcloud.Clear();
+    for (const auto &kv : attrs) {
+        pointcloud.SetPointAttr(kv.first, kv.second);
+    }
+    return true;
+}
+
+bool ReadPointCloudRegionFromColumnar(
+        const std::string &filename,
+        const core::Tensor &min_bound,
+        const core::Tensor &max_bound,
+        geometry::PointCloud &pointcloud,
+        const std::vector<std::string> &attributes) {
+    core::AssertTensorShape(min_bound, {3});
+    core::AssertTensorShape(max_bound, {3});
+    const core::Tensor min_d =
+            min_bound.To(core::Device("CPU:0"), core::Float64).Contiguous();
+    const core::Tensor max_d =
+            max_bound.To(core::Device("CPU:0"), core::Float64).Contiguous();
+    const double *box_min = min_d.GetDataPtr<double>();
+    const double *box_max = max_d.GetDataPtr<double>();
+
+    ColumnarFile file;
+    if (!file.Open(filename, ColumnarGeometryType::PointCloud)) {
+        return false;
+    }
+    const ColumnarTable *table = file.FindTable("point");
+    if (table == nullptr || table->chunk_bounds_.empty()) {
+        utility::LogWarning("Read O3DC failed: {} has no positions.",
+                            filename);
+        return false;
+    }
+    std::vector<int64_t> chunks;
+    for (int64_t c = 0; c < table->GetNumChunks(); ++c) {
+        const double *bounds = table->chunk_bounds_.data() + c * 6;
+        bool overlaps = true;
+        for (int d = 0; d < 3; ++d) {
+            overlaps = overlaps && bounds[d] <= box_max[d] &&
+                       bounds[d + 3] >= box_min[d];
+        }
+        if (overlaps) chunks.push_back(c);
+    }
+
+    // Positions are needed to select the points within the box.
+    std::vector<std::string> names = attributes;
+    if (!names.empty() &&
+        std::find(names.begin(), names.end(), "positions") == names.end()) {
+        names.push_back("positions");
+    }
+    geometry::TensorMap attrs("positions");
+    if (!file.ReadTable(*table, names, chunks, attrs)) {
+        return false;
+    }
+    const core::Tensor positions =
+            attrs.at("positions").To(core::Float64).Contiguous();
+    const double *points = positions.GetDataPtr<double>();
+    std::vector<uint8_t> inside(positions.GetLength());
+    core::ParallelFor(
+            core::Device("CPU:0"), positions.GetLength(), [&](int64_t i) {
+                bool is_inside = true;
+                for (int d = 0; d < 3; ++d) {
+                    is_inside = is_inside && points[i * 3 + d] >= box_min[d] &&
+                                points[i * 3 + d] <= box_max[d];
+                }
+                inside[i] = is_inside;
+            });
+    std::vector<int64_t> indices;
+    for (int64_t i = 0; i < int64_t(inside.size()); ++i) {
+        if (inside[i]) indices.push_back(i);
+    }
+    const core::Tensor index_tensor(indices, {int64_t(indices.size())},
+                                    core::Int64);
+
+    pointcloud.Clear();
+    for (const auto &kv : attrs) {
+        if (attributes.empty() ||
+            std::find(attributes.begin(), attributes.end(), kv.first) !=
+                    attributes.end()) {
+            pointcloud.SetPointAttr(kv.first,
+                                    kv.second.IndexGet({index_tensor}));
+        }
+    }
+    return true;
+}
+
+bool WriteTriangleMeshToColumnar(const std::string &filename,
+                                 const geometry::TriangleMesh &mesh,
+                                 const WriteColumnarOption &option) {
+    return WriteColumnarFile(filename, ColumnarGeometryType::TriangleMesh,
+                             {{"vertex", &mesh.GetVertexAttr()},
+                              {"triangle", &mesh.GetTriangleAttr()}},
+                             option);
+}
+
+bool ReadTriangleMeshFromColumnar(
+        const std::string &filename,
+        geometry::TriangleMesh &mesh,
+        const std::vector<std::string> &vertex_attributes,
+        const std::vector<std::string> &triangle_attributes,
+        bool memory_map) {
+    ColumnarFile file;
+    if (!file.Open(filename, ColumnarGeometryType::TriangleMesh,
+                   memory_map)) {
+        return false;
+    }
+    const ColumnarTable *vertex_table = file.FindTable("vertex");
+    const ColumnarTable *triangle_table = file.FindTable("triangle");
+    geometry::TensorMap vertex_attrs("positions");
+    geometry::TensorMap triangle_attrs("indices");
+    if (vertex_table == nullptr || triangle_table == nullptr ||
+        !file.ReadTable(*vertex_table, vertex_attributes,
+                        ColumnarFile::AllChunks(*vertex_table),
+                        vertex_attrs) ||
+        !file.ReadTable(*triangle_table, triangle_attributes,
+                        ColumnarFile::AllChunks(*triangle_table),
+                        triangle_attrs)) {
+        return false;
+    }
+    mesh.Clear();
+    for (const auto &kv : vertex_attrs) {
+        mesh.SetVertexAttr(kv.first, kv.second);
+    }
+    for (const auto &kv : triangle_attrs) {
+        mesh.SetTriangleAttr(kv.first, kv.second);
+    }
+    return true;
+}
+
+bool ReadPointCloudFromO3DC(const std::string &filename,
+                            geometry::PointCloud &pointcloud,
+                            const open3d::io::ReadPointCloudOption &params) {
+    return ReadPointCloudFromColumnar(filename, pointcloud);
+}
+
+bool WritePointCloudToO3DC(const std::string &filename,
+                           const geometry::PointCloud &pointcloud,
+                           const open3d::io::WritePointCloudOption &params) {
+    // Keeps the point order, as callers of WritePointCloud() expect.
+    WriteColumnarOption option;
+    option.spatial_sort = false;
+    if (params.compressed == open3d::io::WritePointCloudOption::Compressed::
+                                     Uncompressed) {
+        option.compression = ColumnCompression::None;
+    }
+    return WritePointCloudToColumnar(filename, pointcloud, option);
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
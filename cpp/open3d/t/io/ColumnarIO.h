@@ -0,0 +1,147 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/geometry/TriangleMesh.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// Compression of the chunks of a column in an O3DC file.
+enum class ColumnCompression {
+    None = 0,     ///< Chunks are stored as is and can be memory-mapped.
+    LZF = 1,      ///< Fast compression, the default.
+    Deflate = 2,  ///< Slower, smaller zlib compression.
+};
+
+/// \struct WriteColumnarOption
+///
+/// Options for writing geometry to the columnar O3DC format.
+struct WriteColumnarOption {
+    /// Compression of all columns. Chunks that do not shrink are stored
+    /// uncompressed.
+    ColumnCompression compression = ColumnCompression::LZF;
+    /// Number of elements per chunk. Every chunk of a column is compressed
+    /// and checksummed on its own and is the unit of partial reads.
+    int64_t chunk_size = 65536;
+    /// Reorder points along a Morton curve before writing, so that chunks are
+    /// spatially compact and region reads touch few chunks. Only applies to
+    /// point clouds, as mesh vertices are referenced by index.
+    bool spatial_sort = true;
+};
+
+/// \brief Write a point cloud to an Open3D columnar (O3DC) file.
+///
+/// Every point attribute is stored as a separate column, split into chunks
+/// of WriteColumnarOption::chunk_size points. The file keeps the bounding box
+/// of every chunk, so that ReadPointCloudRegionFromColumnar() only reads the
+/// chunks overlapping the requested region.
+///
+/// File layout, all values little-endian:
+/// - "O3DCOL01" magic.
+/// - Chunk payloads, each aligned to 64 bytes.
+/// - Directory: geometry type, then per table (points, vertices or
+///   triangles) its length, chunk size, chunk bounding boxes and per column
+///   its name, dtype, element shape and the offset, size, compression and
+///   CRC32 of every chunk.
+/// - Footer: directory offset, directory size, directory CRC32 and the
+///   magic.
+///
+/// \param filename Path to the file.
+/// \param pointcloud The point cloud. Attributes on other devices are copied
+/// to the CPU.
+/// \param option Compression and chunking options.
+bool WritePointCloudToColumnar(const std::string &filename,
+                               const geometry::PointCloud &pointcloud,
+                               const WriteColumnarOption &option = {});
+
+/// \brief Read a point cloud from an O3DC file.
+///
+/// \param filename Path to the file.
+/// \param pointcloud The output point cloud.
+/// \param attributes Names of the attributes to read, all if empty. Other
+/// columns are not touched.
+/// \param memory_map If true, columns stored without compression are not
+/// copied. The tensors are views of a copy-on-write mapping of the file, so
+/// they may be modified, but the file must not be truncated or overwritten
+/// while they are alive.
+bool ReadPointCloudFromColumnar(
+        const std::string &filename,
+        geometry::PointCloud &pointcloud,
+        const std::vector<std::string> &attributes = {},
+        bool memory_map = false);
+
+/// \brief Read the points of an O3DC file inside an axis-aligned box.
+///
+/// Only the chunks whose bounding box intersects the box are decompressed.
+///
+/// \param filename Path to the file.
+/// \param min_bound Minimum corner of the box, a tensor of shape {3}.
+/// \param max_bound Maximum corner of the box, a tensor of shape {3}.
+/// \param pointcloud The output point cloud.
+/// \param attributes Names of the attributes to read, all if empty.
+bool ReadPointCloudRegionFromColumnar(
+        const std::string &filename,
+        const core::Tensor &min_bound,
+        const core::Tensor &max_bound,
+        geometry::PointCloud &pointcloud,
+        const std::vector<std::string> &attributes = {});
+
+/// \brief Write a triangle mesh to an O3DC file.
+///
+/// Vertex and triangle attributes are stored as two tables of columns, see
+/// WritePointCloudToColumnar(). The vertex order is preserved.
+bool WriteTriangleMeshToColumnar(const std::string &filename,
+                                 const geometry::TriangleMesh &mesh,
+                                 const WriteColumnarOption &option = {});
+
+/// \brief Read a triangle mesh from an O3DC file.
+///
+/// \param filename Path to the file.
+/// \param mesh The output mesh.
+/// \param vertex_attributes Names of the vertex attributes to read, all if
+/// empty.
+/// \param triangle_attributes Names of the triangle attributes to read, all
+/// if empty.
+/// \param memory_map If true, uncompressed columns are views of the file,
+/// see ReadPointCloudFromColumnar().
+bool ReadTriangleMeshFromColumnar(
+        const std::string &filename,
+        geometry::TriangleMesh &mesh,
+        const std::vector<std::string> &vertex_attributes = {},
+        const std::vector<std::string> &triangle_attributes = {},
+        bool memory_map = false);
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
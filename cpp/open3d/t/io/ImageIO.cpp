@@ -26,11 +26,13 @@
 
 #include "open3d/t/io/ImageIO.h"
 
+#include <algorithm>
 #include <unordered_map>
 
 #include "open3d/io/ImageIO.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace t {
@@ -79,6 +81,24 @@ bool ReadImage(const std::string &filename, geometry::Image &image) {
     return map_itr->second(filename, image);
 }
 
+bool ReadImages(const std::vector<std::string> &filenames,
+                std::vector<geometry::Image> &images,
+                int num_threads /* = 0*/) {
+    const int64_t num_images = static_cast<int64_t>(filenames.size());
+    images.assign(num_images, geometry::Image());
+    if (num_threads <= 0) {
+        num_threads = utility::EstimateMaxThreads();
+    }
+    std::vector<uint8_t> success(num_images, 0);
+    // Decoding times vary with the image content, so balance dynamically.
+#pragma omp parallel for schedule(dynamic) num_threads(num_threads)
+    for (int64_t i = 0; i < num_images; ++i) {
+        success[i] = ReadImage(filenames[i], images[i]) ? 1 : 0;
+    }
+    return std::all_of(success.begin(), success.end(),
+                       [](uint8_t s) { return s != 0; });
+}
+
 bool WriteImage(const std::string &filename,
                 const geometry::Image &image,
                 int quality /* = kOpen3DImageIODefaultQuality*/) {
@@ -27,6 +27,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "open3d/io/ImageIO.h"
 #include "open3d/t/geometry/Image.h"
@@ -48,6 +49,20 @@ std::shared_ptr<geometry::Image> CreateImageFromFile(
 /// \return return true if the read function is successful, false otherwise.
 bool ReadImage(const std::string &filename, geometry::Image &image);
 
+/// Read a batch of images, decoding them in parallel. This is faster than
+/// calling ReadImage() in a loop when loading image sequences, e.g. for RGBD
+/// integration or color map optimization.
+/// \param filenames Full paths to the images. Supported file formats are png,
+/// jpg/jpeg.
+/// \param images Output images on CPU, one per file. Images that fail to load
+/// are left empty.
+/// \param num_threads Number of decoding threads. 0 uses all available
+/// threads.
+/// \return return true if all images are read successfully, false otherwise.
+bool ReadImages(const std::vector<std::string> &filenames,
+                std::vector<geometry::Image> &images,
+                int num_threads = 0);
+
 constexpr int kOpen3DImageIODefaultQuality = -1;
 
 /// The general entrance for writing an Image to a file
@@ -0,0 +1,260 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/PointCloudFileHeader.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <locale>
+#include <sstream>
+#include <utility>
+
+#include "open3d/utility/Helper.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+bool ReadPCDHeaderLines(const std::function<bool(std::string &)> &read_line,
+                        PCDHeader &header) {
+    size_t specified_channel_count = 0;
+
+    std::string line;
+    while (read_line(line)) {
+        if (line == "") {
+            continue;
+        }
+        std::vector<std::string> st = utility::SplitString(line, "\t\r\n ");
+        std::stringstream sstream(line);
+        sstream.imbue(std::locale::classic());
+        std::string line_type;
+        sstream >> line_type;
+        if (line_type.substr(0, 1) == "#") {
+        } else if (line_type.substr(0, 7) == "VERSION") {
+            if (st.size() >= 2) {
+                header.version = st[1];
+            }
+        } else if (line_type.substr(0, 6) == "FIELDS" ||
+                   line_type.substr(0, 7) == "COLUMNS") {
+            specified_channel_count = st.size() - 1;
+            if (specified_channel_count == 0) {
+                utility::LogWarning("[ReadPCDHeader] Bad PCD file format.");
+                return false;
+            }
+            header.fields.resize(specified_channel_count);
+            int count_offset = 0, offset = 0;
+            for (size_t i = 0; i < specified_channel_count;
+                 ++i, count_offset += 1, offset += 4) {
+                header.fields[i].name = st[i + 1];
+                header.fields[i].size = 4;
+                header.fields[i].type = 'F';
+                header.fields[i].count = 1;
+                header.fields[i].count_offset = count_offset;
+                header.fields[i].offset = offset;
+            }
+            header.elementnum = count_offset;
+            header.pointsize = offset;
+        } else if (line_type.substr(0, 4) == "SIZE") {
+            if (specified_channel_count != st.size() - 1) {
+                utility::LogWarning("[ReadPCDHeader] Bad PCD file format.");
+                return false;
+            }
+            int offset = 0, col_type = 0;
+            for (size_t i = 0; i < specified_channel_count;
+                 ++i, offset += col_type) {
+                sstream >> col_type;
+                header.fields[i].size = col_type;
+                header.fields[i].offset = offset;
+            }
+            header.pointsize = offset;
+        } else if (line_type.substr(0, 4) == "TYPE") {
+            if (specified_channel_count != st.size() - 1) {
+                utility::LogWarning("[ReadPCDHeader] Bad PCD file format.");
+                return false;
+            }
+            for (size_t i = 0; i < specified_channel_count; ++i) {
+                header.fields[i].type = st[i + 1].c_str()[0];
+            }
+        } else if (line_type.substr(0, 5) == "COUNT") {
+            if (specified_channel_count != st.size() - 1) {
+                utility::LogWarning("[ReadPCDHeader] Bad PCD file format.");
+                return false;
+            }
+            int count_offset = 0, offset = 0, col_count = 0;
+            for (size_t i = 0; i < specified_channel_count; ++i) {
+                sstream >> col_count;
+                header.fields[i].count = col_count;
+                header.fields[i].count_offset = count_offset;
+                header.fields[i].offset = offset;
+                count_offset += col_count;
+                offset += col_count * header.fields[i].size;
+            }
+            header.elementnum = count_offset;
+            header.pointsize = offset;
+        } else if (line_type.substr(0, 5) == "WIDTH") {
+            sstream >> header.width;
+        } else if (line_type.substr(0, 6) == "HEIGHT") {
+            sstream >> header.height;
+            header.points = header.width * header.height;
+        } else if (line_type.substr(0, 9) == "VIEWPOINT") {
+            if (st.size() >= 2) {
+                header.viewpoint = st[1];
+            }
+        } else if (line_type.substr(0, 6) == "POINTS") {
+            sstream >> header.points;
+        } else if (line_type.substr(0, 4) == "DATA") {
+            header.datatype = PCDDataType::ASCII;
+            if (st.size() >= 2) {
+                if (st[1].substr(0, 17) == "binary_compressed") {
+                    header.datatype = PCDDataType::BINARY_COMPRESSED;
+                } else if (st[1].substr(0, 6) == "binary") {
+                    header.datatype = PCDDataType::BINARY;
+                }
+            }
+            return true;
+        }
+    }
+    utility::LogWarning("[ReadPCDHeader] Missing DATA line.");
+    return false;
+}
+
+core::Dtype GetDtypeFromPCDType(char type, int size) {
+    if (type == 'I') {
+        if (size == 1) return core::Int8;
+        if (size == 2) return core::Int16;
+        if (size == 4) return core::Int32;
+        if (size == 8) return core::Int64;
+    } else if (type == 'U') {
+        if (size == 1) return core::UInt8;
+        if (size == 2) return core::UInt16;
+        if (size == 4) return core::UInt32;
+        if (size == 8) return core::UInt64;
+    } else if (type == 'F') {
+        if (size == 4) return core::Float32;
+        if (size == 8) return core::Float64;
+    }
+    return core::Undefined;
+}
+
+char GetPCDTypeFromDtype(core::Dtype dtype) {
+    if (dtype == core::Float32 || dtype == core::Float64) return 'F';
+    if (dtype == core::Int8 || dtype == core::Int16 || dtype == core::Int32 ||
+        dtype == core::Int64) {
+        return 'I';
+    }
+    if (dtype == core::UInt8 || dtype == core::UInt16 ||
+        dtype == core::UInt32 || dtype == core::UInt64) {
+        return 'U';
+    }
+    return 0;
+}
+
+// Scalar types of the PLY format, including the sized aliases.
+static const std::vector<std::pair<std::string, core::Dtype>> &
+GetPLYScalarTypes() {
+    static const std::vector<std::pair<std::string, core::Dtype>> types = {
+            {"char", core::Int8},      {"uchar", core::UInt8},
+            {"short", core::Int16},    {"ushort", core::UInt16},
+            {"int", core::Int32},      {"uint", core::UInt32},
+            {"float", core::Float32},  {"double", core::Float64},
+            {"int8", core::Int8},      {"uint8", core::UInt8},
+            {"int16", core::Int16},    {"uint16", core::UInt16},
+            {"int32", core::Int32},    {"uint32", core::UInt32},
+            {"float32", core::Float32}, {"float64", core::Float64}};
+    return types;
+}
+
+core::Dtype GetDtypeFromPLYType(const std::string &type) {
+    for (const auto &ply_type : GetPLYScalarTypes()) {
+        if (ply_type.first == type) return ply_type.second;
+    }
+    return core::Undefined;
+}
+
+std::string GetPLYTypeFromDtype(core::Dtype dtype) {
+    for (const auto &ply_type : GetPLYScalarTypes()) {
+        if (ply_type.second == dtype) return ply_type.first;
+    }
+    return "";
+}
+
+int64_t ReadPLYHeader(const char *data,
+                      size_t size,
+                      std::string &format,
+                      std::vector<PLYElementLayout> &elements) {
+    format.clear();
+    elements.clear();
+    const char *end = data + size;
+    const char *line_begin = data;
+    bool is_first_line = true;
+    while (line_begin < end) {
+        const char *line_end = std::find(line_begin, end, '\n');
+        const std::vector<std::string> tokens = utility::SplitString(
+                std::string(line_begin, line_end), " \t\r");
+        line_begin = std::min(line_end + 1, end);
+        if (is_first_line) {
+            if (tokens.size() != 1 || tokens[0] != "ply") {
+                return -1;
+            }
+            is_first_line = false;
+            continue;
+        }
+        if (tokens.empty()) {
+            continue;
+        }
+        if (tokens[0] == "format" && tokens.size() >= 2) {
+            format = tokens[1];
+        } else if (tokens[0] == "element" && tokens.size() >= 3) {
+            elements.emplace_back();
+            elements.back().name_ = tokens[1];
+            elements.back().size_ =
+                    std::strtoll(tokens[2].c_str(), nullptr, 10);
+        } else if (tokens[0] == "property" && !elements.empty()) {
+            PLYElementLayout &element = elements.back();
+            if (tokens.size() >= 2 && tokens[1] == "list") {
+                element.has_list_ = true;
+                continue;
+            }
+            const core::Dtype dtype = tokens.size() >= 3
+                                              ? GetDtypeFromPLYType(tokens[1])
+                                              : core::Undefined;
+            if (dtype == core::Undefined) {
+                return -1;
+            }
+            element.properties_.push_back(
+                    {tokens[2], dtype, element.record_size_});
+            element.record_size_ += dtype.ByteSize();
+        } else if (tokens[0] == "end_header") {
+            return line_begin - data;
+        }
+    }
+    return -1;
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
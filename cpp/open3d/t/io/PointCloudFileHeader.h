@@ -0,0 +1,119 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "open3d/core/Dtype.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+enum class PCDDataType { ASCII = 0, BINARY = 1, BINARY_COMPRESSED = 2 };
+
+struct PCLPointField {
+public:
+    std::string name;
+    int size;
+    char type;
+    int count;
+    // helper variable
+    int count_offset = 0;
+    int offset = 0;
+};
+
+struct PCDHeader {
+public:
+    std::string version;
+    std::vector<PCLPointField> fields;
+    int width = 0;
+    int height = 0;
+    int points = 0;
+    PCDDataType datatype = PCDDataType::ASCII;
+    std::string viewpoint;
+
+    // helper variables
+    int elementnum = 0;
+    int pointsize = 0;
+    std::unordered_map<std::string, bool> has_attr;
+    std::unordered_map<std::string, core::Dtype> attr_dtype;
+};
+
+/// Parses the lines of a PCD header up to and including the DATA line.
+/// \p read_line stores the next line in its argument and returns false at the
+/// end of the input. Only the fields of \p header up to datatype are set.
+bool ReadPCDHeaderLines(const std::function<bool(std::string &)> &read_line,
+                        PCDHeader &header);
+
+/// Dtype of a PCD field of \p type ('I', 'U' or 'F') and \p size bytes, or
+/// core::Undefined.
+core::Dtype GetDtypeFromPCDType(char type, int size);
+
+/// PCD type ('I', 'U' or 'F') of \p dtype, or 0 if it cannot be stored.
+char GetPCDTypeFromDtype(core::Dtype dtype);
+
+/// Layout of an element in a PLY header.
+struct PLYElementLayout {
+    struct Property {
+        std::string name_;
+        core::Dtype dtype_;
+        /// Byte offset in binary records.
+        int64_t byte_offset_;
+    };
+    std::string name_;
+    int64_t size_ = 0;
+    /// Byte size of binary records, if the element has no list properties.
+    int64_t record_size_ = 0;
+    bool has_list_ = false;
+    /// Scalar properties in the order of the file. List properties are not
+    /// included.
+    std::vector<Property> properties_;
+};
+
+/// Parses the PLY header at the start of \p data. Returns the size of the
+/// header in bytes, or -1 if \p data does not start with a valid header or a
+/// property has an unknown scalar type.
+int64_t ReadPLYHeader(const char *data,
+                      size_t size,
+                      std::string &format,
+                      std::vector<PLYElementLayout> &elements);
+
+/// Dtype of the PLY scalar \p type, such as "float" or "uint8", or
+/// core::Undefined.
+core::Dtype GetDtypeFromPLYType(const std::string &type);
+
+/// PLY scalar type of \p dtype, or an empty string if it cannot be stored.
+std::string GetPLYTypeFromDtype(core::Dtype dtype);
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
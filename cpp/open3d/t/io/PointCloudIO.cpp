@@ -51,6 +51,7 @@ static const std::unordered_map<
                 {"pcd", ReadPointCloudFromPCD},
                 {"ply", ReadPointCloudFromPLY},
                 {"pts", ReadPointCloudFromPTS},
+                {"o3dc", ReadPointCloudFromO3DC},
         };
 
 static const std::unordered_map<
@@ -61,7 +62,7 @@ static const std::unordered_map<
         file_extension_to_pointcloud_write_function{
                 {"npz", WritePointCloudToNPZ}, {"xyzi", WritePointCloudToXYZI},
                 {"pcd", WritePointCloudToPCD}, {"ply", WritePointCloudToPLY},
-                {"pts", WritePointCloudToPTS},
+                {"pts", WritePointCloudToPTS}, {"o3dc", WritePointCloudToO3DC},
         };
 
 std::shared_ptr<geometry::PointCloud> CreatePointCloudFromFile(
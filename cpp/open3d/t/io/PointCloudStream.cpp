@@ -0,0 +1,972 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/PointCloudStream.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/io/ASCIIParser.h"
+#include "open3d/t/io/PointCloudFileHeader.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+namespace {
+
+/// A scalar of the point records and the attribute entry it belongs to.
+struct PointField {
+    std::string name_;
+    std::string attr_;
+    int num_components_ = 1;
+    int component_ = 0;
+    /// Dtype of the value in the file.
+    core::Dtype dtype_ = core::Float64;
+    /// Byte offset in binary records, column in text rows.
+    int64_t offset_ = 0;
+    /// PCD colors are packed into a single 4 byte value in BGR order. This is
+    /// the PCD type of that value ('F', 'U' or 'I'), or 0 for other fields.
+    char packed_type_ = 0;
+};
+
+}  // namespace
+
+static bool IsLittleEndian() {
+    const uint16_t one = 1;
+    return *reinterpret_cast<const uint8_t *>(&one) == 1;
+}
+
+static bool IsTextFormat(const std::string &format) {
+    return format == "xyz" || format == "xyzn" || format == "xyzrgb" ||
+           format == "xyzi" || format == "pts";
+}
+
+// Returns the start of the line following \p p, or \p end.
+static const char *NextLine(const char *p, const char *end) {
+    if (p >= end) {
+        return end;
+    }
+    const char *eol =
+            static_cast<const char *>(std::memchr(p, '\n', end - p));
+    return eol == nullptr ? end : eol + 1;
+}
+
+// Returns the line starting at \p p without the line break.
+static std::string GetLine(const char *p, const char *end) {
+    const char *eol = NextLine(p, end);
+    while (eol > p && (eol[-1] == '\n' || eol[-1] == '\r')) {
+        --eol;
+    }
+    return std::string(p, eol);
+}
+
+// Skips up to \p num_lines lines. \p num_skipped is set to the number of
+// lines actually skipped.
+static const char *SkipLines(const char *p,
+                             const char *end,
+                             int64_t num_lines,
+                             int64_t &num_skipped) {
+    num_skipped = 0;
+    while (num_skipped < num_lines && p < end) {
+        p = NextLine(p, end);
+        ++num_skipped;
+    }
+    return p;
+}
+
+static int64_t CountLines(const char *p, const char *end) {
+    if (p >= end) {
+        return 0;
+    }
+    return std::count(p, end, '\n') + (end[-1] == '\n' ? 0 : 1);
+}
+
+// Attribute entry of a PLY or PCD field name, see also
+// GetNameStrideOffsetForAttribute() in FilePLY.cpp.
+static void GetAttributeOfField(const std::string &name,
+                                std::string &attr,
+                                int &num_components,
+                                int &component) {
+    static const std::vector<std::pair<std::string, std::vector<std::string>>>
+            vector_attrs = {{"positions", {"x", "y", "z"}},
+                            {"normals", {"nx", "ny", "nz"}},
+                            {"normals", {"normal_x", "normal_y", "normal_z"}},
+                            {"colors", {"red", "green", "blue"}}};
+    for (const auto &vector_attr : vector_attrs) {
+        for (int i = 0; i < 3; ++i) {
+            if (name == vector_attr.second[i]) {
+                attr = vector_attr.first;
+                num_components = 3;
+                component = i;
+                return;
+            }
+        }
+    }
+    attr = name;
+    num_components = 1;
+    component = 0;
+}
+
+// Checks that the components of every vector attribute are present and share
+// one dtype.
+static bool CheckPointFields(const std::vector<PointField> &fields) {
+    for (const PointField &field : fields) {
+        std::vector<bool> has_component(field.num_components_, false);
+        for (const PointField &other : fields) {
+            if (other.attr_ != field.attr_) continue;
+            if (other.dtype_ != field.dtype_) {
+                utility::LogWarning(
+                        "Fields of attribute {} have different dtypes {} and "
+                        "{}.",
+                        field.attr_, field.dtype_.ToString(),
+                        other.dtype_.ToString());
+                return false;
+            }
+            if (other.packed_type_ != 0) {
+                has_component.assign(field.num_components_, true);
+            } else {
+                has_component[other.component_] = true;
+            }
+        }
+        if (std::find(has_component.begin(), has_component.end(), false) !=
+            has_component.end()) {
+            utility::LogWarning("Attribute {} has missing fields.",
+                                field.attr_);
+            return false;
+        }
+    }
+    return true;
+}
+
+struct PointCloudReader::Impl {
+    utility::filesystem::MappedFile file_;
+    /// Point data of the mapped file.
+    const char *begin_ = nullptr;
+    const char *end_ = nullptr;
+    /// Start of the next line for text data.
+    const char *cursor_ = nullptr;
+    bool binary_ = false;
+    int64_t record_size_ = 0;
+    int num_columns_ = 0;
+    int64_t num_points_ = 0;
+    int64_t position_ = 0;
+    bool is_opened_ = false;
+    std::vector<PointField> fields_;
+
+    void AddTextAttribute(const std::string &attr,
+                          int num_components,
+                          core::Dtype dtype) {
+        for (int i = 0; i < num_components; ++i) {
+            PointField field;
+            field.attr_ = attr;
+            field.num_components_ = num_components;
+            field.component_ = i;
+            field.dtype_ = dtype;
+            field.offset_ = num_columns_++;
+            fields_.push_back(field);
+        }
+    }
+
+    bool ParseXYZHeader(const std::string &format);
+    bool ParsePTSHeader();
+    bool ParsePCDHeader();
+    bool ParsePLYHeader();
+};
+
+bool PointCloudReader::Impl::ParseXYZHeader(const std::string &format) {
+    AddTextAttribute("positions", 3, core::Float64);
+    if (format == "xyzn") {
+        AddTextAttribute("normals", 3, core::Float64);
+    } else if (format == "xyzrgb") {
+        AddTextAttribute("colors", 3, core::Float64);
+    } else if (format == "xyzi") {
+        AddTextAttribute("intensities", 1, core::Float64);
+    }
+    num_points_ = CountLines(begin_, end_);
+    return true;
+}
+
+bool PointCloudReader::Impl::ParsePTSHeader() {
+    // The first line holds the number of points, the number of values of the
+    // first point determines the available attributes.
+    char *count_end = nullptr;
+    const std::string count_line = GetLine(begin_, end_);
+    num_points_ = std::strtoll(count_line.c_str(), &count_end, 10);
+    if (count_end == count_line.c_str() || num_points_ < 0) {
+        utility::LogWarning("Read PTS header failed: invalid point count.");
+        return false;
+    }
+    begin_ = NextLine(begin_, end_);
+    std::istringstream first_point(GetLine(begin_, end_));
+    int num_values = 0;
+    for (std::string value; first_point >> value;) {
+        ++num_values;
+    }
+    if (num_points_ > 0 && num_values != 3 && num_values != 4 &&
+        num_values != 6 && num_values != 7) {
+        utility::LogWarning(
+                "Read PTS header failed: unsupported number of values {}.",
+                num_values);
+        return false;
+    }
+    AddTextAttribute("positions", 3, core::Float64);
+    if (num_values == 4 || num_values == 7) {
+        AddTextAttribute("intensities", 1, core::Float64);
+    }
+    if (num_values >= 6) {
+        AddTextAttribute("colors", 3, core::UInt8);
+    }
+    return true;
+}
+
+bool PointCloudReader::Impl::ParsePCDHeader() {
+    PCDHeader header;
+    const char *p = begin_;
+    auto read_line = [&](std::string &line) {
+        if (p >= end_) {
+            return false;
+        }
+        line = GetLine(p, end_);
+        p = NextLine(p, end_);
+        return true;
+    };
+    if (!ReadPCDHeaderLines(read_line, header)) {
+        utility::LogWarning("Read PCD header failed: invalid header.");
+        return false;
+    }
+    if (header.fields.empty()) {
+        utility::LogWarning("Read PCD header failed: no fields.");
+        return false;
+    }
+    if (header.datatype == PCDDataType::BINARY_COMPRESSED) {
+        utility::LogWarning(
+                "Read PCD header failed: unsupported DATA binary_compressed.");
+        return false;
+    }
+    binary_ = header.datatype == PCDDataType::BINARY;
+    begin_ = p;
+    num_points_ = header.points;
+
+    for (const PCLPointField &pcd_field : header.fields) {
+        PointField field;
+        field.name_ = pcd_field.name;
+        field.dtype_ = GetDtypeFromPCDType(pcd_field.type, pcd_field.size);
+        field.offset_ = binary_ ? pcd_field.offset : pcd_field.count_offset;
+        if ((field.name_ == "rgb" || field.name_ == "rgba") &&
+            pcd_field.size == 4) {
+            field.attr_ = "colors";
+            field.num_components_ = 3;
+            field.dtype_ = core::UInt8;
+            field.packed_type_ = pcd_field.type;
+            fields_.push_back(field);
+            continue;
+        }
+        if (field.name_ == "_" || pcd_field.count != 1 ||
+            field.dtype_ == core::Undefined) {
+            // Padding and multi-valued fields are skipped.
+            continue;
+        }
+        GetAttributeOfField(field.name_, field.attr_, field.num_components_,
+                            field.component_);
+        fields_.push_back(field);
+    }
+    if (binary_) {
+        record_size_ = header.pointsize;
+    } else {
+        num_columns_ = header.elementnum;
+    }
+    return CheckPointFields(fields_);
+}
+
+bool PointCloudReader::Impl::ParsePLYHeader() {
+    std::string format;
+    std::vector<PLYElementLayout> elements;
+    const int64_t header_size =
+            ReadPLYHeader(begin_, end_ - begin_, format, elements);
+    if (header_size < 0) {
+        utility::LogWarning("Read PLY header failed: invalid header.");
+        return false;
+    }
+    if (format == "ascii") {
+        binary_ = false;
+    } else if (format == "binary_little_endian" && IsLittleEndian()) {
+        binary_ = true;
+    } else {
+        utility::LogWarning("Read PLY header failed: unsupported format {}.",
+                            format);
+        return false;
+    }
+
+    // Skip the elements stored before the vertices.
+    const char *p = begin_ + header_size;
+    for (const PLYElementLayout &element : elements) {
+        if (element.name_ == "vertex") {
+            if (element.has_list_) {
+                utility::LogWarning(
+                        "Read PLY header failed: list properties of vertices "
+                        "are not supported.");
+                return false;
+            }
+            begin_ = p;
+            num_points_ = element.size_;
+            record_size_ = element.record_size_;
+            num_columns_ = static_cast<int>(element.properties_.size());
+            for (size_t i = 0; i < element.properties_.size(); ++i) {
+                const PLYElementLayout::Property &property =
+                        element.properties_[i];
+                PointField field;
+                field.name_ = property.name_;
+                field.dtype_ = property.dtype_;
+                field.offset_ = binary_ ? property.byte_offset_
+                                        : static_cast<int64_t>(i);
+                GetAttributeOfField(field.name_, field.attr_,
+                                    field.num_components_, field.component_);
+                fields_.push_back(field);
+            }
+            return CheckPointFields(fields_);
+        }
+        if (binary_ && element.has_list_) {
+            utility::LogWarning(
+                    "Read PLY header failed: list properties before the "
+                    "vertices are not supported.");
+            return false;
+        }
+        if (binary_) {
+            p += std::min<int64_t>(element.size_ * element.record_size_,
+                                   end_ - p);
+        } else {
+            int64_t num_skipped = 0;
+            p = SkipLines(p, end_, element.size_, num_skipped);
+        }
+    }
+    utility::LogWarning("Read PLY header failed: no vertex element.");
+    return false;
+}
+
+PointCloudReader::PointCloudReader() : impl_(new Impl()) {}
+
+PointCloudReader::~PointCloudReader() {}
+
+bool PointCloudReader::Open(const std::string &filename,
+                            const std::string &format) {
+    Close();
+    const std::string file_format =
+            format == "auto"
+                    ? utility::filesystem::GetFileExtensionInLowerCase(
+                              filename)
+                    : format;
+    if (!IsTextFormat(file_format) && file_format != "pcd" &&
+        file_format != "ply") {
+        utility::LogWarning(
+                "Read point cloud chunks failed: unsupported format {}.",
+                file_format);
+        return false;
+    }
+    if (!impl_->file_.Open(filename)) {
+        utility::LogWarning(
+                "Read point cloud chunks failed: unable to open file {}: {}",
+                filename, impl_->file_.GetError());
+        return false;
+    }
+    impl_->begin_ = impl_->file_.GetData();
+    impl_->end_ = impl_->begin_ + impl_->file_.GetSize();
+
+    bool success = false;
+    if (file_format == "pts") {
+        success = impl_->ParsePTSHeader();
+    } else if (file_format == "pcd") {
+        success = impl_->ParsePCDHeader();
+    } else if (file_format == "ply") {
+        success = impl_->ParsePLYHeader();
+    } else {
+        success = impl_->ParseXYZHeader(file_format);
+    }
+    if (success && impl_->binary_ &&
+        impl_->num_points_ * impl_->record_size_ >
+                impl_->end_ - impl_->begin_) {
+        utility::LogWarning(
+                "Read point cloud chunks failed: file {} is truncated.",
+                filename);
+        success = false;
+    }
+    if (!success) {
+        Close();
+        return false;
+    }
+    impl_->cursor_ = impl_->begin_;
+    impl_->is_opened_ = true;
+    return true;
+}
+
+void PointCloudReader::Close() {
+    impl_.reset(new Impl());
+}
+
+bool PointCloudReader::IsOpened() const { return impl_->is_opened_; }
+
+bool PointCloudReader::IsEOF() const {
+    return impl_->position_ >= impl_->num_points_;
+}
+
+int64_t PointCloudReader::GetNumPoints() const { return impl_->num_points_; }
+
+int64_t PointCloudReader::GetPosition() const { return impl_->position_; }
+
+bool PointCloudReader::Seek(int64_t index) {
+    if (!IsOpened() || index < 0 || index > impl_->num_points_) {
+        utility::LogWarning("Seek to point {} failed.", index);
+        return false;
+    }
+    if (!impl_->binary_) {
+        if (index < impl_->position_) {
+            impl_->cursor_ = impl_->begin_;
+            impl_->position_ = 0;
+        }
+        int64_t num_skipped = 0;
+        impl_->cursor_ = SkipLines(impl_->cursor_, impl_->end_,
+                                   index - impl_->position_, num_skipped);
+        if (num_skipped < index - impl_->position_) {
+            impl_->position_ += num_skipped;
+            impl_->num_points_ = impl_->position_;
+            utility::LogWarning("Seek to point {} failed: file is truncated.",
+                                index);
+            return false;
+        }
+    }
+    impl_->position_ = index;
+    return true;
+}
+
+geometry::PointCloud PointCloudReader::Read(int64_t num_points) {
+    geometry::PointCloud pointcloud;
+    if (!IsOpened() || num_points <= 0) {
+        return pointcloud;
+    }
+    num_points = std::min(num_points, impl_->num_points_ - impl_->position_);
+    if (num_points <= 0) {
+        return pointcloud;
+    }
+
+    // Text rows are parsed into doubles first and converted per field below.
+    const char *records = nullptr;
+    std::vector<double> rows;
+    int64_t num_rows = num_points;
+    if (impl_->binary_) {
+        records = impl_->begin_ + impl_->position_ * impl_->record_size_;
+        impl_->position_ += num_points;
+    } else {
+        int64_t num_lines = 0;
+        const char *chunk_end = SkipLines(impl_->cursor_, impl_->end_,
+                                          num_points, num_lines);
+        num_rows = open3d::io::ParseASCIIRows(
+                impl_->cursor_, chunk_end - impl_->cursor_,
+                impl_->num_columns_, [&](int64_t max_rows) {
+                    rows.resize(max_rows * impl_->num_columns_);
+                    return rows.data();
+                });
+        impl_->cursor_ = chunk_end;
+        impl_->position_ += num_lines;
+        if (num_lines < num_points) {
+            utility::LogWarning(
+                    "File has {} points instead of the {} points stated in "
+                    "its header.",
+                    impl_->position_, impl_->num_points_);
+            impl_->num_points_ = impl_->position_;
+        }
+    }
+
+    const int64_t record_size = impl_->record_size_;
+    const int64_t num_columns = impl_->num_columns_;
+    for (const PointField &field : impl_->fields_) {
+        if (!pointcloud.GetPointAttr().Contains(field.attr_)) {
+            pointcloud.SetPointAttr(
+                    field.attr_,
+                    core::Tensor::Empty({num_rows, field.num_components_},
+                                        field.dtype_));
+        }
+        core::Tensor &attr = pointcloud.GetPointAttr(field.attr_);
+        const int64_t offset = field.offset_;
+        const int stride = field.num_components_;
+        const int component = field.component_;
+        if (field.packed_type_ != 0) {
+            uint8_t *colors = attr.GetDataPtr<uint8_t>();
+            const char packed_type = field.packed_type_;
+            core::ParallelFor(
+                    core::Device("CPU:0"), num_rows, [&](int64_t i) {
+                        uint8_t bgr[4];
+                        if (records != nullptr) {
+                            std::memcpy(bgr, records + i * record_size + offset,
+                                        4);
+                        } else {
+                            const double value = rows[i * num_columns + offset];
+                            uint32_t packed = 0;
+                            if (packed_type == 'F') {
+                                const float value_float = float(value);
+                                std::memcpy(&packed, &value_float, 4);
+                            } else {
+                                packed = uint32_t(int64_t(value));
+                            }
+                            for (int c = 0; c < 4; ++c) {
+                                bgr[c] = uint8_t(packed >> (8 * c));
+                            }
+                        }
+                        colors[i * 3 + 0] = bgr[2];
+                        colors[i * 3 + 1] = bgr[1];
+                        colors[i * 3 + 2] = bgr[0];
+                    });
+            continue;
+        }
+        DISPATCH_DTYPE_TO_TEMPLATE(field.dtype_, [&]() {
+            scalar_t *values = attr.GetDataPtr<scalar_t>() + component;
+            if (records != nullptr) {
+                core::ParallelFor(
+                        core::Device("CPU:0"), num_rows, [&](int64_t i) {
+                            std::memcpy(values + i * stride,
+                                        records + i * record_size + offset,
+                                        sizeof(scalar_t));
+                        });
+            } else {
+                core::ParallelFor(
+                        core::Device("CPU:0"), num_rows, [&](int64_t i) {
+                            values[i * stride] = static_cast<scalar_t>(
+                                    rows[i * num_columns + offset]);
+                        });
+            }
+        });
+    }
+    return pointcloud;
+}
+
+struct PointCloudWriter::Impl {
+    utility::filesystem::CFile file_;
+    std::string format_;
+    bool ascii_ = true;
+    bool has_layout_ = false;
+    int64_t record_size_ = 0;
+    int64_t num_points_ = 0;
+    std::vector<PointField> fields_;
+    /// File positions of the point counts in the header.
+    std::vector<int64_t> count_positions_;
+
+    void AddAttribute(const std::string &attr,
+                      const std::vector<std::string> &names,
+                      core::Dtype dtype) {
+        for (size_t i = 0; i < names.size(); ++i) {
+            PointField field;
+            field.name_ = names[i];
+            field.attr_ = attr;
+            field.num_components_ = static_cast<int>(names.size());
+            field.component_ = static_cast<int>(i);
+            field.dtype_ = dtype;
+            field.offset_ = record_size_;
+            record_size_ += dtype.ByteSize();
+            fields_.push_back(field);
+        }
+    }
+
+    bool SetLayout(const geometry::PointCloud &pointcloud);
+    bool WriteHeader();
+    void WritePointCount();
+};
+
+bool PointCloudWriter::Impl::SetLayout(
+        const geometry::PointCloud &pointcloud) {
+    // Chunks without points still define the layout.
+    const geometry::TensorMap &attrs = pointcloud.GetPointAttr();
+    if (!attrs.Contains("positions")) {
+        utility::LogWarning("Write point cloud chunk failed: no positions.");
+        return false;
+    }
+    const core::Dtype positions_dtype = attrs.at("positions").GetDtype();
+    if (IsTextFormat(format_)) {
+        AddAttribute("positions", {"x", "y", "z"}, core::Float64);
+        std::string required_attr;
+        if (format_ == "xyzn") {
+            AddAttribute("normals", {"nx", "ny", "nz"}, core::Float64);
+            required_attr = "normals";
+        } else if (format_ == "xyzrgb") {
+            AddAttribute("colors", {"r", "g", "b"}, core::Float64);
+            required_attr = "colors";
+        } else if (format_ == "xyzi" ||
+                   (format_ == "pts" && attrs.Contains("intensities"))) {
+            AddAttribute("intensities", {"i"}, core::Float64);
+            required_attr = format_ == "xyzi" ? "intensities" : "";
+        }
+        if (format_ == "pts" && attrs.Contains("colors")) {
+            AddAttribute("colors", {"r", "g", "b"}, core::UInt8);
+        }
+        if (!required_attr.empty() && !attrs.Contains(required_attr)) {
+            utility::LogWarning(
+                    "Write point cloud chunk failed: {} requires {}.", format_,
+                    required_attr);
+            return false;
+        }
+    } else if (format_ == "pcd") {
+        AddAttribute("positions", {"x", "y", "z"}, positions_dtype);
+        if (attrs.Contains("normals")) {
+            AddAttribute("normals", {"normal_x", "normal_y", "normal_z"},
+                         attrs.at("normals").GetDtype());
+        }
+        if (attrs.Contains("colors")) {
+            AddAttribute("colors", {"rgb"}, core::Float32);
+            fields_.back().num_components_ = 3;
+            fields_.back().packed_type_ = 'F';
+        }
+    } else {
+        AddAttribute("positions", {"x", "y", "z"}, positions_dtype);
+        if (attrs.Contains("normals")) {
+            AddAttribute("normals", {"nx", "ny", "nz"},
+                         attrs.at("normals").GetDtype());
+        }
+        if (attrs.Contains("colors")) {
+            AddAttribute("colors", {"red", "green", "blue"}, core::UInt8);
+        }
+    }
+    if (format_ == "pcd" || format_ == "ply") {
+        for (const auto &kv : attrs) {
+            if (kv.first == "positions" || kv.first == "normals" ||
+                kv.first == "colors") {
+                continue;
+            }
+            const core::Dtype dtype = kv.second.GetDtype();
+            const bool supported =
+                    format_ == "pcd" ? GetPCDTypeFromDtype(dtype) != 0
+                                     : !GetPLYTypeFromDtype(dtype).empty();
+            if (kv.second.NumDims() > 2 ||
+                (kv.second.NumDims() == 2 && kv.second.GetShape(1) != 1) ||
+                !supported) {
+                utility::LogWarning(
+                        "Attribute {} with shape {} and dtype {} is not "
+                        "written.",
+                        kv.first, kv.second.GetShape(), dtype.ToString());
+                continue;
+            }
+            AddAttribute(kv.first, {kv.first}, dtype);
+        }
+    }
+    for (PointField &field : fields_) {
+        const bool supported =
+                format_ == "pcd" ? GetPCDTypeFromDtype(field.dtype_) != 0
+                                 : !GetPLYTypeFromDtype(field.dtype_).empty();
+        if (!supported) {
+            utility::LogWarning(
+                    "Write point cloud chunk failed: unsupported dtype {} for "
+                    "{}.",
+                    field.dtype_.ToString(), field.attr_);
+            return false;
+        }
+    }
+    has_layout_ = true;
+    return WriteHeader();
+}
+
+bool PointCloudWriter::Impl::WriteHeader() {
+    FILE *file = file_.GetFILE();
+    // Point counts are written as fixed-width fields and updated on close.
+    auto write_count = [&]() {
+        count_positions_.push_back(file_.CurPos());
+        fprintf(file, "%-20lld", 0LL);
+    };
+    if (format_ == "pts") {
+        write_count();
+        fprintf(file, "\r\n");
+    } else if (format_ == "pcd") {
+        fprintf(file, "# .PCD v0.7 - Point Cloud Data file format\n");
+        fprintf(file, "VERSION 0.7\nFIELDS");
+        for (const PointField &field : fields_) {
+            fprintf(file, " %s", field.name_.c_str());
+        }
+        fprintf(file, "\nSIZE");
+        for (const PointField &field : fields_) {
+            fprintf(file, " %d", int(field.dtype_.ByteSize()));
+        }
+        fprintf(file, "\nTYPE");
+        for (const PointField &field : fields_) {
+            fprintf(file, " %c", GetPCDTypeFromDtype(field.dtype_));
+        }
+        fprintf(file, "\nCOUNT");
+        for (size_t i = 0; i < fields_.size(); ++i) {
+            fprintf(file, " 1");
+        }
+        fprintf(file, "\nWIDTH ");
+        write_count();
+        fprintf(file, "\nHEIGHT 1\nVIEWPOINT 0 0 0 1 0 0 0\nPOINTS ");
+        write_count();
+        fprintf(file, "\nDATA %s\n", ascii_ ? "ascii" : "binary");
+    } else if (format_ == "ply") {
+        fprintf(file, "ply\nformat %s 1.0\n",
+                ascii_ ? "ascii" : "binary_little_endian");
+        fprintf(file, "comment Created by Open3D\nelement vertex ");
+        write_count();
+        fprintf(file, "\n");
+        for (const PointField &field : fields_) {
+            fprintf(file, "property %s %s\n",
+                    GetPLYTypeFromDtype(field.dtype_).c_str(),
+                    field.name_.c_str());
+        }
+        fprintf(file, "end_header\n");
+    }
+    return !ferror(file);
+}
+
+void PointCloudWriter::Impl::WritePointCount() {
+    FILE *file = file_.GetFILE();
+    for (int64_t position : count_positions_) {
+        fseek(file, static_cast<long>(position), SEEK_SET);
+        fprintf(file, "%-20lld", static_cast<long long>(num_points_));
+    }
+}
+
+// Converts colors between the float range [0, 1] and the integer range of
+// UInt8, following the conversion of the point cloud writers.
+static core::Tensor ConvertColors(const core::Tensor &colors,
+                                  core::Dtype dtype) {
+    const core::Dtype src_dtype = colors.GetDtype();
+    const bool src_float =
+            src_dtype == core::Float32 || src_dtype == core::Float64;
+    const bool dst_float = dtype == core::Float32 || dtype == core::Float64;
+    if (src_float == dst_float) {
+        return colors.To(dtype);
+    }
+    double max_value = 255.0;
+    if (src_dtype == core::UInt16) {
+        max_value = 65535.0;
+    }
+    if (dst_float) {
+        return colors.To(dtype).Div(max_value);
+    }
+    return colors.To(core::Float64).Clip(0, 1).Mul(255).Round().To(dtype);
+}
+
+PointCloudWriter::PointCloudWriter() : impl_(new Impl()) {}
+
+PointCloudWriter::~PointCloudWriter() {
+    if (IsOpened()) {
+        Close();
+    }
+}
+
+bool PointCloudWriter::Open(const std::string &filename,
+                            const std::string &format,
+                            bool write_ascii) {
+    if (IsOpened()) {
+        Close();
+    }
+    impl_.reset(new Impl());
+    impl_->format_ =
+            format == "auto"
+                    ? utility::filesystem::GetFileExtensionInLowerCase(
+                              filename)
+                    : format;
+    if (!IsTextFormat(impl_->format_) && impl_->format_ != "pcd" &&
+        impl_->format_ != "ply") {
+        utility::LogWarning(
+                "Write point cloud chunks failed: unsupported format {}.",
+                impl_->format_);
+        return false;
+    }
+    if ((impl_->format_ == "pcd" || impl_->format_ == "ply") &&
+        !write_ascii && !IsLittleEndian()) {
+        utility::LogWarning(
+                "Write point cloud chunks failed: binary output requires a "
+                "little-endian host.");
+        return false;
+    }
+    impl_->ascii_ = IsTextFormat(impl_->format_) || write_ascii;
+    if (!impl_->file_.Open(filename, "wb")) {
+        utility::LogWarning(
+                "Write point cloud chunks failed: unable to open file {}: {}",
+                filename, impl_->file_.GetError());
+        return false;
+    }
+    return true;
+}
+
+bool PointCloudWriter::Write(const geometry::PointCloud &pointcloud) {
+    if (!IsOpened()) {
+        utility::LogWarning("Write point cloud chunk failed: no open file.");
+        return false;
+    }
+    if (!impl_->has_layout_ && !impl_->SetLayout(pointcloud)) {
+        return false;
+    }
+    if (!pointcloud.GetPointAttr().Contains("positions")) {
+        utility::LogWarning("Write point cloud chunk failed: no positions.");
+        return false;
+    }
+    const int64_t num_points =
+            pointcloud.GetPointAttr("positions").GetLength();
+
+    // Converts the attributes to the dtypes of the file, once per attribute.
+    std::vector<core::Tensor> values(impl_->fields_.size());
+    for (size_t i = 0; i < impl_->fields_.size(); ++i) {
+        const PointField &field = impl_->fields_[i];
+        if (i > 0 && impl_->fields_[i - 1].attr_ == field.attr_) {
+            values[i] = values[i - 1];
+            continue;
+        }
+        if (!pointcloud.GetPointAttr().Contains(field.attr_) ||
+            pointcloud.GetPointAttr(field.attr_).GetLength() != num_points) {
+            utility::LogWarning(
+                    "Write point cloud chunk failed: attribute {} is missing "
+                    "or has a wrong length.",
+                    field.attr_);
+            return false;
+        }
+        const core::Tensor &attr = pointcloud.GetPointAttr(field.attr_);
+        const core::Tensor cpu_attr =
+                attr.To(core::Device("CPU:0")).Reshape({num_points, -1});
+        if (field.attr_ == "colors") {
+            values[i] = ConvertColors(
+                    cpu_attr, field.packed_type_ ? core::UInt8 : field.dtype_);
+        } else {
+            values[i] = cpu_attr.To(field.dtype_);
+        }
+        values[i] = values[i].Contiguous();
+    }
+
+    FILE *file = impl_->file_.GetFILE();
+    if (!impl_->ascii_) {
+        // Interleaves the fields into records and writes them at once.
+        const int64_t record_size = impl_->record_size_;
+        std::vector<char> records(num_points * record_size);
+        for (size_t f = 0; f < impl_->fields_.size(); ++f) {
+            const PointField &field = impl_->fields_[f];
+            const char *src = static_cast<const char *>(values[f].GetDataPtr());
+            const int64_t byte_size = field.dtype_.ByteSize();
+            const int64_t stride =
+                    values[f].GetShape(1) * values[f].GetDtype().ByteSize();
+            const int64_t src_offset = field.component_ * byte_size;
+            char *dst = records.data() + field.offset_;
+            const bool packed = field.packed_type_ != 0;
+            core::ParallelFor(
+                    core::Device("CPU:0"), num_points, [&](int64_t i) {
+                        if (packed) {
+                            const uint8_t *rgb = reinterpret_cast<
+                                    const uint8_t *>(src + i * stride);
+                            const uint8_t bgr[4] = {rgb[2], rgb[1], rgb[0], 0};
+                            std::memcpy(dst + i * record_size, bgr, 4);
+                        } else {
+                            std::memcpy(dst + i * record_size,
+                                        src + i * stride + src_offset,
+                                        byte_size);
+                        }
+                    });
+        }
+        if (fwrite(records.data(), 1, records.size(), file) !=
+            records.size()) {
+            utility::LogWarning("Write point cloud chunk failed: {}",
+                                impl_->file_.GetError());
+            return false;
+        }
+        impl_->num_points_ += num_points;
+        return true;
+    }
+
+    const bool fixed_point = IsTextFormat(impl_->format_);
+    const char *line_end = impl_->format_ == "pts" ? "\r\n" : "\n";
+    for (int64_t i = 0; i < num_points; ++i) {
+        for (size_t f = 0; f < impl_->fields_.size(); ++f) {
+            const PointField &field = impl_->fields_[f];
+            const char *separator = f == 0 ? "" : " ";
+            if (field.packed_type_ != 0) {
+                const uint8_t *rgb = values[f].GetDataPtr<uint8_t>() + i * 3;
+                const uint8_t bgr[4] = {rgb[2], rgb[1], rgb[0], 0};
+                float packed;
+                std::memcpy(&packed, bgr, 4);
+                fprintf(file, "%s%.9g", separator, packed);
+                continue;
+            }
+            DISPATCH_DTYPE_TO_TEMPLATE(field.dtype_, [&]() {
+                const scalar_t value = values[f].GetDataPtr<scalar_t>()
+                        [i * values[f].GetShape(1) + field.component_];
+                if (std::is_floating_point<scalar_t>::value) {
+                    fprintf(file,
+                            fixed_point ? "%s%.10f"
+                            : sizeof(scalar_t) == 4 ? "%s%.9g"
+                                                    : "%s%.17g",
+                            separator, static_cast<double>(value));
+                } else if (std::is_signed<scalar_t>::value) {
+                    fprintf(file, "%s%lld", separator,
+                            static_cast<long long>(value));
+                } else {
+                    fprintf(file, "%s%llu", separator,
+                            static_cast<unsigned long long>(value));
+                }
+            });
+        }
+        fprintf(file, "%s", line_end);
+    }
+    if (ferror(file)) {
+        utility::LogWarning("Write point cloud chunk failed: {}",
+                            impl_->file_.GetError());
+        return false;
+    }
+    impl_->num_points_ += num_points;
+    return true;
+}
+
+bool PointCloudWriter::Close() {
+    if (!IsOpened()) {
+        return false;
+    }
+    bool success = true;
+    if (!impl_->has_layout_ &&
+        (impl_->format_ == "pts" || !IsTextFormat(impl_->format_))) {
+        // Writes a valid empty file if no chunk has been written.
+        geometry::PointCloud pointcloud;
+        pointcloud.SetPointPositions(
+                core::Tensor::Empty({0, 3}, core::Float32));
+        success = impl_->SetLayout(pointcloud);
+    }
+    impl_->WritePointCount();
+    success = success && !ferror(impl_->file_.GetFILE());
+    impl_->file_.Close();
+    return success;
+}
+
+bool PointCloudWriter::IsOpened() const {
+    return impl_->file_.GetFILE() != nullptr;
+}
+
+int64_t PointCloudWriter::GetNumPoints() const { return impl_->num_points_; }
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,135 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "open3d/t/geometry/PointCloud.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// \class PointCloudReader
+///
+/// \brief Reads a point cloud file a chunk of points at a time.
+///
+/// The file is memory-mapped and only the requested points are converted, so
+/// files larger than the available memory can be processed piece by piece,
+/// e.g. with VoxelDownSample or RemoveStatisticalOutliers applied per chunk.
+///
+/// Supported formats are xyz, xyzn, xyzrgb, xyzi, pts, ASCII and binary pcd,
+/// and ASCII and binary little-endian ply. For text formats every line of
+/// point data is one point; lines that cannot be parsed are skipped.
+class PointCloudReader {
+public:
+    PointCloudReader();
+    ~PointCloudReader();
+    PointCloudReader(const PointCloudReader &) = delete;
+    PointCloudReader &operator=(const PointCloudReader &) = delete;
+
+    /// Open a point cloud file and parse its header.
+    ///
+    /// \param filename Path to the point cloud file.
+    /// \param format File format, "auto" deduces it from the extension.
+    bool Open(const std::string &filename, const std::string &format = "auto");
+
+    /// Close the opened file.
+    void Close();
+
+    /// Check if a file is opened.
+    bool IsOpened() const;
+
+    /// Check if all points have been read.
+    bool IsEOF() const;
+
+    /// Number of points in the file.
+    int64_t GetNumPoints() const;
+
+    /// Index of the next point to be read.
+    int64_t GetPosition() const;
+
+    /// Move to the point with index \p index, so that the next Read() starts
+    /// there. Seeking in text files scans the lines in between.
+    bool Seek(int64_t index);
+
+    /// Read the next \p num_points points, or all remaining points if fewer
+    /// are left. Returns an empty point cloud at the end of the file.
+    geometry::PointCloud Read(int64_t num_points);
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+/// \class PointCloudWriter
+///
+/// \brief Writes a point cloud file a chunk of points at a time.
+///
+/// The attributes of the first chunk define the layout of the file and all
+/// following chunks must provide the same attributes. The number of points
+/// in the header is filled in by Close().
+///
+/// Supported formats are xyz, xyzn, xyzrgb, xyzi, pts, pcd and ply.
+class PointCloudWriter {
+public:
+    PointCloudWriter();
+    /// The destructor closes the file if it is still open.
+    ~PointCloudWriter();
+    PointCloudWriter(const PointCloudWriter &) = delete;
+    PointCloudWriter &operator=(const PointCloudWriter &) = delete;
+
+    /// Create a point cloud file.
+    ///
+    /// \param filename Path to the point cloud file.
+    /// \param format File format, "auto" deduces it from the extension.
+    /// \param write_ascii Write pcd and ply point data as text.
+    bool Open(const std::string &filename,
+              const std::string &format = "auto",
+              bool write_ascii = false);
+
+    /// Append the points of \p pointcloud to the file.
+    bool Write(const geometry::PointCloud &pointcloud);
+
+    /// Write the final number of points to the header and close the file.
+    bool Close();
+
+    /// Check if a file is opened.
+    bool IsOpened() const;
+
+    /// Number of points written so far.
+    int64_t GetNumPoints() const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -83,15 +83,24 @@ bool ReadImageFromJPG(const std::string &filename, geometry::Image &image) {
                 core::UInt8, image.GetDevice());
 
     int row_stride = cinfo.output_width * cinfo.output_components;
-    buffer = (*cinfo.mem->alloc_sarray)((j_common_ptr)&cinfo, JPOOL_IMAGE,
-                                        row_stride, 1);
     uint8_t *pdata = static_cast<uint8_t *>(image.GetDataPtr());
 
-    while (cinfo.output_scanline < cinfo.output_height) {
-        jpeg_read_scanlines(&cinfo, buffer, 1);
-        core::MemoryManager::MemcpyFromHost(pdata, image.GetDevice(), buffer[0],
-                                            row_stride * 1);
-        pdata += row_stride;
+    if (image.GetDevice().GetType() == core::Device::DeviceType::CPU) {
+        // Decode straight into the image, skipping the row buffer copy.
+        while (cinfo.output_scanline < cinfo.output_height) {
+            JSAMPROW row = pdata + static_cast<size_t>(cinfo.output_scanline) *
+                                           row_stride;
+            jpeg_read_scanlines(&cinfo, &row, 1);
+        }
+    } else {
+        buffer = (*cinfo.mem->alloc_sarray)((j_common_ptr)&cinfo, JPOOL_IMAGE,
+                                            row_stride, 1);
+        while (cinfo.output_scanline < cinfo.output_height) {
+            jpeg_read_scanlines(&cinfo, buffer, 1);
+            core::MemoryManager::MemcpyFromHost(pdata, image.GetDevice(),
+                                                buffer[0], row_stride * 1);
+            pdata += row_stride;
+        }
     }
     jpeg_finish_decompress(&cinfo);
     jpeg_destroy_decompress(&cinfo);
@@ -26,15 +26,18 @@
 
 #include <liblzf/lzf.h>
 
+#include <algorithm>
 #include <cinttypes>
 #include <cstdint>
 #include <cstdio>
-#include <sstream>
+#include <cstring>
+#include <vector>
 
 #include "open3d/core/Dtype.h"
 #include "open3d/core/ParallelFor.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/io/FileFormatIO.h"
+#include "open3d/t/io/PointCloudFileHeader.h"
 #include "open3d/t/io/PointCloudIO.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
@@ -50,36 +53,6 @@ namespace open3d {
 namespace t {
 namespace io {
 
-enum class PCDDataType { ASCII = 0, BINARY = 1, BINARY_COMPRESSED = 2 };
-
-struct PCLPointField {
-public:
-    std::string name;
-    int size;
-    char type;
-    int count;
-    // helper variable
-    int count_offset = 0;
-    int offset = 0;
-};
-
-struct PCDHeader {
-public:
-    std::string version;
-    std::vector<PCLPointField> fields;
-    int width;
-    int height;
-    int points;
-    PCDDataType datatype;
-    std::string viewpoint;
-
-    // helper variables
-    int elementnum;
-    int pointsize;
-    std::unordered_map<std::string, bool> has_attr;
-    std::unordered_map<std::string, core::Dtype> attr_dtype;
-};
-
 struct ReadAttributePtr {
     ReadAttributePtr(void *data_ptr = nullptr,
                      const int row_idx = 0,
@@ -108,31 +81,11 @@ struct WriteAttributePtr {
 };
 
 static core::Dtype GetDtypeFromPCDHeaderField(char type, int size) {
-    if (type == 'I') {
-        if (size == 1) return core::Dtype::Int8;
-        if (size == 2) return core::Dtype::Int16;
-        if (size == 4) return core::Dtype::Int32;
-        if (size == 8)
-            return core::Dtype::Int64;
-        else
-            utility::LogError("Unsupported data type.");
-    } else if (type == 'U') {
-        if (size == 1) return core::Dtype::UInt8;
-        if (size == 2) return core::Dtype::UInt16;
-        if (size == 4) return core::Dtype::UInt32;
-        if (size == 8)
-            return core::Dtype::UInt64;
-        else
-            utility::LogError("Unsupported data type.");
-    } else if (type == 'F') {
-        if (size == 4) return core::Dtype::Float32;
-        if (size == 8)
-            return core::Dtype::Float64;
-        else
-            utility::LogError("Unsupported data type.");
-    } else {
+    const core::Dtype dtype = GetDtypeFromPCDType(type, size);
+    if (dtype == core::Undefined) {
         utility::LogError("Unsupported data type.");
     }
+    return dtype;
 }
 
 static bool InitializeHeader(PCDHeader &header) {
@@ -211,102 +164,15 @@ static bool InitializeHeader(PCDHeader &header) {
 
 static bool ReadPCDHeader(FILE *file, PCDHeader &header) {
     char line_buffer[DEFAULT_IO_BUFFER_SIZE];
-    size_t specified_channel_count = 0;
-
-    while (fgets(line_buffer, DEFAULT_IO_BUFFER_SIZE, file)) {
-        std::string line(line_buffer);
-        if (line == "") {
-            continue;
-        }
-        std::vector<std::string> st = utility::SplitString(line, "\t\r\n ");
-        std::stringstream sstream(line);
-        sstream.imbue(std::locale::classic());
-        std::string line_type;
-        sstream >> line_type;
-        if (line_type.substr(0, 1) == "#") {
-        } else if (line_type.substr(0, 7) == "VERSION") {
-            if (st.size() >= 2) {
-                header.version = st[1];
-            }
-        } else if (line_type.substr(0, 6) == "FIELDS" ||
-                   line_type.substr(0, 7) == "COLUMNS") {
-            specified_channel_count = st.size() - 1;
-            if (specified_channel_count == 0) {
-                utility::LogWarning("[ReadPCDHeader] Bad PCD file format.");
-                return false;
-            }
-            header.fields.resize(specified_channel_count);
-            int count_offset = 0, offset = 0;
-            for (size_t i = 0; i < specified_channel_count;
-                 ++i, count_offset += 1, offset += 4) {
-                header.fields[i].name = st[i + 1];
-                header.fields[i].size = 4;
-                header.fields[i].type = 'F';
-                header.fields[i].count = 1;
-                header.fields[i].count_offset = count_offset;
-                header.fields[i].offset = offset;
-            }
-            header.elementnum = count_offset;
-            header.pointsize = offset;
-        } else if (line_type.substr(0, 4) == "SIZE") {
-            if (specified_channel_count != st.size() - 1) {
-                utility::LogWarning("[ReadPCDHeader] Bad PCD file format.");
-                return false;
-            }
-            int offset = 0, col_type = 0;
-            for (size_t i = 0; i < specified_channel_count;
-                 ++i, offset += col_type) {
-                sstream >> col_type;
-                header.fields[i].size = col_type;
-                header.fields[i].offset = offset;
-            }
-            header.pointsize = offset;
-        } else if (line_type.substr(0, 4) == "TYPE") {
-            if (specified_channel_count != st.size() - 1) {
-                utility::LogWarning("[ReadPCDHeader] Bad PCD file format.");
-                return false;
-            }
-            for (size_t i = 0; i < specified_channel_count; ++i) {
-                header.fields[i].type = st[i + 1].c_str()[0];
-            }
-        } else if (line_type.substr(0, 5) == "COUNT") {
-            if (specified_channel_count != st.size() - 1) {
-                utility::LogWarning("[ReadPCDHeader] Bad PCD file format.");
-                return false;
-            }
-            int count_offset = 0, offset = 0, col_count = 0;
-            for (size_t i = 0; i < specified_channel_count; ++i) {
-                sstream >> col_count;
-                header.fields[i].count = col_count;
-                header.fields[i].count_offset = count_offset;
-                header.fields[i].offset = offset;
-                count_offset += col_count;
-                offset += col_count * header.fields[i].size;
-            }
-            header.elementnum = count_offset;
-            header.pointsize = offset;
-        } else if (line_type.substr(0, 5) == "WIDTH") {
-            sstream >> header.width;
-        } else if (line_type.substr(0, 6) == "HEIGHT") {
-            sstream >> header.height;
-            header.points = header.width * header.height;
-        } else if (line_type.substr(0, 9) == "VIEWPOINT") {
-            if (st.size() >= 2) {
-                header.viewpoint = st[1];
-            }
-        } else if (line_type.substr(0, 6) == "POINTS") {
-            sstream >> header.points;
-        } else if (line_type.substr(0, 4) == "DATA") {
-            header.datatype = PCDDataType::ASCII;
-            if (st.size() >= 2) {
-                if (st[1].substr(0, 17) == "binary_compressed") {
-                    header.datatype = PCDDataType::BINARY_COMPRESSED;
-                } else if (st[1].substr(0, 6) == "binary") {
-                    header.datatype = PCDDataType::BINARY;
-                }
-            }
-            break;
+    auto read_line = [&](std::string &line) {
+        if (!fgets(line_buffer, DEFAULT_IO_BUFFER_SIZE, file)) {
+            return false;
         }
+        line = line_buffer;
+        return true;
+    };
+    if (!ReadPCDHeaderLines(read_line, header)) {
+        return false;
     }
     if (!InitializeHeader(header)) {
         return false;
@@ -454,21 +320,39 @@ static void ReadBinaryPCDColorsFromField(ReadAttributePtr &attr,
     }
 }
 
-static void ReadBinaryPCDElementsFromField(ReadAttributePtr &attr,
-                                           const PCLPointField &field,
-                                           const void *data_ptr,
-                                           const int index) {
+// De-interleaves one field of \p num_points binary records, whose field
+// values are \p stride bytes apart starting at \p base_ptr.
+static void ReadBinaryPCDField(ReadAttributePtr &attr,
+                               const PCLPointField &field,
+                               const char *base_ptr,
+                               int64_t stride,
+                               int64_t num_points) {
+    if (attr.data_ptr_ == nullptr) {
+        return;
+    }
+    if (field.name == "rgb" || field.name == "rgba") {
+        core::ParallelFor(core::Device("CPU:0"), num_points, [&](int64_t i) {
+            ReadBinaryPCDColorsFromField(attr, field, base_ptr + i * stride,
+                                         static_cast<int>(i));
+        });
+        return;
+    }
     DISPATCH_DTYPE_TO_TEMPLATE(
             GetDtypeFromPCDHeaderField(field.type, field.size), [&] {
                 scalar_t *attr_data_ptr =
-                        static_cast<scalar_t *>(attr.data_ptr_) +
-                        index * attr.row_length_ + attr.row_idx_;
-
-                std::memcpy(attr_data_ptr, data_ptr, sizeof(scalar_t));
+                        static_cast<scalar_t *>(attr.data_ptr_) + attr.row_idx_;
+                const int64_t row_length = attr.row_length_;
+                core::ParallelFor(
+                        core::Device("CPU:0"), num_points, [&](int64_t i) {
+                            std::memcpy(attr_data_ptr + i * row_length,
+                                        base_ptr + i * stride,
+                                        sizeof(scalar_t));
+                        });
             });
 }
 
 static bool ReadPCDData(FILE *file,
+                        const std::string &filename,
                         PCDHeader &header,
                         t::geometry::PointCloud &pointcloud,
                         const ReadPointCloudOption &params) {
@@ -570,28 +454,25 @@ static bool ReadPCDData(FILE *file,
             }
         }
     } else if (header.datatype == PCDDataType::BINARY) {
-        std::unique_ptr<char[]> buffer(new char[header.pointsize]);
-        for (int i = 0; i < header.points; ++i) {
-            if (fread(buffer.get(), header.pointsize, 1, file) != 1) {
-                utility::LogWarning(
-                        "[ReadPCDData] Failed to read data record.");
-                pointcloud.Clear();
-                return false;
-            }
-            for (const auto &field : header.fields) {
-                if (field.name == "rgb" || field.name == "rgba") {
-                    ReadBinaryPCDColorsFromField(
-                            map_field_to_attr_ptr["colors"], field,
-                            buffer.get() + field.offset, i);
-                } else {
-                    ReadBinaryPCDElementsFromField(
-                            map_field_to_attr_ptr[field.name], field,
-                            buffer.get() + field.offset, i);
-                }
-            }
-            if (i % 1000 == 0) {
-                reporter.Update(i);
-            }
+        // Map the file and de-interleave the records field by field instead
+        // of reading them one at a time.
+        const int64_t data_offset = ftell(file);
+        utility::filesystem::MappedFile mapped_file;
+        if (data_offset < 0 || !mapped_file.Open(filename) ||
+            data_offset + int64_t(header.points) * header.pointsize >
+                    int64_t(mapped_file.GetSize())) {
+            utility::LogWarning("[ReadPCDData] Failed to read data record.");
+            pointcloud.Clear();
+            return false;
+        }
+        const char *records = mapped_file.GetData() + data_offset;
+        for (const auto &field : header.fields) {
+            const std::string attr_name =
+                    field.name == "rgb" || field.name == "rgba" ? "colors"
+                                                                : field.name;
+            ReadBinaryPCDField(map_field_to_attr_ptr[attr_name], field,
+                               records + field.offset, header.pointsize,
+                               header.points);
         }
     } else if (header.datatype == PCDDataType::BINARY_COMPRESSED) {
         double reporter_total = 100.0;
@@ -637,19 +518,12 @@ static bool ReadPCDData(FILE *file,
             double progress =
                     double(base_ptr - buffer.get()) / uncompressed_size;
             reporter.Update(int(reporter_total * (progress + .2)));
-            if (field.name == "rgb" || field.name == "rgba") {
-                for (int i = 0; i < header.points; ++i) {
-                    ReadBinaryPCDColorsFromField(
-                            map_field_to_attr_ptr["colors"], field,
-                            base_ptr + i * field.size * field.count, i);
-                }
-            } else {
-                for (int i = 0; i < header.points; ++i) {
-                    ReadBinaryPCDElementsFromField(
-                            map_field_to_attr_ptr[field.name], field,
-                            base_ptr + i * field.size * field.count, i);
-                }
-            }
+            const std::string attr_name =
+                    field.name == "rgb" || field.name == "rgba" ? "colors"
+                                                                : field.name;
+            ReadBinaryPCDField(map_field_to_attr_ptr[attr_name], field,
+                               base_ptr, field.size * field.count,
+                               header.points);
         }
     }
     reporter.Finish();
@@ -660,39 +534,11 @@ static bool ReadPCDData(FILE *file,
 
 static void SetPCDHeaderFieldTypeAndSizeFromDtype(const core::Dtype &dtype,
                                                   PCLPointField &field) {
-    if (dtype == core::Int8) {
-        field.type = 'I';
-        field.size = 1;
-    } else if (dtype == core::Int16) {
-        field.type = 'I';
-        field.size = 2;
-    } else if (dtype == core::Int32) {
-        field.type = 'I';
-        field.size = 4;
-    } else if (dtype == core::Int64) {
-        field.type = 'I';
-        field.size = 8;
-    } else if (dtype == core::UInt8) {
-        field.type = 'U';
-        field.size = 1;
-    } else if (dtype == core::UInt16) {
-        field.type = 'U';
-        field.size = 2;
-    } else if (dtype == core::UInt32) {
-        field.type = 'U';
-        field.size = 4;
-    } else if (dtype == core::UInt64) {
-        field.type = 'U';
-        field.size = 8;
-    } else if (dtype == core::Float32) {
-        field.type = 'F';
-        field.size = 4;
-    } else if (dtype == core::Float64) {
-        field.type = 'F';
-        field.size = 8;
-    } else {
+    field.type = GetPCDTypeFromDtype(dtype);
+    if (field.type == 0) {
         utility::LogError("Unsupported data type.");
     }
+    field.size = static_cast<int>(dtype.ByteSize());
 }
 
 static bool GenerateHeader(const t::geometry::PointCloud &pointcloud,
@@ -999,6 +845,36 @@ int WriteElementDataToFileASCII<std::uint64_t>(const std::uint64_t &data,
     return fprintf(file, "%" PRIu64 " ", data);
 }
 
+// Compresses \p size bytes of \p data in independent blocks on all cores.
+// LZF back-references never reach before the start of their block, so the
+// concatenated blocks form a single LZF stream that any LZF decoder, e.g. the
+// one of PCL, decompresses to the original data.
+static bool CompressLZFBlocks(const char *data,
+                              std::uint32_t size,
+                              std::vector<std::vector<char>> &blocks) {
+    // LZF only looks back 8 KiB, so the block size barely affects the ratio.
+    const std::int64_t block_size = 1 << 20;
+    const std::int64_t num_blocks = (size + block_size - 1) / block_size;
+    blocks.assign(num_blocks, std::vector<char>());
+    core::ParallelFor(core::Device("CPU:0"), num_blocks, [&](std::int64_t b) {
+        const std::int64_t begin = b * block_size;
+        const std::int64_t length = std::min(block_size, size - begin);
+        // Incompressible data grows by less than 4%.
+        std::vector<char> &block = blocks[b];
+        block.resize(length + length / 16 + 16);
+        block.resize(lzf_compress(data + begin,
+                                  static_cast<unsigned int>(length),
+                                  block.data(),
+                                  static_cast<unsigned int>(block.size())));
+    });
+    for (const auto &block : blocks) {
+        if (block.empty()) {
+            return false;
+        }
+    }
+    return num_blocks > 0;
+}
+
 static bool WritePCDData(FILE *file,
                          const PCDHeader &header,
                          const geometry::PointCloud &pointcloud,
@@ -1065,27 +941,26 @@ static bool WritePCDData(FILE *file,
         }
     } else if (header.datatype == PCDDataType::BINARY) {
         std::vector<char> buffer((header.pointsize * header.points));
-        std::uint32_t buffer_index = 0;
-        for (std::int64_t i = 0; i < num_points; ++i) {
-            for (auto &it : attribute_ptrs) {
-                DISPATCH_DTYPE_TO_TEMPLATE(it.dtype_, [&]() {
-                    const scalar_t *data_ptr =
-                            static_cast<const scalar_t *>(it.data_ptr_);
-
-                    for (int idx_offset = it.group_size_ * i;
-                         idx_offset < it.group_size_ * (i + 1); ++idx_offset) {
-                        std::memcpy(buffer.data() + buffer_index,
-                                    reinterpret_cast<const char *>(
-                                            &data_ptr[idx_offset]),
-                                    sizeof(scalar_t));
-                        buffer_index += sizeof(scalar_t);
-                    }
-                });
-            }
+        const std::int64_t point_size = header.pointsize;
+        std::int64_t field_offset = 0;
+        std::int64_t count = 0;
+        reporter.SetTotal(attribute_ptrs.size());
+        for (auto &it : attribute_ptrs) {
+            DISPATCH_DTYPE_TO_TEMPLATE(it.dtype_, [&]() {
+                const scalar_t *data_ptr =
+                        static_cast<const scalar_t *>(it.data_ptr_);
+                const int group_size = it.group_size_;
+                char *field_ptr = buffer.data() + field_offset;
+                core::ParallelFor(
+                        core::Device("CPU:0"), num_points, [&](std::int64_t i) {
+                            std::memcpy(field_ptr + i * point_size,
+                                        &data_ptr[i * group_size],
+                                        group_size * sizeof(scalar_t));
+                        });
+                field_offset += group_size * sizeof(scalar_t);
+            });
 
-            if (i % 1000 == 0) {
-                reporter.Update(i);
-            }
+            reporter.Update(count++);
         }
 
         fwrite(buffer.data(), sizeof(char), buffer.size(), file);
@@ -1104,7 +979,6 @@ static bool WritePCDData(FILE *file,
         const std::uint32_t buffer_size_in_bytes =
                 header.pointsize * header.points;
         std::vector<char> buffer(buffer_size_in_bytes);
-        std::vector<char> buffer_compressed(2 * buffer_size_in_bytes);
 
         std::uint32_t buffer_index = 0;
         std::int64_t count = 0;
@@ -1112,30 +986,36 @@ static bool WritePCDData(FILE *file,
             DISPATCH_DTYPE_TO_TEMPLATE(it.dtype_, [&]() {
                 const scalar_t *data_ptr =
                         static_cast<const scalar_t *>(it.data_ptr_);
+                const int group_size = it.group_size_;
 
-                for (int idx_offset = 0; idx_offset < it.group_size_;
+                for (int idx_offset = 0; idx_offset < group_size;
                      ++idx_offset) {
-                    for (std::int64_t i = 0; i < num_points; ++i) {
-                        std::memcpy(buffer.data() + buffer_index,
-                                    reinterpret_cast<const char *>(
-                                            &data_ptr[i * it.group_size_ +
-                                                      idx_offset]),
-                                    sizeof(scalar_t));
-                        buffer_index += sizeof(scalar_t);
-                    }
+                    char *column_ptr = buffer.data() + buffer_index;
+                    core::ParallelFor(
+                            core::Device("CPU:0"), num_points,
+                            [&](std::int64_t i) {
+                                std::memcpy(column_ptr + i * sizeof(scalar_t),
+                                            &data_ptr[i * group_size +
+                                                      idx_offset],
+                                            sizeof(scalar_t));
+                            });
+                    buffer_index += num_points * sizeof(scalar_t);
                 }
             });
 
             reporter.Update(count++);
         }
 
-        std::uint32_t size_compressed = lzf_compress(
-                buffer.data(), buffer_size_in_bytes, buffer_compressed.data(),
-                buffer_size_in_bytes * 2);
-        if (size_compressed == 0) {
+        std::vector<std::vector<char>> blocks_compressed;
+        if (!CompressLZFBlocks(buffer.data(), buffer_size_in_bytes,
+                               blocks_compressed)) {
             utility::LogWarning("[WritePCDData] Failed to compress data.");
             return false;
         }
+        std::uint32_t size_compressed = 0;
+        for (const auto &block : blocks_compressed) {
+            size_compressed += static_cast<std::uint32_t>(block.size());
+        }
 
         utility::LogDebug(
                 "[WritePCDData] {:d} bytes data compressed into {:d} bytes.",
@@ -1145,7 +1025,9 @@ static bool WritePCDData(FILE *file,
 
         fwrite(&size_compressed, sizeof(size_compressed), 1, file);
         fwrite(&buffer_size_in_bytes, sizeof(buffer_size_in_bytes), 1, file);
-        fwrite(buffer_compressed.data(), 1, size_compressed, file);
+        for (const auto &block : blocks_compressed) {
+            fwrite(block.data(), 1, block.size(), file);
+        }
     }
     reporter.Finish();
     return true;
@@ -1180,7 +1062,7 @@ bool ReadPointCloudFromPCD(const std::string &filename,
                       header.has_attr["positions"] ? "yes" : "no",
                       header.has_attr["normals"] ? "yes" : "no",
                       header.has_attr["colors"] ? "yes" : "no");
-    if (!ReadPCDData(file, header, pointcloud, params)) {
+    if (!ReadPCDData(file, filename, header, pointcloud, params)) {
         utility::LogWarning("Read PCD failed: unable to read data.");
         fclose(file);
         return false;
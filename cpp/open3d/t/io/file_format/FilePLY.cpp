@@ -26,12 +26,16 @@
 
 #include <rply.h>
 
+#include <cstring>
+#include <unordered_map>
 #include <vector>
 
 #include "open3d/core/Dtype.h"
+#include "open3d/core/ParallelFor.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/t/geometry/TensorMap.h"
+#include "open3d/t/io/PointCloudFileHeader.h"
 #include "open3d/t/io/PointCloudIO.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Logging.h"
@@ -163,9 +167,150 @@ static std::tuple<std::string, int, int> GetNameStrideOffsetForAttribute(
     return std::make_tuple(name, 1, 0);
 }
 
+// Dtypes that are read without conversion, see GetDtype().
+static bool IsSupportedDtype(core::Dtype dtype) {
+    return dtype == core::UInt8 || dtype == core::UInt16 ||
+           dtype == core::Int32 || dtype == core::Float32 ||
+           dtype == core::Float64;
+}
+
+// Parses the header of a binary little-endian PLY file. Returns the offset of
+// the vertex records in the file, or -1 if the file does not qualify for the
+// memory-mapped reader.
+static int64_t ReadBinaryPLYVertexLayout(const char *data,
+                                         size_t size,
+                                         PLYElementLayout &vertex) {
+    const uint16_t endian_probe = 1;
+    if (*reinterpret_cast<const uint8_t *>(&endian_probe) != 1) {
+        return -1;
+    }
+
+    std::string format;
+    std::vector<PLYElementLayout> elements;
+    int64_t offset = ReadPLYHeader(data, size, format, elements);
+    if (offset < 0 || format != "binary_little_endian") {
+        return -1;
+    }
+
+    // Elements before the vertices must have fixed-size records to locate
+    // the vertex records.
+    for (const PLYElementLayout &element : elements) {
+        if (element.has_list_) {
+            return -1;
+        }
+        if (element.name_ == "vertex") {
+            if (element.size_ < 0 ||
+                offset + element.size_ * element.record_size_ >
+                        static_cast<int64_t>(size)) {
+                return -1;
+            }
+            vertex = element;
+            return offset;
+        }
+        offset += element.size_ * element.record_size_;
+    }
+    return -1;
+}
+
+// Reads the vertices of a binary little-endian PLY file by de-interleaving the
+// memory-mapped records into the attributes in one parallel pass. The
+// attributes do not alias the mapping, since the file may be overwritten
+// while the point cloud is alive. Returns false if the file does not qualify,
+// without modifying the point cloud.
+static bool ReadPointCloudFromMappedPLY(const std::string &filename,
+                                        geometry::PointCloud &pointcloud) {
+    utility::filesystem::MappedFile file;
+    if (!file.Open(filename)) {
+        return false;
+    }
+    PLYElementLayout vertex;
+    const int64_t offset =
+            ReadBinaryPLYVertexLayout(file.GetData(), file.GetSize(), vertex);
+    if (offset < 0) {
+        return false;
+    }
+
+    // Group the properties into attributes, as in the rply reader.
+    struct AttrLayout {
+        core::Dtype dtype_;
+        int stride_;
+        // Byte offsets in the record per component, -1 if missing.
+        std::vector<int64_t> byte_offsets_;
+    };
+    std::vector<std::string> attr_names;
+    std::unordered_map<std::string, AttrLayout> attrs;
+    for (const PLYElementLayout::Property &property : vertex.properties_) {
+        if (!IsSupportedDtype(property.dtype_)) {
+            utility::LogWarning(
+                    "Read PLY warning: skipping property \"{}\", unsupported "
+                    "datatype.",
+                    property.name_);
+            continue;
+        }
+        std::string attr_name;
+        int stride, component;
+        std::tie(attr_name, stride, component) =
+                GetNameStrideOffsetForAttribute(property.name_);
+        auto it = attrs.find(attr_name);
+        if (it == attrs.end()) {
+            attr_names.push_back(attr_name);
+            it = attrs.emplace(attr_name,
+                               AttrLayout{property.dtype_, stride,
+                                          std::vector<int64_t>(stride, -1)})
+                         .first;
+        } else if (it->second.dtype_ != property.dtype_) {
+            // Mixed component types, leave the conversion to rply.
+            return false;
+        }
+        it->second.byte_offsets_[component] = property.byte_offset_;
+    }
+
+    const int64_t num_points = vertex.size_;
+    const char *records = file.GetData() + offset;
+    pointcloud.Clear();
+
+    struct ComponentCopy {
+        char *dst_;
+        int64_t dst_stride_;
+        int64_t src_offset_;
+        int64_t byte_size_;
+    };
+    std::vector<ComponentCopy> copies;
+    for (const std::string &attr_name : attr_names) {
+        const AttrLayout &attr = attrs.at(attr_name);
+        core::Tensor tensor =
+                core::Tensor::Empty({num_points, attr.stride_}, attr.dtype_);
+        pointcloud.SetPointAttr(attr_name, tensor);
+        const int64_t byte_size = attr.dtype_.ByteSize();
+        for (int c = 0; c < attr.stride_; ++c) {
+            if (attr.byte_offsets_[c] >= 0) {
+                copies.push_back({static_cast<char *>(tensor.GetDataPtr()) +
+                                          c * byte_size,
+                                  attr.stride_ * byte_size,
+                                  attr.byte_offsets_[c], byte_size});
+            }
+        }
+    }
+    const int64_t record_size = vertex.record_size_;
+    core::ParallelFor(core::Device("CPU:0"), num_points, [&](int64_t i) {
+        const char *record = records + i * record_size;
+        for (const ComponentCopy &copy : copies) {
+            std::memcpy(copy.dst_ + i * copy.dst_stride_,
+                        record + copy.src_offset_, copy.byte_size_);
+        }
+    });
+    return true;
+}
+
 bool ReadPointCloudFromPLY(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            const open3d::io::ReadPointCloudOption &params) {
+    if (ReadPointCloudFromMappedPLY(filename, pointcloud)) {
+        utility::CountingProgressReporter reporter(params.update_progress);
+        reporter.Finish();
+        return true;
+    }
+
     p_ply ply_file = ply_open(filename.c_str(), nullptr, 0, nullptr);
     if (!ply_file) {
         utility::LogWarning("Read PLY failed: unable to open file: {}.",
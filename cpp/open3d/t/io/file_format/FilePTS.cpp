@@ -24,9 +24,12 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <cstdio>
+#include <cstdlib>
 
 #include "open3d/core/TensorCheck.h"
+#include "open3d/io/ASCIIParser.h"
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/t/io/PointCloudIO.h"
 #include "open3d/utility/FileSystem.h"
@@ -46,24 +49,19 @@ bool ReadPointCloudFromPTS(const std::string &filename,
         pointcloud.Clear();
 
         // Get num_points.
-        utility::filesystem::CFile file;
-        if (!file.Open(filename, "rb")) {
+        utility::filesystem::MappedFile file;
+        if (!file.Open(filename)) {
             utility::LogWarning("Read PTS failed: unable to open file: {}",
                                 filename);
             return false;
         }
 
-        int64_t num_points = 0;
-        const char *line_buffer;
-        if ((line_buffer = file.ReadLine())) {
-            const char *format;
-            if (std::is_same<int64_t, long>::value) {
-                format = "%ld";
-            } else {
-                format = "%lld";
-            }
-            sscanf(line_buffer, format, &num_points);
-        }
+        const char *data = file.GetData();
+        const char *data_end = data + file.GetSize();
+        const char *header_end = std::find(data, data_end, '\n');
+        const int64_t num_points =
+                std::strtoll(std::string(data, header_end).c_str(), nullptr,
+                             10);
         if (num_points < 0) {
             utility::LogWarning(
                     "Read PTS failed: number of points must be >= 0.");
@@ -72,122 +70,48 @@ bool ReadPointCloudFromPTS(const std::string &filename,
             pointcloud.SetPointPositions(core::Tensor({0, 3}, core::Float64));
             return true;
         }
+        // The first point determines the fields of all points.
+        const char *data_start = std::min(header_end + 1, data_end);
         utility::CountingProgressReporter reporter(params.update_progress);
-        reporter.SetTotal(num_points);
-
-        // Store data start position.
-        int64_t start_pos = ftell(file.GetFILE());
-
-        double *points_ptr = nullptr;
-        double *intensities_ptr = nullptr;
-        uint8_t *colors_ptr = nullptr;
-        size_t num_fields = 0;
-
-        if ((line_buffer = file.ReadLine())) {
-            num_fields = utility::SplitString(line_buffer, " ").size();
-
-            // X Y Z I R G B.
-            if (num_fields == 7) {
-                pointcloud.SetPointPositions(
-                        core::Tensor({num_points, 3}, core::Float64));
-                points_ptr =
-                        pointcloud.GetPointPositions().GetDataPtr<double>();
-                pointcloud.SetPointAttr(
-                        "intensities",
-                        core::Tensor({num_points, 1}, core::Float64));
-                intensities_ptr = pointcloud.GetPointAttr("intensities")
-                                          .GetDataPtr<double>();
-                pointcloud.SetPointColors(
-                        core::Tensor({num_points, 3}, core::UInt8));
-                colors_ptr = pointcloud.GetPointColors().GetDataPtr<uint8_t>();
-            }
-            // X Y Z R G B.
-            else if (num_fields == 6) {
-                pointcloud.SetPointPositions(
-                        core::Tensor({num_points, 3}, core::Float64));
-                points_ptr =
-                        pointcloud.GetPointPositions().GetDataPtr<double>();
-                pointcloud.SetPointColors(
-                        core::Tensor({num_points, 3}, core::UInt8));
-                colors_ptr = pointcloud.GetPointColors().GetDataPtr<uint8_t>();
-            }
-            // X Y Z I.
-            else if (num_fields == 4) {
-                pointcloud.SetPointPositions(
-                        core::Tensor({num_points, 3}, core::Float64));
-                points_ptr =
-                        pointcloud.GetPointPositions().GetDataPtr<double>();
-                pointcloud.SetPointAttr(
-                        "intensities",
-                        core::Tensor({num_points, 1}, core::Float64));
-                intensities_ptr = pointcloud.GetPointAttr("intensities")
-                                          .GetDataPtr<double>();
-            }
-            // X Y Z.
-            else if (num_fields == 3) {
-                pointcloud.SetPointPositions(
-                        core::Tensor({num_points, 3}, core::Float64));
-                points_ptr =
-                        pointcloud.GetPointPositions().GetDataPtr<double>();
-            } else {
-                utility::LogWarning("Read PTS failed: unknown pts format: {}",
-                                    line_buffer);
-                return false;
-            }
+        reporter.SetTotal(data_end - data_start);
+        const std::string first_line(data_start,
+                                     std::find(data_start, data_end, '\n'));
+        const int64_t num_fields =
+                utility::SplitString(first_line, " ").size();
+        // X Y Z I R G B, X Y Z R G B, X Y Z I or X Y Z.
+        if (num_fields < 3 || num_fields > 7 || num_fields == 5) {
+            utility::LogWarning("Read PTS failed: unknown pts format: {}",
+                                first_line);
+            return false;
         }
 
-        // Go to data start position.
-        fseek(file.GetFILE(), start_pos, 0);
+        core::Tensor values;
+        const int64_t num_rows = open3d::io::ParseASCIIRows(
+                data_start, data_end - data_start, int(num_fields),
+                [&](int64_t max_rows) {
+                    values = core::Tensor({max_rows, num_fields},
+                                          core::Float64);
+                    return values.GetDataPtr<double>();
+                },
+                [&](int64_t num_bytes) { reporter.Update(num_bytes); });
+        if (num_rows < num_points) {
+            utility::LogWarning(
+                    "Read PTS failed: expected {} points, but only {} could "
+                    "be read.",
+                    num_points, num_rows);
+            return false;
+        }
+        values = values.Slice(0, 0, num_points);
 
-        int64_t idx = 0;
-        while (idx < num_points && (line_buffer = file.ReadLine())) {
-            double x, y, z, i;
-            int r, g, b;
-            // X Y Z I R G B.
-            if (num_fields == 7 &&
-                (sscanf(line_buffer, "%lf %lf %lf %lf %d %d %d", &x, &y, &z, &i,
-                        &r, &g, &b) == 7)) {
-                points_ptr[3 * idx + 0] = x;
-                points_ptr[3 * idx + 1] = y;
-                points_ptr[3 * idx + 2] = z;
-                intensities_ptr[idx] = i;
-                colors_ptr[3 * idx + 0] = r;
-                colors_ptr[3 * idx + 1] = g;
-                colors_ptr[3 * idx + 2] = b;
-            }
-            // X Y Z R G B.
-            else if (num_fields == 6 &&
-                     (sscanf(line_buffer, "%lf %lf %lf %d %d %d", &x, &y, &z,
-                             &r, &g, &b) == 6)) {
-                points_ptr[3 * idx + 0] = x;
-                points_ptr[3 * idx + 1] = y;
-                points_ptr[3 * idx + 2] = z;
-                colors_ptr[3 * idx + 0] = r;
-                colors_ptr[3 * idx + 1] = g;
-                colors_ptr[3 * idx + 2] = b;
-            }
-            // X Y Z I.
-            else if (num_fields == 4 && (sscanf(line_buffer, "%lf %lf %lf %lf",
-                                                &x, &y, &z, &i) == 4)) {
-                points_ptr[3 * idx + 0] = x;
-                points_ptr[3 * idx + 1] = y;
-                points_ptr[3 * idx + 2] = z;
-                intensities_ptr[idx] = i;
-            }
-            // X Y Z.
-            else if (num_fields == 3 &&
-                     sscanf(line_buffer, "%lf %lf %lf", &x, &y, &z) == 3) {
-                points_ptr[3 * idx + 0] = x;
-                points_ptr[3 * idx + 1] = y;
-                points_ptr[3 * idx + 2] = z;
-            } else {
-                utility::LogWarning("Read PTS failed at line: {}", line_buffer);
-                return false;
-            }
-            idx++;
-            if (idx % 1000 == 0) {
-                reporter.Update(idx);
-            }
+        pointcloud.SetPointPositions(values.Slice(1, 0, 3).Contiguous());
+        if (num_fields == 7 || num_fields == 4) {
+            pointcloud.SetPointAttr("intensities",
+                                    values.Slice(1, 3, 4).Contiguous());
+        }
+        if (num_fields == 7 || num_fields == 6) {
+            pointcloud.SetPointColors(
+                    values.Slice(1, num_fields - 3, num_fields)
+                            .To(core::UInt8));
         }
 
         reporter.Finish();
@@ -28,6 +28,7 @@
 
 #include "open3d/core/Dtype.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/io/ASCIIParser.h"
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/t/io/PointCloudIO.h"
 #include "open3d/utility/FileSystem.h"
@@ -46,38 +47,28 @@ bool ReadPointCloudFromXYZI(const std::string &filename,
                             geometry::PointCloud &pointcloud,
                             const open3d::io::ReadPointCloudOption &params) {
     try {
-        utility::filesystem::CFile file;
-        if (!file.Open(filename, "r")) {
+        utility::filesystem::MappedFile file;
+        if (!file.Open(filename)) {
             utility::LogWarning("Read XYZI failed: unable to open file: {}",
                                 filename);
             return false;
         }
         utility::CountingProgressReporter reporter(params.update_progress);
-        reporter.SetTotal(file.GetFileSize());
-        int64_t num_points = file.GetNumLines();
+        reporter.SetTotal(file.GetSize());
 
         pointcloud.Clear();
-        core::Tensor points({num_points, 3}, core::Float64);
-        core::Tensor intensities({num_points, 1}, core::Float64);
-        double *points_ptr = points.GetDataPtr<double>();
-        double *intensities_ptr = intensities.GetDataPtr<double>();
-
-        int i = 0;
-        double x, y, z, I;
-        const char *line_buffer;
-        while ((line_buffer = file.ReadLine())) {
-            if (sscanf(line_buffer, "%lf %lf %lf %lf", &x, &y, &z, &I) == 4) {
-                points_ptr[3 * i + 0] = x;
-                points_ptr[3 * i + 1] = y;
-                points_ptr[3 * i + 2] = z;
-                intensities_ptr[i] = I;
-            }
-            if (++i % 1000 == 0) {
-                reporter.Update(file.CurPos());
-            }
-        }
-        pointcloud.SetPointPositions(points);
-        pointcloud.SetPointAttr("intensities", intensities);
+        core::Tensor data;
+        int64_t num_points = open3d::io::ParseASCIIRows(
+                file.GetData(), file.GetSize(), 4,
+                [&](int64_t num_rows) {
+                    data = core::Tensor({num_rows, 4}, core::Float64);
+                    return data.GetDataPtr<double>();
+                },
+                [&](int64_t num_bytes) { reporter.Update(num_bytes); });
+        data = data.Slice(0, 0, num_points);
+        pointcloud.SetPointPositions(data.Slice(1, 0, 3).Contiguous());
+        pointcloud.SetPointAttr("intensities",
+                                data.Slice(1, 3, 4).Contiguous());
         reporter.Finish();
 
         return true;
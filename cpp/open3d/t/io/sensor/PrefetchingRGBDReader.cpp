@@ -0,0 +1,183 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/sensor/PrefetchingRGBDReader.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "open3d/t/io/ImageIO.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+PrefetchingRGBDReader::PrefetchingRGBDReader(RGBDVideoReader &reader,
+                                             const core::Device &device,
+                                             int64_t queue_size)
+    : device_(device),
+      queue_size_(std::max<int64_t>(queue_size, 1)),
+      num_frames_(std::numeric_limits<int64_t>::max()) {
+    if (!reader.IsOpened()) {
+        utility::LogError("Null file handler. Please call Open().");
+    }
+    load_frame_ = [&reader](int64_t) { return reader.NextFrame(); };
+    is_video_eof_ = [&reader]() { return reader.IsEOF(); };
+    Start(1);
+}
+
+PrefetchingRGBDReader::PrefetchingRGBDReader(
+        const std::vector<std::string> &color_files,
+        const std::vector<std::string> &depth_files,
+        const core::Device &device,
+        int64_t queue_size,
+        int num_threads)
+    : device_(device),
+      queue_size_(std::max<int64_t>(queue_size, 1)),
+      num_frames_(static_cast<int64_t>(color_files.size())) {
+    if (color_files.size() != depth_files.size()) {
+        utility::LogError(
+                "Number of color images ({}) and depth images ({}) differ.",
+                color_files.size(), depth_files.size());
+    }
+    load_frame_ = [color_files, depth_files](int64_t index) {
+        geometry::Image color, depth;
+        if (!ReadImage(color_files[index], color) ||
+            !ReadImage(depth_files[index], depth)) {
+            utility::LogWarning("Failed to read frame {} from {} and {}.",
+                                index, color_files[index], depth_files[index]);
+            return geometry::RGBDImage();
+        }
+        return geometry::RGBDImage(color, depth);
+    };
+    if (num_threads <= 0) {
+        num_threads = static_cast<int>(std::min<int64_t>(
+                utility::EstimateMaxThreads(), queue_size_));
+    }
+    Start(num_threads);
+}
+
+PrefetchingRGBDReader::~PrefetchingRGBDReader() { Stop(); }
+
+bool PrefetchingRGBDReader::IsEOF() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return next_returned_ >= num_frames_;
+}
+
+int64_t PrefetchingRGBDReader::GetFrameIndex() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return next_returned_;
+}
+
+geometry::RGBDImage PrefetchingRGBDReader::NextFrame() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    frame_ready_.wait(lock, [this]() {
+        return next_returned_ >= num_frames_ ||
+               frames_.count(next_returned_) > 0;
+    });
+    if (next_returned_ >= num_frames_) {
+        return geometry::RGBDImage();
+    }
+    auto it = frames_.find(next_returned_);
+    geometry::RGBDImage frame = std::move(it->second);
+    frames_.erase(it);
+    ++next_returned_;
+    slot_free_.notify_all();
+    return frame;
+}
+
+void PrefetchingRGBDReader::Start(int num_threads) {
+    for (int i = 0; i < num_threads; ++i) {
+        threads_.emplace_back([this]() {
+            int64_t index;
+            while (ClaimFrame(index)) {
+                geometry::RGBDImage frame;
+                try {
+                    frame = load_frame_(index);
+                    if (!frame.IsEmpty()) {
+                        frame = frame.To(device_);
+                    }
+                } catch (const std::exception &e) {
+                    utility::LogWarning("Failed to load frame {}: {}", index,
+                                        e.what());
+                    frame = geometry::RGBDImage();
+                }
+                PushFrame(index, frame);
+            }
+        });
+    }
+}
+
+void PrefetchingRGBDReader::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    slot_free_.notify_all();
+    for (std::thread &thread : threads_) {
+        thread.join();
+    }
+    threads_.clear();
+}
+
+bool PrefetchingRGBDReader::ClaimFrame(int64_t &index) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    slot_free_.wait(lock, [this]() {
+        return stop_ || next_claimed_ >= num_frames_ ||
+               next_claimed_ < next_returned_ + queue_size_;
+    });
+    if (stop_ || next_claimed_ >= num_frames_) {
+        return false;
+    }
+    // Only the single video thread calls the reader.
+    if (is_video_eof_ && is_video_eof_()) {
+        num_frames_ = next_claimed_;
+        frame_ready_.notify_all();
+        return false;
+    }
+    index = next_claimed_++;
+    return true;
+}
+
+void PrefetchingRGBDReader::PushFrame(int64_t index,
+                                      const geometry::RGBDImage &frame) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (is_video_eof_ && frame.IsEmpty()) {
+            // Video readers return an empty frame at the end.
+            num_frames_ = index;
+        } else {
+            frames_[index] = frame;
+        }
+    }
+    frame_ready_.notify_all();
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
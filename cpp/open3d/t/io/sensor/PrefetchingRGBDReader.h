@@ -0,0 +1,130 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "open3d/core/Device.h"
+#include "open3d/t/geometry/RGBDImage.h"
+#include "open3d/t/io/sensor/RGBDVideoReader.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// \class PrefetchingRGBDReader
+///
+/// \brief Reads RGBD frames ahead of time on background threads.
+///
+/// Frames are decoded and copied to the target device while the caller
+/// processes earlier frames, e.g. in odometry. At most \p queue_size frames
+/// are buffered. Frames are returned in order.
+///
+/// Frames either come from an RGBDVideoReader, read on one background thread
+/// since the video is sequential, or from lists of color and depth image
+/// files, decoded by a pool of threads.
+class PrefetchingRGBDReader {
+public:
+    /// Prefetch the frames of an opened RGBD video reader, e.g. RSBagReader.
+    /// The reader must not be used otherwise until this object is destroyed.
+    ///
+    /// \param reader The opened video reader.
+    /// \param device Device of the returned frames.
+    /// \param queue_size Maximum number of buffered frames.
+    PrefetchingRGBDReader(RGBDVideoReader &reader,
+                          const core::Device &device = core::Device("CPU:0"),
+                          int64_t queue_size = 8);
+
+    /// Prefetch the frames of an image sequence.
+    ///
+    /// \param color_files Paths of the color images.
+    /// \param depth_files Paths of the depth images, one per color image.
+    /// \param device Device of the returned frames.
+    /// \param queue_size Maximum number of buffered frames.
+    /// \param num_threads Number of decoding threads, 0 to use the number of
+    /// hardware threads capped at \p queue_size.
+    PrefetchingRGBDReader(const std::vector<std::string> &color_files,
+                          const std::vector<std::string> &depth_files,
+                          const core::Device &device = core::Device("CPU:0"),
+                          int64_t queue_size = 8,
+                          int num_threads = 0);
+
+    /// Stops and joins the background threads.
+    ~PrefetchingRGBDReader();
+
+    PrefetchingRGBDReader(const PrefetchingRGBDReader &) = delete;
+    PrefetchingRGBDReader &operator=(const PrefetchingRGBDReader &) = delete;
+
+    /// Check if all frames have been returned. For video readers the end is
+    /// only known once the background thread reaches it, so NextFrame() may
+    /// still return an empty frame while this is false.
+    bool IsEOF() const;
+
+    /// Get the next frame, waiting for it to be decoded if needed. Returns an
+    /// empty RGBDImage after the last frame. Images that fail to load are
+    /// returned as empty frames with a warning.
+    geometry::RGBDImage NextFrame();
+
+    /// Index of the next frame returned by NextFrame().
+    int64_t GetFrameIndex() const;
+
+private:
+    void Start(int num_threads);
+    void Stop();
+    /// Waits for a free slot in the queue and claims the next frame index.
+    /// Returns false if there are no more frames or the reader is stopped.
+    bool ClaimFrame(int64_t &index);
+    void PushFrame(int64_t index, const geometry::RGBDImage &frame);
+
+    core::Device device_;
+    int64_t queue_size_;
+    /// Loads the frame with the given index, called from background threads.
+    std::function<geometry::RGBDImage(int64_t)> load_frame_;
+    /// Called from the video thread to check for the end of the video.
+    std::function<bool()> is_video_eof_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable frame_ready_;
+    std::condition_variable slot_free_;
+    std::map<int64_t, geometry::RGBDImage> frames_;
+    int64_t num_frames_;
+    int64_t next_claimed_ = 0;
+    int64_t next_returned_ = 0;
+    bool stop_ = false;
+    std::vector<std::thread> threads_;
+};
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,90 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/kernel/Feature.h"
+
+#include "open3d/core/TensorCheck.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+
+void ComputeFPFHFeature(const core::Tensor &points,
+                        const core::Tensor &normals,
+                        const core::Tensor &indices,
+                        const core::Tensor &distance2,
+                        const core::Tensor &counts,
+                        core::Tensor &fpfhs) {
+    const core::Dtype dtype = points.GetDtype();
+    const core::Device device = points.GetDevice();
+    const int64_t n = points.GetLength();
+    const int64_t max_nn = indices.NumDims() == 2 ? indices.GetShape(1) : 0;
+
+    core::AssertTensorDtypes(points, {core::Float32, core::Float64});
+    core::AssertTensorShape(points, {n, 3});
+    core::AssertTensorDtype(normals, dtype);
+    core::AssertTensorDevice(normals, device);
+    core::AssertTensorShape(normals, {n, 3});
+    core::AssertTensorDtype(indices, core::Int32);
+    core::AssertTensorDevice(indices, device);
+    core::AssertTensorShape(indices, {n, max_nn});
+    core::AssertTensorDtype(distance2, dtype);
+    core::AssertTensorDevice(distance2, device);
+    core::AssertTensorShape(distance2, {n, max_nn});
+    core::AssertTensorDtype(counts, core::Int32);
+    core::AssertTensorDevice(counts, device);
+    core::AssertTensorShape(counts, {n});
+    core::AssertTensorDtype(fpfhs, dtype);
+    core::AssertTensorDevice(fpfhs, device);
+    core::AssertTensorShape(fpfhs, {n, 33});
+
+    const core::Tensor points_d = points.Contiguous();
+    const core::Tensor normals_d = normals.Contiguous();
+    const core::Tensor indices_d = indices.Contiguous();
+    const core::Tensor distance2_d = distance2.Contiguous();
+    const core::Tensor counts_d = counts.Contiguous();
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeFPFHFeatureCPU(points_d, normals_d, indices_d, distance2_d,
+                              counts_d, fpfhs);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ComputeFPFHFeatureCUDA(points_d, normals_d, indices_d, distance2_d,
+                               counts_d, fpfhs);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+}
+
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
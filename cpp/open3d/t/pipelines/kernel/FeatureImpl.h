@@ -0,0 +1,202 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+// Private header. Do not include in Open3d.h.
+
+#pragma once
+
+#include <cmath>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/linalg/kernel/Matrix.h"
+#include "open3d/t/pipelines/kernel/Feature.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+
+/// Computes the pair feature (alpha, phi, theta, distance) of two oriented
+/// points. Returns zeros for degenerate pairs.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline void ComputePairFeature(const scalar_t *p1,
+                                                  const scalar_t *n1,
+                                                  const scalar_t *p2,
+                                                  const scalar_t *n2,
+                                                  scalar_t *feature) {
+    feature[0] = feature[1] = feature[2] = feature[3] = 0;
+    scalar_t dp2p1[3] = {p2[0] - p1[0], p2[1] - p1[1], p2[2] - p1[2]};
+    const scalar_t distance = sqrt(core::linalg::kernel::dot_3x1(dp2p1, dp2p1));
+    if (distance == 0) {
+        return;
+    }
+
+    const scalar_t *n1_copy = n1;
+    const scalar_t *n2_copy = n2;
+    const scalar_t angle1 =
+            core::linalg::kernel::dot_3x1(n1_copy, dp2p1) / distance;
+    const scalar_t angle2 =
+            core::linalg::kernel::dot_3x1(n2_copy, dp2p1) / distance;
+    scalar_t theta;
+    if (acos(fabs(angle1)) > acos(fabs(angle2))) {
+        n1_copy = n2;
+        n2_copy = n1;
+        dp2p1[0] *= -1;
+        dp2p1[1] *= -1;
+        dp2p1[2] *= -1;
+        theta = -angle2;
+    } else {
+        theta = angle1;
+    }
+
+    scalar_t v[3];
+    core::linalg::kernel::cross_3x1(dp2p1, n1_copy, v);
+    const scalar_t v_norm = sqrt(core::linalg::kernel::dot_3x1(v, v));
+    if (v_norm == 0) {
+        return;
+    }
+    v[0] /= v_norm;
+    v[1] /= v_norm;
+    v[2] /= v_norm;
+    scalar_t w[3];
+    core::linalg::kernel::cross_3x1(n1_copy, v, w);
+
+    feature[0] = atan2(core::linalg::kernel::dot_3x1(w, n2_copy),
+                       core::linalg::kernel::dot_3x1(n1_copy, n2_copy));
+    feature[1] = core::linalg::kernel::dot_3x1(v, n2_copy);
+    feature[2] = theta;
+    feature[3] = distance;
+}
+
+/// Adds a pair feature to the 3 x 11 bins of a SPFH histogram.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline void UpdateSPFHFeature(const scalar_t *feature,
+                                                 scalar_t hist_incr,
+                                                 scalar_t *spfh) {
+    int h_index = static_cast<int>(
+            floor(11 * (feature[0] + M_PI) / (2.0 * M_PI)));
+    h_index = h_index < 0 ? 0 : (h_index >= 11 ? 10 : h_index);
+    spfh[h_index] += hist_incr;
+    h_index = static_cast<int>(floor(11 * (feature[1] + 1.0) * 0.5));
+    h_index = h_index < 0 ? 0 : (h_index >= 11 ? 10 : h_index);
+    spfh[h_index + 11] += hist_incr;
+    h_index = static_cast<int>(floor(11 * (feature[2] + 1.0) * 0.5));
+    h_index = h_index < 0 ? 0 : (h_index >= 11 ? 10 : h_index);
+    spfh[h_index + 22] += hist_incr;
+}
+
+#if defined(__CUDACC__)
+void ComputeFPFHFeatureCUDA
+#else
+void ComputeFPFHFeatureCPU
+#endif
+        (const core::Tensor &points,
+         const core::Tensor &normals,
+         const core::Tensor &indices,
+         const core::Tensor &distance2,
+         const core::Tensor &counts,
+         core::Tensor &fpfhs) {
+    const core::Dtype dtype = points.GetDtype();
+    const core::Device device = points.GetDevice();
+    const int64_t n = points.GetLength();
+    if (n == 0) {
+        return;
+    }
+    const int64_t max_nn = indices.GetShape(1);
+
+    // The SPFH of all points must be complete before any FPFH is computed.
+    core::Tensor spfhs = core::Tensor::Zeros({n, 33}, dtype, device);
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        const scalar_t *points_ptr = points.GetDataPtr<scalar_t>();
+        const scalar_t *normals_ptr = normals.GetDataPtr<scalar_t>();
+        const int32_t *indices_ptr = indices.GetDataPtr<int32_t>();
+        const scalar_t *distance2_ptr = distance2.GetDataPtr<scalar_t>();
+        const int32_t *counts_ptr = counts.GetDataPtr<int32_t>();
+        scalar_t *spfhs_ptr = spfhs.GetDataPtr<scalar_t>();
+        scalar_t *fpfhs_ptr = fpfhs.GetDataPtr<scalar_t>();
+
+        core::ParallelFor(device, n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+            const int32_t count = counts_ptr[workload_idx];
+            if (count <= 1) {
+                return;
+            }
+            const int32_t *neighbors = indices_ptr + max_nn * workload_idx;
+            const scalar_t *point = points_ptr + 3 * workload_idx;
+            const scalar_t *normal = normals_ptr + 3 * workload_idx;
+            scalar_t *spfh = spfhs_ptr + 33 * workload_idx;
+            const scalar_t hist_incr = 100.0 / (count - 1);
+            scalar_t feature[4];
+            // Skip the point itself.
+            for (int32_t k = 1; k < count; ++k) {
+                const int32_t idx = neighbors[k];
+                ComputePairFeature(point, normal, points_ptr + 3 * idx,
+                                   normals_ptr + 3 * idx, feature);
+                UpdateSPFHFeature(feature, hist_incr, spfh);
+            }
+        });
+
+        core::ParallelFor(device, n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+            scalar_t *fpfh = fpfhs_ptr + 33 * workload_idx;
+            for (int j = 0; j < 33; ++j) {
+                fpfh[j] = 0;
+            }
+            const int32_t count = counts_ptr[workload_idx];
+            if (count <= 1) {
+                return;
+            }
+            const int32_t *neighbors = indices_ptr + max_nn * workload_idx;
+            const scalar_t *distances = distance2_ptr + max_nn * workload_idx;
+            scalar_t sum[3] = {0, 0, 0};
+            for (int32_t k = 1; k < count; ++k) {
+                const scalar_t dist = distances[k];
+                if (dist == 0) continue;
+                const scalar_t *spfh = spfhs_ptr + 33 * neighbors[k];
+                for (int j = 0; j < 33; ++j) {
+                    const scalar_t val = spfh[j] / dist;
+                    sum[j / 11] += val;
+                    fpfh[j] += val;
+                }
+            }
+            for (int j = 0; j < 3; ++j) {
+                if (sum[j] != 0) sum[j] = 100.0 / sum[j];
+            }
+            const scalar_t *spfh = spfhs_ptr + 33 * workload_idx;
+            for (int j = 0; j < 33; ++j) {
+                fpfh[j] = fpfh[j] * sum[j / 11] + spfh[j];
+            }
+        });
+    });
+
+    core::cuda::Synchronize(device);
+}
+
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -148,6 +148,57 @@ void FillInSLACAlignmentTerm(core::Tensor &AtA,
     }
 }
 
+void FillInSLACAlignmentTermSparse(core::Tensor &J,
+                                   core::Tensor &J_idx,
+                                   core::Tensor &Atb,
+                                   core::Tensor &residual,
+                                   const core::Tensor &Ti_ps,
+                                   const core::Tensor &Tj_qs,
+                                   const core::Tensor &normal_ps,
+                                   const core::Tensor &Ri_normal_ps,
+                                   const core::Tensor &RjT_Ri_normal_ps,
+                                   const core::Tensor &cgrid_idx_ps,
+                                   const core::Tensor &cgrid_idx_qs,
+                                   const core::Tensor &cgrid_ratio_qs,
+                                   const core::Tensor &cgrid_ratio_ps,
+                                   int i,
+                                   int j,
+                                   int n,
+                                   float threshold) {
+    core::AssertTensorDtype(Atb, core::Float32);
+    core::AssertTensorDtype(residual, core::Float32);
+    core::AssertTensorDtype(Ti_ps, core::Float32);
+    core::AssertTensorDtype(Tj_qs, core::Float32);
+    core::AssertTensorDtype(normal_ps, core::Float32);
+    core::AssertTensorDtype(Ri_normal_ps, core::Float32);
+    core::AssertTensorDtype(RjT_Ri_normal_ps, core::Float32);
+
+    core::Device device = Atb.GetDevice();
+    if (Ti_ps.GetDevice() != device) {
+        utility::LogError(
+                "Points i should have the same device as the linear system.");
+    }
+    if (Tj_qs.GetDevice() != device) {
+        utility::LogError(
+                "Points j should have the same device as the linear system.");
+    }
+    if (Ri_normal_ps.GetDevice() != device) {
+        utility::LogError(
+                "Normals i should have the same device as the linear system.");
+    }
+
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        FillInSLACAlignmentTermSparseCPU(
+                J, J_idx, Atb, residual, Ti_ps, Tj_qs, normal_ps, Ri_normal_ps,
+                RjT_Ri_normal_ps, cgrid_idx_ps, cgrid_idx_qs, cgrid_ratio_ps,
+                cgrid_ratio_qs, i, j, n, threshold);
+    } else {
+        utility::LogError(
+                "Sparse linear system is only supported on CPU, but got {}.",
+                device.ToString());
+    }
+}
+
 void FillInSLACRegularizerTerm(core::Tensor &AtA,
                                core::Tensor &Atb,
                                core::Tensor &residual,
@@ -187,6 +238,33 @@ void FillInSLACRegularizerTerm(core::Tensor &AtA,
     }
 }
 
+void FillInSLACRegularizerTermSparse(core::Tensor &nbs_weight,
+                                     core::Tensor &Atb,
+                                     core::Tensor &residual,
+                                     const core::Tensor &grid_idx,
+                                     const core::Tensor &grid_nbs_idx,
+                                     const core::Tensor &grid_nbs_mask,
+                                     const core::Tensor &positions_init,
+                                     const core::Tensor &positions_curr,
+                                     float weight,
+                                     int n,
+                                     int anchor_idx) {
+    core::AssertTensorDtype(Atb, core::Float32);
+    core::AssertTensorDtype(residual, core::Float32);
+
+    core::Device device = Atb.GetDevice();
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        FillInSLACRegularizerTermSparseCPU(
+                nbs_weight, Atb, residual, grid_idx, grid_nbs_idx,
+                grid_nbs_mask, positions_init, positions_curr, weight, n,
+                anchor_idx);
+    } else {
+        utility::LogError(
+                "Sparse linear system is only supported on CPU, but got {}.",
+                device.ToString());
+    }
+}
+
 }  // namespace kernel
 }  // namespace pipelines
 }  // namespace t
@@ -70,6 +70,52 @@ void FillInSLACRegularizerTerm(core::Tensor &AtA,
                                int n,
                                int anchor_idx);
 
+/// \brief Sparse counterpart of FillInSLACAlignmentTerm, CPU only.
+///
+/// Instead of accumulating the dense AtA, it outputs the Jacobian of every
+/// correspondence so that AtA can be assembled as a sparse matrix. Atb and
+/// residual are accumulated as in FillInSLACAlignmentTerm.
+/// \param J Output Jacobian rows of shape {n, 60}, Float32 dtype. Rows of
+/// rejected correspondences are zero.
+/// \param J_idx Output indices of the Jacobian entries in the linear system,
+/// of shape {n, 60}, Int32 dtype.
+void FillInSLACAlignmentTermSparse(core::Tensor &J,
+                                   core::Tensor &J_idx,
+                                   core::Tensor &Atb,
+                                   core::Tensor &residual,
+                                   const core::Tensor &Ti_qs,
+                                   const core::Tensor &Tj_qs,
+                                   const core::Tensor &normal_ps,
+                                   const core::Tensor &Ri_normal_ps,
+                                   const core::Tensor &RjT_Ri_normal_ps,
+                                   const core::Tensor &cgrid_idx_ps,
+                                   const core::Tensor &cgrid_idx_qs,
+                                   const core::Tensor &cgrid_ratio_qs,
+                                   const core::Tensor &cgrid_ratio_ps,
+                                   int i,
+                                   int j,
+                                   int n,
+                                   float threshold);
+
+/// \brief Sparse counterpart of FillInSLACRegularizerTerm, CPU only.
+///
+/// The regularizer contributes weight * [I, -I; -I, I] to AtA for every
+/// valid pair of neighboring control grid vertices, so only the weights are
+/// output.
+/// \param nbs_weight Output weights of shape {n, 6}, Float32 dtype, aligned
+/// with \p grid_nbs_idx. Pairs that do not contribute have zero weight.
+void FillInSLACRegularizerTermSparse(core::Tensor &nbs_weight,
+                                     core::Tensor &Atb,
+                                     core::Tensor &residual,
+                                     const core::Tensor &grid_idx,
+                                     const core::Tensor &grid_nbs_idx,
+                                     const core::Tensor &grid_nbs_mask,
+                                     const core::Tensor &positions_init,
+                                     const core::Tensor &positions_curr,
+                                     float weight,
+                                     int n,
+                                     int anchor_idx);
+
 void FillInRigidAlignmentTermCPU(core::Tensor &AtA,
                                  core::Tensor &Atb,
                                  core::Tensor &residual,
@@ -109,6 +155,36 @@ void FillInSLACRegularizerTermCPU(core::Tensor &AtA,
                                   int n,
                                   int anchor_idx);
 
+void FillInSLACAlignmentTermSparseCPU(core::Tensor &J,
+                                      core::Tensor &J_idx,
+                                      core::Tensor &Atb,
+                                      core::Tensor &residual,
+                                      const core::Tensor &Ti_qs,
+                                      const core::Tensor &Tj_qs,
+                                      const core::Tensor &normal_ps,
+                                      const core::Tensor &Ri_normal_ps,
+                                      const core::Tensor &RjT_Ri_normal_ps,
+                                      const core::Tensor &cgrid_idx_ps,
+                                      const core::Tensor &cgrid_idx_qs,
+                                      const core::Tensor &cgrid_ratio_qs,
+                                      const core::Tensor &cgrid_ratio_ps,
+                                      int i,
+                                      int j,
+                                      int n,
+                                      float threshold);
+
+void FillInSLACRegularizerTermSparseCPU(core::Tensor &nbs_weight,
+                                        core::Tensor &Atb,
+                                        core::Tensor &residual,
+                                        const core::Tensor &grid_idx,
+                                        const core::Tensor &grid_nbs_idx,
+                                        const core::Tensor &grid_nbs_mask,
+                                        const core::Tensor &positions_init,
+                                        const core::Tensor &positions_curr,
+                                        float weight,
+                                        int n,
+                                        int anchor_idx);
+
 #ifdef BUILD_CUDA_MODULE
 void FillInRigidAlignmentTermCUDA(core::Tensor &AtA,
                                   core::Tensor &Atb,
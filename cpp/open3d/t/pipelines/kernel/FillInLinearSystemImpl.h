@@ -32,6 +32,167 @@ namespace open3d {
 namespace t {
 namespace pipelines {
 namespace kernel {
+
+/// Computes the residual and the 60 Jacobian entries of a SLAC alignment
+/// correspondence: 2 x 6 for the poses of fragment i and j, and 2 x 8 x 3 for
+/// the control grid vertices embedding p and q. \p idx receives the indices
+/// of the entries in the linear system.
+/// \return False if the correspondence is rejected by \p threshold.
+OPEN3D_HOST_DEVICE inline bool ComputeSLACAlignmentJacobian(
+        const float *Ti_Cp,
+        const float *Tj_Cq,
+        const float *Cnormal_p,
+        const float *Ri_Cnormal_p,
+        const float *RjTRi_Cnormal_p,
+        const int *cgrid_idx_p,
+        const int *cgrid_idx_q,
+        const float *cgrid_ratio_p,
+        const float *cgrid_ratio_q,
+        int i,
+        int j,
+        int n_frags,
+        float threshold,
+        float *J,
+        int *idx,
+        float &r) {
+    r = (Ti_Cp[0] - Tj_Cq[0]) * Ri_Cnormal_p[0] +
+        (Ti_Cp[1] - Tj_Cq[1]) * Ri_Cnormal_p[1] +
+        (Ti_Cp[2] - Tj_Cq[2]) * Ri_Cnormal_p[2];
+    if (abs(r) > threshold) return false;
+
+    // Jacobian w.r.t. Ti: 0-6
+    J[0] = -Tj_Cq[2] * Ri_Cnormal_p[1] + Tj_Cq[1] * Ri_Cnormal_p[2];
+    J[1] = Tj_Cq[2] * Ri_Cnormal_p[0] - Tj_Cq[0] * Ri_Cnormal_p[2];
+    J[2] = -Tj_Cq[1] * Ri_Cnormal_p[0] + Tj_Cq[0] * Ri_Cnormal_p[1];
+    J[3] = Ri_Cnormal_p[0];
+    J[4] = Ri_Cnormal_p[1];
+    J[5] = Ri_Cnormal_p[2];
+
+    // Jacobian w.r.t. Tj: 6-12
+    for (int k = 0; k < 6; ++k) {
+        J[k + 6] = -J[k];
+
+        idx[k + 0] = 6 * i + k;
+        idx[k + 6] = 6 * j + k;
+    }
+
+    // Jacobian w.r.t. C over p: 12-36
+    for (int k = 0; k < 8; ++k) {
+        J[12 + k * 3 + 0] = cgrid_ratio_p[k] * Cnormal_p[0];
+        J[12 + k * 3 + 1] = cgrid_ratio_p[k] * Cnormal_p[1];
+        J[12 + k * 3 + 2] = cgrid_ratio_p[k] * Cnormal_p[2];
+
+        idx[12 + k * 3 + 0] = 6 * n_frags + cgrid_idx_p[k] * 3 + 0;
+        idx[12 + k * 3 + 1] = 6 * n_frags + cgrid_idx_p[k] * 3 + 1;
+        idx[12 + k * 3 + 2] = 6 * n_frags + cgrid_idx_p[k] * 3 + 2;
+    }
+
+    // Jacobian w.r.t. C over q: 36-60
+    for (int k = 0; k < 8; ++k) {
+        J[36 + k * 3 + 0] = -cgrid_ratio_q[k] * RjTRi_Cnormal_p[0];
+        J[36 + k * 3 + 1] = -cgrid_ratio_q[k] * RjTRi_Cnormal_p[1];
+        J[36 + k * 3 + 2] = -cgrid_ratio_q[k] * RjTRi_Cnormal_p[2];
+
+        idx[36 + k * 3 + 0] = 6 * n_frags + cgrid_idx_q[k] * 3 + 0;
+        idx[36 + k * 3 + 1] = 6 * n_frags + cgrid_idx_q[k] * 3 + 1;
+        idx[36 + k * 3 + 2] = 6 * n_frags + cgrid_idx_q[k] * 3 + 2;
+    }
+    return true;
+}
+
+/// Estimates the local rotation of control grid vertex \p idx_i from its 6
+/// neighbors. The anchor vertex is fixed to the identity.
+/// \return False if fewer than 3 neighbors are available.
+OPEN3D_HOST_DEVICE inline bool ComputeSLACRegularizerRotation(
+        int idx_i,
+        const int *idx_nbs,
+        const bool *mask_nbs,
+        const float *positions_init_ptr,
+        const float *positions_curr_ptr,
+        int anchor_idx,
+        float R[3][3]) {
+    // Build a 3x3 linear system to compute the local R
+    float cov[3][3] = {{0}};
+    float U[3][3], V[3][3], S[3];
+
+    int cnt = 0;
+    for (int k = 0; k < 6; ++k) {
+        bool mask_k = mask_nbs[k];
+        if (!mask_k) continue;
+
+        int idx_k = idx_nbs[k];
+
+        // Now build linear systems
+        float diff_ik_init[3], diff_ik_curr[3];
+        for (int d = 0; d < 3; ++d) {
+            diff_ik_init[d] = positions_init_ptr[idx_i * 3 + d] -
+                              positions_init_ptr[idx_k * 3 + d];
+            diff_ik_curr[d] = positions_curr_ptr[idx_i * 3 + d] -
+                              positions_curr_ptr[idx_k * 3 + d];
+        }
+
+        // Build linear system by computing XY^T when formulating Y = RX
+        // Y: curr X: init
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                cov[i][j] += diff_ik_init[i] * diff_ik_curr[j];
+            }
+        }
+        ++cnt;
+    }
+
+    if (cnt < 3) {
+        return false;
+    }
+
+    core::linalg::kernel::svd3x3(*cov, *U, S, *V);
+
+    core::linalg::kernel::transpose3x3_(*U);
+    core::linalg::kernel::matmul3x3_3x3(*V, *U, *R);
+
+    float d = core::linalg::kernel::det3x3(*R);
+
+    if (d < 0) {
+        U[2][0] = -U[2][0];
+        U[2][1] = -U[2][1];
+        U[2][2] = -U[2][2];
+        core::linalg::kernel::matmul3x3_3x3(*V, *U, *R);
+    }
+
+    // Now we have R, we build Hessian and residuals
+    // But first, we need to anchor a point
+    if (idx_i == anchor_idx) {
+        R[0][0] = R[1][1] = R[2][2] = 1;
+        R[0][1] = R[0][2] = R[1][0] = R[1][2] = R[2][0] = R[2][1] = 0;
+    }
+    return true;
+}
+
+/// Computes the residual of the edge between control grid vertices \p idx_i
+/// and \p idx_k under the local rotation \p R of \p idx_i.
+OPEN3D_HOST_DEVICE inline void ComputeSLACRegularizerResidual(
+        int idx_i,
+        int idx_k,
+        const float *positions_init_ptr,
+        const float *positions_curr_ptr,
+        float R[3][3],
+        float *local_r) {
+    float diff_ik_init[3], diff_ik_curr[3];
+    for (int d = 0; d < 3; ++d) {
+        diff_ik_init[d] = positions_init_ptr[idx_i * 3 + d] -
+                          positions_init_ptr[idx_k * 3 + d];
+        diff_ik_curr[d] = positions_curr_ptr[idx_i * 3 + d] -
+                          positions_curr_ptr[idx_k * 3 + d];
+    }
+    float R_diff_ik_curr[3];
+
+    core::linalg::kernel::matmul3x3_3x1(*R, diff_ik_init, R_diff_ik_curr);
+
+    local_r[0] = diff_ik_curr[0] - R_diff_ik_curr[0];
+    local_r[1] = diff_ik_curr[1] - R_diff_ik_curr[1];
+    local_r[2] = diff_ik_curr[2] - R_diff_ik_curr[2];
+}
+
 #if defined(__CUDACC__)
 void FillInRigidAlignmentTermCUDA
 #else
@@ -218,51 +379,16 @@ void FillInSLACAlignmentTermCPU
                 const float *cgrid_ratio_q =
                         cgrid_ratio_qs_ptr + 8 * workload_idx;
 
-                float r = (Ti_Cp[0] - Tj_Cq[0]) * Ri_Cnormal_p[0] +
-                          (Ti_Cp[1] - Tj_Cq[1]) * Ri_Cnormal_p[1] +
-                          (Ti_Cp[2] - Tj_Cq[2]) * Ri_Cnormal_p[2];
-                if (abs(r) > threshold) return;
-
                 // Now we fill in a 60 x 60 sub-matrix: 2 x (6 + 8 x 3)
                 float J[60];
                 int idx[60];
-
-                // Jacobian w.r.t. Ti: 0-6
-                J[0] = -Tj_Cq[2] * Ri_Cnormal_p[1] + Tj_Cq[1] * Ri_Cnormal_p[2];
-                J[1] = Tj_Cq[2] * Ri_Cnormal_p[0] - Tj_Cq[0] * Ri_Cnormal_p[2];
-                J[2] = -Tj_Cq[1] * Ri_Cnormal_p[0] + Tj_Cq[0] * Ri_Cnormal_p[1];
-                J[3] = Ri_Cnormal_p[0];
-                J[4] = Ri_Cnormal_p[1];
-                J[5] = Ri_Cnormal_p[2];
-
-                // Jacobian w.r.t. Tj: 6-12
-                for (int k = 0; k < 6; ++k) {
-                    J[k + 6] = -J[k];
-
-                    idx[k + 0] = 6 * i + k;
-                    idx[k + 6] = 6 * j + k;
-                }
-
-                // Jacobian w.r.t. C over p: 12-36
-                for (int k = 0; k < 8; ++k) {
-                    J[12 + k * 3 + 0] = cgrid_ratio_p[k] * Cnormal_p[0];
-                    J[12 + k * 3 + 1] = cgrid_ratio_p[k] * Cnormal_p[1];
-                    J[12 + k * 3 + 2] = cgrid_ratio_p[k] * Cnormal_p[2];
-
-                    idx[12 + k * 3 + 0] = 6 * n_frags + cgrid_idx_p[k] * 3 + 0;
-                    idx[12 + k * 3 + 1] = 6 * n_frags + cgrid_idx_p[k] * 3 + 1;
-                    idx[12 + k * 3 + 2] = 6 * n_frags + cgrid_idx_p[k] * 3 + 2;
-                }
-
-                // Jacobian w.r.t. C over q: 36-60
-                for (int k = 0; k < 8; ++k) {
-                    J[36 + k * 3 + 0] = -cgrid_ratio_q[k] * RjTRi_Cnormal_p[0];
-                    J[36 + k * 3 + 1] = -cgrid_ratio_q[k] * RjTRi_Cnormal_p[1];
-                    J[36 + k * 3 + 2] = -cgrid_ratio_q[k] * RjTRi_Cnormal_p[2];
-
-                    idx[36 + k * 3 + 0] = 6 * n_frags + cgrid_idx_q[k] * 3 + 0;
-                    idx[36 + k * 3 + 1] = 6 * n_frags + cgrid_idx_q[k] * 3 + 1;
-                    idx[36 + k * 3 + 2] = 6 * n_frags + cgrid_idx_q[k] * 3 + 2;
+                float r;
+                if (!ComputeSLACAlignmentJacobian(
+                            Ti_Cp, Tj_Cq, Cnormal_p, Ri_Cnormal_p,
+                            RjTRi_Cnormal_p, cgrid_idx_p, cgrid_idx_q,
+                            cgrid_ratio_p, cgrid_ratio_q, i, j, n_frags,
+                            threshold, J, idx, r)) {
+                    return;
                 }
 
         // Not optimized; Switch to reduction if necessary.
@@ -336,98 +462,23 @@ void FillInSLACRegularizerTermCPU
                 const int *idx_nbs = grid_nbs_idx_ptr + 6 * workload_idx;
                 const bool *mask_nbs = grid_nbs_mask_ptr + 6 * workload_idx;
 
-                // Build a 3x3 linear system to compute the local R
-                float cov[3][3] = {{0}};
-                float U[3][3], V[3][3], S[3];
-
-                int cnt = 0;
-                for (int k = 0; k < 6; ++k) {
-                    bool mask_k = mask_nbs[k];
-                    if (!mask_k) continue;
-
-                    int idx_k = idx_nbs[k];
-
-                    // Now build linear systems
-                    float diff_ik_init[3] = {
-                            positions_init_ptr[idx_i * 3 + 0] -
-                                    positions_init_ptr[idx_k * 3 + 0],
-                            positions_init_ptr[idx_i * 3 + 1] -
-                                    positions_init_ptr[idx_k * 3 + 1],
-                            positions_init_ptr[idx_i * 3 + 2] -
-                                    positions_init_ptr[idx_k * 3 + 2]};
-                    float diff_ik_curr[3] = {
-                            positions_curr_ptr[idx_i * 3 + 0] -
-                                    positions_curr_ptr[idx_k * 3 + 0],
-                            positions_curr_ptr[idx_i * 3 + 1] -
-                                    positions_curr_ptr[idx_k * 3 + 1],
-                            positions_curr_ptr[idx_i * 3 + 2] -
-                                    positions_curr_ptr[idx_k * 3 + 2]};
-
-                    // Build linear system by computing XY^T when formulating Y
-                    // = RX Y: curr X: init
-                    for (int i = 0; i < 3; ++i) {
-                        for (int j = 0; j < 3; ++j) {
-                            cov[i][j] += diff_ik_init[i] * diff_ik_curr[j];
-                        }
-                    }
-                    ++cnt;
-                }
-
-                if (cnt < 3) {
-                    return;
-                }
-
-                core::linalg::kernel::svd3x3(*cov, *U, S, *V);
-
                 float R[3][3];
-                core::linalg::kernel::transpose3x3_(*U);
-                core::linalg::kernel::matmul3x3_3x3(*V, *U, *R);
-
-                float d = core::linalg::kernel::det3x3(*R);
-
-                if (d < 0) {
-                    U[2][0] = -U[2][0];
-                    U[2][1] = -U[2][1];
-                    U[2][2] = -U[2][2];
-                    core::linalg::kernel::matmul3x3_3x3(*V, *U, *R);
+                if (!ComputeSLACRegularizerRotation(
+                            idx_i, idx_nbs, mask_nbs, positions_init_ptr,
+                            positions_curr_ptr, anchor_idx, R)) {
+                    return;
                 }
 
-                // Now we have R, we build Hessian and residuals
-                // But first, we need to anchor a point
-                if (idx_i == anchor_idx) {
-                    R[0][0] = R[1][1] = R[2][2] = 1;
-                    R[0][1] = R[0][2] = R[1][0] = R[1][2] = R[2][0] = R[2][1] =
-                            0;
-                }
                 for (int k = 0; k < 6; ++k) {
                     bool mask_k = mask_nbs[k];
 
                     if (mask_k) {
                         int idx_k = idx_nbs[k];
 
-                        float diff_ik_init[3] = {
-                                positions_init_ptr[idx_i * 3 + 0] -
-                                        positions_init_ptr[idx_k * 3 + 0],
-                                positions_init_ptr[idx_i * 3 + 1] -
-                                        positions_init_ptr[idx_k * 3 + 1],
-                                positions_init_ptr[idx_i * 3 + 2] -
-                                        positions_init_ptr[idx_k * 3 + 2]};
-                        float diff_ik_curr[3] = {
-                                positions_curr_ptr[idx_i * 3 + 0] -
-                                        positions_curr_ptr[idx_k * 3 + 0],
-                                positions_curr_ptr[idx_i * 3 + 1] -
-                                        positions_curr_ptr[idx_k * 3 + 1],
-                                positions_curr_ptr[idx_i * 3 + 2] -
-                                        positions_curr_ptr[idx_k * 3 + 2]};
-                        float R_diff_ik_curr[3];
-
-                        core::linalg::kernel::matmul3x3_3x1(*R, diff_ik_init,
-                                                            R_diff_ik_curr);
-
                         float local_r[3];
-                        local_r[0] = diff_ik_curr[0] - R_diff_ik_curr[0];
-                        local_r[1] = diff_ik_curr[1] - R_diff_ik_curr[1];
-                        local_r[2] = diff_ik_curr[2] - R_diff_ik_curr[2];
+                        ComputeSLACRegularizerResidual(
+                                idx_i, idx_k, positions_init_ptr,
+                                positions_curr_ptr, R, local_r);
 
                         int offset_idx_i = 3 * idx_i + 6 * n_frags;
                         int offset_idx_k = 3 * idx_k + 6 * n_frags;
@@ -490,6 +541,170 @@ void FillInSLACRegularizerTermCPU
                 }
             });
 }
+
+#if !defined(__CUDACC__)
+void FillInSLACAlignmentTermSparseCPU(core::Tensor &J,
+                                      core::Tensor &J_idx,
+                                      core::Tensor &Atb,
+                                      core::Tensor &residual,
+                                      const core::Tensor &Ti_Cps,
+                                      const core::Tensor &Tj_Cqs,
+                                      const core::Tensor &Cnormal_ps,
+                                      const core::Tensor &Ri_Cnormal_ps,
+                                      const core::Tensor &RjT_Ri_Cnormal_ps,
+                                      const core::Tensor &cgrid_idx_ps,
+                                      const core::Tensor &cgrid_idx_qs,
+                                      const core::Tensor &cgrid_ratio_qs,
+                                      const core::Tensor &cgrid_ratio_ps,
+                                      int i,
+                                      int j,
+                                      int n_frags,
+                                      float threshold) {
+    int64_t n = Ti_Cps.GetLength();
+    if (Tj_Cqs.GetLength() != n || Cnormal_ps.GetLength() != n ||
+        Ri_Cnormal_ps.GetLength() != n || RjT_Ri_Cnormal_ps.GetLength() != n ||
+        cgrid_idx_ps.GetLength() != n || cgrid_ratio_ps.GetLength() != n ||
+        cgrid_idx_qs.GetLength() != n || cgrid_ratio_qs.GetLength() != n) {
+        utility::LogError(
+                "Unable to setup linear system: input length mismatch.");
+    }
+
+    J = core::Tensor::Empty({n, 60}, core::Float32, Atb.GetDevice());
+    J_idx = core::Tensor::Empty({n, 60}, core::Int32, Atb.GetDevice());
+    float *J_ptr = static_cast<float *>(J.GetDataPtr());
+    int *J_idx_ptr = static_cast<int *>(J_idx.GetDataPtr());
+    float *Atb_ptr = static_cast<float *>(Atb.GetDataPtr());
+    float *residual_ptr = static_cast<float *>(residual.GetDataPtr());
+
+    // Geometric properties
+    const float *Ti_Cps_ptr = static_cast<const float *>(Ti_Cps.GetDataPtr());
+    const float *Tj_Cqs_ptr = static_cast<const float *>(Tj_Cqs.GetDataPtr());
+    const float *Cnormal_ps_ptr =
+            static_cast<const float *>(Cnormal_ps.GetDataPtr());
+    const float *Ri_Cnormal_ps_ptr =
+            static_cast<const float *>(Ri_Cnormal_ps.GetDataPtr());
+    const float *RjT_Ri_Cnormal_ps_ptr =
+            static_cast<const float *>(RjT_Ri_Cnormal_ps.GetDataPtr());
+
+    // Association properties
+    const int *cgrid_idx_ps_ptr =
+            static_cast<const int *>(cgrid_idx_ps.GetDataPtr());
+    const int *cgrid_idx_qs_ptr =
+            static_cast<const int *>(cgrid_idx_qs.GetDataPtr());
+    const float *cgrid_ratio_ps_ptr =
+            static_cast<const float *>(cgrid_ratio_ps.GetDataPtr());
+    const float *cgrid_ratio_qs_ptr =
+            static_cast<const float *>(cgrid_ratio_qs.GetDataPtr());
+
+    core::ParallelFor(
+            Atb.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                float *J_row = J_ptr + 60 * workload_idx;
+                int *idx_row = J_idx_ptr + 60 * workload_idx;
+                float r;
+                if (!ComputeSLACAlignmentJacobian(
+                            Ti_Cps_ptr + 3 * workload_idx,
+                            Tj_Cqs_ptr + 3 * workload_idx,
+                            Cnormal_ps_ptr + 3 * workload_idx,
+                            Ri_Cnormal_ps_ptr + 3 * workload_idx,
+                            RjT_Ri_Cnormal_ps_ptr + 3 * workload_idx,
+                            cgrid_idx_ps_ptr + 8 * workload_idx,
+                            cgrid_idx_qs_ptr + 8 * workload_idx,
+                            cgrid_ratio_ps_ptr + 8 * workload_idx,
+                            cgrid_ratio_qs_ptr + 8 * workload_idx, i, j,
+                            n_frags, threshold, J_row, idx_row, r)) {
+                    // Rejected correspondences leave an empty row.
+                    for (int k = 0; k < 60; ++k) {
+                        J_row[k] = 0;
+                        idx_row[k] = 0;
+                    }
+                    return;
+                }
+
+#pragma omp critical(FillInSLACAlignmentTermSparseCPU)
+                {
+                    for (int k = 0; k < 60; ++k) {
+                        Atb_ptr[idx_row[k]] += J_row[k] * r;
+                    }
+                    *residual_ptr += r * r;
+                }
+            });
+}
+
+void FillInSLACRegularizerTermSparseCPU(core::Tensor &nbs_weight,
+                                        core::Tensor &Atb,
+                                        core::Tensor &residual,
+                                        const core::Tensor &grid_idx,
+                                        const core::Tensor &grid_nbs_idx,
+                                        const core::Tensor &grid_nbs_mask,
+                                        const core::Tensor &positions_init,
+                                        const core::Tensor &positions_curr,
+                                        float weight,
+                                        int n_frags,
+                                        int anchor_idx) {
+    int64_t n = grid_idx.GetLength();
+
+    nbs_weight = core::Tensor::Zeros({n, 6}, core::Float32, Atb.GetDevice());
+    float *nbs_weight_ptr = static_cast<float *>(nbs_weight.GetDataPtr());
+    float *Atb_ptr = static_cast<float *>(Atb.GetDataPtr());
+    float *residual_ptr = static_cast<float *>(residual.GetDataPtr());
+
+    const int *grid_idx_ptr = static_cast<const int *>(grid_idx.GetDataPtr());
+    const int *grid_nbs_idx_ptr =
+            static_cast<const int *>(grid_nbs_idx.GetDataPtr());
+    const bool *grid_nbs_mask_ptr =
+            static_cast<const bool *>(grid_nbs_mask.GetDataPtr());
+
+    const float *positions_init_ptr =
+            static_cast<const float *>(positions_init.GetDataPtr());
+    const float *positions_curr_ptr =
+            static_cast<const float *>(positions_curr.GetDataPtr());
+
+    core::ParallelFor(
+            Atb.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                int idx_i = grid_idx_ptr[workload_idx];
+
+                const int *idx_nbs = grid_nbs_idx_ptr + 6 * workload_idx;
+                const bool *mask_nbs = grid_nbs_mask_ptr + 6 * workload_idx;
+
+                float R[3][3];
+                if (!ComputeSLACRegularizerRotation(
+                            idx_i, idx_nbs, mask_nbs, positions_init_ptr,
+                            positions_curr_ptr, anchor_idx, R)) {
+                    return;
+                }
+
+                for (int k = 0; k < 6; ++k) {
+                    if (!mask_nbs[k]) continue;
+                    int idx_k = idx_nbs[k];
+
+                    float local_r[3];
+                    ComputeSLACRegularizerResidual(idx_i, idx_k,
+                                                   positions_init_ptr,
+                                                   positions_curr_ptr, R,
+                                                   local_r);
+
+                    // The AtA entries only depend on the weight.
+                    nbs_weight_ptr[6 * workload_idx + k] = weight;
+
+                    int offset_idx_i = 3 * idx_i + 6 * n_frags;
+                    int offset_idx_k = 3 * idx_k + 6 * n_frags;
+#pragma omp critical(FillInSLACRegularizerTermSparseCPU)
+                    {
+                        *residual_ptr += weight * (local_r[0] * local_r[0] +
+                                                   local_r[1] * local_r[1] +
+                                                   local_r[2] * local_r[2]);
+                        for (int axis = 0; axis < 3; ++axis) {
+                            Atb_ptr[offset_idx_i + axis] +=
+                                    weight * local_r[axis];
+                            Atb_ptr[offset_idx_k + axis] -=
+                                    weight * local_r[axis];
+                        }
+                    }
+                }
+            });
+}
+#endif
+
 }  // namespace kernel
 }  // namespace pipelines
 }  // namespace t
@@ -26,9 +26,13 @@
 
 #pragma once
 
+#include <Eigen/IterativeLinearSolvers>
+#include <Eigen/Sparse>
 #include <fstream>
+#include <vector>
 
 #include "open3d/core/EigenConverter.h"
+#include "open3d/io/PointCloudIO.h"
 #include "open3d/t/pipelines/kernel/FillInLinearSystem.h"
 #include "open3d/t/pipelines/slac/SLACOptimizer.h"
 #include "open3d/utility/FileSystem.h"
@@ -42,6 +46,9 @@ using namespace open3d::core::eigen_converter;
 using core::Tensor;
 using t::geometry::PointCloud;
 
+/// Entries of the sparse AtA, summed up on assembly.
+using SparseTriplets = std::vector<Eigen::Triplet<double>>;
+
 // Reads pointcloud from filename, and loads on the device as
 // Tensor PointCloud of Float32 dtype.
 static PointCloud CreateTPCDFromFile(
@@ -71,13 +78,13 @@ static void FillInRigidAlignmentTerm(Tensor& AtA,
                                      tpcd_i.GetPointNormals(), i, j, threshold);
 }
 
-void FillInRigidAlignmentTerm(Tensor& AtA,
-                              Tensor& Atb,
-                              Tensor& residual,
-                              const std::vector<std::string>& fnames,
-                              const PoseGraph& pose_graph,
-                              const SLACOptimizerParams& params,
-                              const SLACDebugOption& debug_option) {
+inline void FillInRigidAlignmentTerm(Tensor& AtA,
+                                     Tensor& Atb,
+                                     Tensor& residual,
+                                     const std::vector<std::string>& fnames,
+                                     const PoseGraph& pose_graph,
+                                     const SLACOptimizerParams& params,
+                                     const SLACDebugOption& debug_option) {
     core::Device device(params.device_);
 
     // Enumerate pose graph edges
@@ -118,7 +125,91 @@ void FillInRigidAlignmentTerm(Tensor& AtA,
     }
 }
 
-static void FillInSLACAlignmentTerm(Tensor& AtA,
+/// Appends the entries of J^T J to \p AtA_triplets, where J is given by the
+/// Jacobian rows \p J of shape {n, w} and their column indices \p J_idx.
+static void AppendJtJ(SparseTriplets& AtA_triplets,
+                      const Tensor& J,
+                      const Tensor& J_idx,
+                      int64_t n_vars) {
+    const int64_t n = J.GetLength();
+    const int64_t w = J.GetShape(1);
+    const float* J_ptr = J.GetDataPtr<float>();
+    const int* J_idx_ptr = J_idx.GetDataPtr<int>();
+
+    SparseTriplets J_triplets;
+    J_triplets.reserve(n * w);
+    for (int64_t row = 0; row < n; ++row) {
+        for (int64_t k = 0; k < w; ++k) {
+            const float value = J_ptr[row * w + k];
+            if (value != 0) {
+                J_triplets.emplace_back(row, J_idx_ptr[row * w + k], value);
+            }
+        }
+    }
+    Eigen::SparseMatrix<double, Eigen::RowMajor> J_sparse(n, n_vars);
+    J_sparse.setFromTriplets(J_triplets.begin(), J_triplets.end());
+
+    // Correspondences of a pair only touch a few control grid vertices, so
+    // J^T J of a pair is much smaller than the accumulated J rows.
+    const Eigen::SparseMatrix<double> JtJ = J_sparse.transpose() * J_sparse;
+    for (int col = 0; col < JtJ.outerSize(); ++col) {
+        for (Eigen::SparseMatrix<double>::InnerIterator it(JtJ, col); it;
+             ++it) {
+            AtA_triplets.emplace_back(it.row(), it.col(), it.value());
+        }
+    }
+}
+
+// Dense AtA, supported on all devices.
+static void FillInSLACAlignmentTermKernel(Tensor& AtA,
+                                          Tensor& Atb,
+                                          Tensor& residual,
+                                          const Tensor& Ti_Cps,
+                                          const Tensor& Tj_Cqs,
+                                          const Tensor& Cnormal_ps,
+                                          const Tensor& Ri_Cnormal_ps,
+                                          const Tensor& RjT_Ri_Cnormal_ps,
+                                          const Tensor& cgrid_index_ps,
+                                          const Tensor& cgrid_index_qs,
+                                          const Tensor& cgrid_ratio_ps,
+                                          const Tensor& cgrid_ratio_qs,
+                                          const int i,
+                                          const int j,
+                                          const int n_fragments,
+                                          const float threshold) {
+    kernel::FillInSLACAlignmentTerm(
+            AtA, Atb, residual, Ti_Cps, Tj_Cqs, Cnormal_ps, Ri_Cnormal_ps,
+            RjT_Ri_Cnormal_ps, cgrid_index_ps, cgrid_index_qs, cgrid_ratio_ps,
+            cgrid_ratio_qs, i, j, n_fragments, threshold);
+}
+
+// Sparse AtA, CPU only.
+static void FillInSLACAlignmentTermKernel(SparseTriplets& AtA_triplets,
+                                          Tensor& Atb,
+                                          Tensor& residual,
+                                          const Tensor& Ti_Cps,
+                                          const Tensor& Tj_Cqs,
+                                          const Tensor& Cnormal_ps,
+                                          const Tensor& Ri_Cnormal_ps,
+                                          const Tensor& RjT_Ri_Cnormal_ps,
+                                          const Tensor& cgrid_index_ps,
+                                          const Tensor& cgrid_index_qs,
+                                          const Tensor& cgrid_ratio_ps,
+                                          const Tensor& cgrid_ratio_qs,
+                                          const int i,
+                                          const int j,
+                                          const int n_fragments,
+                                          const float threshold) {
+    Tensor J, J_idx;
+    kernel::FillInSLACAlignmentTermSparse(
+            J, J_idx, Atb, residual, Ti_Cps, Tj_Cqs, Cnormal_ps, Ri_Cnormal_ps,
+            RjT_Ri_Cnormal_ps, cgrid_index_ps, cgrid_index_qs, cgrid_ratio_ps,
+            cgrid_ratio_qs, i, j, n_fragments, threshold);
+    AppendJtJ(AtA_triplets, J, J_idx, Atb.GetLength());
+}
+
+template <typename AtAType>
+static void FillInSLACAlignmentTerm(AtAType& AtA,
                                     Tensor& Atb,
                                     Tensor& residual,
                                     ControlGrid& ctr_grid,
@@ -162,13 +253,16 @@ static void FillInSLACAlignmentTerm(Tensor& AtA,
     Tensor RjT_Ri_Cnormal_ps =
             (Rj.T().Matmul(Ri_Cnormal_ps.T())).T().Contiguous();
 
-    kernel::FillInSLACAlignmentTerm(
+    FillInSLACAlignmentTermKernel(
             AtA, Atb, residual, Ti_Cps, Tj_Cqs, Cnormal_ps, Ri_Cnormal_ps,
             RjT_Ri_Cnormal_ps, cgrid_index_ps, cgrid_index_qs, cgrid_ratio_ps,
             cgrid_ratio_qs, i, j, n_fragments, threshold);
 }
 
-void FillInSLACAlignmentTerm(Tensor& AtA,
+/// Fills in the SLAC alignment term of all pose graph edges, either into a
+/// dense AtA tensor or into SparseTriplets.
+template <typename AtAType>
+void FillInSLACAlignmentTerm(AtAType& AtA,
                              Tensor& Atb,
                              Tensor& residual,
                              ControlGrid& ctr_grid,
@@ -231,13 +325,13 @@ void FillInSLACAlignmentTerm(Tensor& AtA,
     }
 }
 
-void FillInSLACRegularizerTerm(Tensor& AtA,
-                               Tensor& Atb,
-                               Tensor& residual,
-                               ControlGrid& ctr_grid,
-                               int n_frags,
-                               const SLACOptimizerParams& params,
-                               const SLACDebugOption& debug_option) {
+inline void FillInSLACRegularizerTerm(Tensor& AtA,
+                                      Tensor& Atb,
+                                      Tensor& residual,
+                                      ControlGrid& ctr_grid,
+                                      int n_frags,
+                                      const SLACOptimizerParams& params,
+                                      const SLACDebugOption& debug_option) {
     Tensor active_buf_indices, nb_buf_indices, nb_masks;
     std::tie(active_buf_indices, nb_buf_indices, nb_masks) =
             ctr_grid.GetNeighborGridMap();
@@ -254,6 +348,78 @@ void FillInSLACRegularizerTerm(Tensor& AtA,
     }
 }
 
+inline void FillInSLACRegularizerTerm(SparseTriplets& AtA_triplets,
+                                      Tensor& Atb,
+                                      Tensor& residual,
+                                      ControlGrid& ctr_grid,
+                                      int n_frags,
+                                      const SLACOptimizerParams& params,
+                                      const SLACDebugOption& debug_option) {
+    Tensor active_buf_indices, nb_buf_indices, nb_masks;
+    std::tie(active_buf_indices, nb_buf_indices, nb_masks) =
+            ctr_grid.GetNeighborGridMap();
+
+    Tensor positions_init = ctr_grid.GetInitPositions();
+    Tensor positions_curr = ctr_grid.GetCurrPositions();
+    Tensor nbs_weight;
+    kernel::FillInSLACRegularizerTermSparse(
+            nbs_weight, Atb, residual, active_buf_indices, nb_buf_indices,
+            nb_masks, positions_init, positions_curr,
+            n_frags * params.regularizer_weight_, n_frags,
+            ctr_grid.GetAnchorIdx());
+
+    const int64_t n = active_buf_indices.GetLength();
+    const int* grid_idx_ptr = active_buf_indices.GetDataPtr<int>();
+    const int* nbs_idx_ptr = nb_buf_indices.GetDataPtr<int>();
+    const float* nbs_weight_ptr = nbs_weight.GetDataPtr<float>();
+    for (int64_t v = 0; v < n; ++v) {
+        for (int k = 0; k < 6; ++k) {
+            const float weight = nbs_weight_ptr[6 * v + k];
+            if (weight == 0) continue;
+            const int offset_i = 3 * grid_idx_ptr[v] + 6 * n_frags;
+            const int offset_k = 3 * nbs_idx_ptr[6 * v + k] + 6 * n_frags;
+            for (int axis = 0; axis < 3; ++axis) {
+                AtA_triplets.emplace_back(offset_i + axis, offset_i + axis,
+                                          weight);
+                AtA_triplets.emplace_back(offset_k + axis, offset_k + axis,
+                                          weight);
+                AtA_triplets.emplace_back(offset_i + axis, offset_k + axis,
+                                          -weight);
+                AtA_triplets.emplace_back(offset_k + axis, offset_i + axis,
+                                          -weight);
+            }
+        }
+    }
+    if (debug_option.debug_) {
+        VisualizeGridDeformation(ctr_grid);
+    }
+}
+
+/// Solves AtA delta = -Atb with the Jacobi preconditioned conjugate gradient
+/// method, where AtA is assembled from \p AtA_triplets. The sparse
+/// matrix-vector products are multithreaded.
+inline Tensor SolveSparseLinearSystem(const SparseTriplets& AtA_triplets,
+                                      const Tensor& Atb,
+                                      int64_t num_params) {
+    Eigen::SparseMatrix<double, Eigen::RowMajor> AtA(num_params, num_params);
+    AtA.setFromTriplets(AtA_triplets.begin(), AtA_triplets.end());
+    const Eigen::VectorXd b = TensorToEigenMatrixXd(Atb).col(0);
+
+    Eigen::ConjugateGradient<Eigen::SparseMatrix<double, Eigen::RowMajor>,
+                             Eigen::Lower | Eigen::Upper>
+            cg;
+    cg.setTolerance(1e-6);
+    cg.compute(AtA);
+    const Eigen::VectorXd x = cg.solve(-b);
+    utility::LogInfo("PCG: {} non-zeros, {} iterations, error = {:e}",
+                     AtA.nonZeros(), cg.iterations(), cg.error());
+    if (cg.info() != Eigen::Success) {
+        utility::LogWarning("PCG did not converge.");
+    }
+
+    return EigenMatrixToTensor(Eigen::MatrixXf(x.cast<float>()));
+}
+
 }  // namespace slac
 }  // namespace pipelines
 }  // namespace t
@@ -313,6 +313,27 @@ static void UpdateControlGrid(ControlGrid& ctr_grid, core::Tensor& delta) {
     ctr_grid.GetCurrPositions().Slice(0, 0, ctr_grid.Size()) += delta_cgrids;
 }
 
+// Fills in the alignment and regularizer terms of the SLAC linear system,
+// either into a dense AtA tensor or into SparseTriplets.
+template <typename AtAType>
+static void FillInSLACLinearSystem(AtAType& AtA,
+                                   core::Tensor& Atb,
+                                   core::Tensor& residual_data,
+                                   core::Tensor& residual_reg,
+                                   ControlGrid& ctr_grid,
+                                   const std::vector<std::string>& fnames,
+                                   const PoseGraph& pose_graph,
+                                   const SLACOptimizerParams& params,
+                                   const SLACDebugOption& debug_option) {
+    FillInSLACAlignmentTerm(AtA, Atb, residual_data, ctr_grid, fnames,
+                            pose_graph, params, debug_option);
+    utility::LogInfo("Alignment loss = {}", residual_data[0].Item<float>());
+
+    FillInSLACRegularizerTerm(AtA, Atb, residual_reg, ctr_grid,
+                              pose_graph.nodes_.size(), params, debug_option);
+    utility::LogInfo("Regularizer loss = {}", residual_reg[0].Item<float>());
+}
+
 std::pair<PoseGraph, ControlGrid> RunSLACOptimizerForFragments(
         const std::vector<std::string>& fnames,
         const PoseGraph& pose_graph,
@@ -342,37 +363,46 @@ std::pair<PoseGraph, ControlGrid> RunSLACOptimizerForFragments(
     // Fill-in
     // fragments x 6 (se3) + control_grids x 3 (R^3)
     int64_t num_params = fnames_down.size() * 6 + ctr_grid.Size() * 3;
-    utility::LogInfo("Initializing the {}^2 Hessian matrix", num_params);
+    const bool use_sparse = device.GetType() == core::Device::DeviceType::CPU;
+    if (use_sparse) {
+        utility::LogInfo("Initializing the sparse {}^2 Hessian matrix",
+                         num_params);
+    } else {
+        utility::LogInfo("Initializing the {}^2 Hessian matrix", num_params);
+    }
 
     PoseGraph pose_graph_update(pose_graph);
     for (int itr = 0; itr < params.max_iterations_; ++itr) {
         utility::LogInfo("Iteration {}", itr);
-        core::Tensor AtA = core::Tensor::Zeros({num_params, num_params},
-                                               core::Float32, device);
         core::Tensor Atb =
                 core::Tensor::Zeros({num_params, 1}, core::Float32, device);
-
-        core::Tensor indices_eye0 =
-                core::Tensor::Arange(0, 6, 1, core::Int64, device);
-        AtA.IndexSet({indices_eye0, indices_eye0},
-                     core::Tensor::Ones({}, core::Float32, device));
-
         core::Tensor residual_data =
                 core::Tensor::Zeros({1}, core::Float32, device);
-        FillInSLACAlignmentTerm(AtA, Atb, residual_data, ctr_grid, fnames_down,
-                                pose_graph_update, params, debug_option);
-
-        utility::LogInfo("Alignment loss = {}", residual_data[0].Item<float>());
-
         core::Tensor residual_reg =
                 core::Tensor::Zeros({1}, core::Float32, device);
-        FillInSLACRegularizerTerm(AtA, Atb, residual_reg, ctr_grid,
-                                  pose_graph_update.nodes_.size(), params,
-                                  debug_option);
-        utility::LogInfo("Regularizer loss = {}",
-                         residual_reg[0].Item<float>());
 
-        core::Tensor delta = AtA.Solve(Atb.Neg());
+        core::Tensor delta;
+        if (use_sparse) {
+            SparseTriplets AtA_triplets;
+            for (int k = 0; k < 6; ++k) {
+                AtA_triplets.emplace_back(k, k, 1.0);
+            }
+            FillInSLACLinearSystem(AtA_triplets, Atb, residual_data,
+                                   residual_reg, ctr_grid, fnames_down,
+                                   pose_graph_update, params, debug_option);
+            delta = SolveSparseLinearSystem(AtA_triplets, Atb, num_params);
+        } else {
+            core::Tensor AtA = core::Tensor::Zeros({num_params, num_params},
+                                                   core::Float32, device);
+            core::Tensor indices_eye0 =
+                    core::Tensor::Arange(0, 6, 1, core::Int64, device);
+            AtA.IndexSet({indices_eye0, indices_eye0},
+                         core::Tensor::Ones({}, core::Float32, device));
+            FillInSLACLinearSystem(AtA, Atb, residual_data, residual_reg,
+                                   ctr_grid, fnames_down, pose_graph_update,
+                                   params, debug_option);
+            delta = AtA.Solve(Atb.Neg());
+        }
 
         core::Tensor delta_poses =
                 delta.Slice(0, 0, 6 * pose_graph_update.nodes_.size());
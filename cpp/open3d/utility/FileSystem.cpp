@@ -43,6 +43,7 @@
 #else
 #include <dirent.h>
 #include <limits.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <unistd.h>
 #endif
@@ -620,6 +621,94 @@ size_t CFile::ReadData(void *data, size_t elem_size, size_t num_elems) {
     return elems;
 }
 
+MappedFile::~MappedFile() { Close(); }
+
+bool MappedFile::Open(const std::string &filename, bool copy_on_write) {
+    Close();
+#ifdef _WIN32
+    std::wstring filename_w;
+    filename_w.resize(filename.size());
+    int newSize = MultiByteToWideChar(CP_UTF8, 0, filename.c_str(),
+                                      static_cast<int>(filename.length()),
+                                      const_cast<wchar_t *>(filename_w.c_str()),
+                                      static_cast<int>(filename.length()));
+    filename_w.resize(newSize);
+    HANDLE file = CreateFileW(filename_w.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                              nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+                              nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        error_code_ = ENOENT;
+        return false;
+    }
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size)) {
+        error_code_ = EIO;
+        CloseHandle(file);
+        return false;
+    }
+    size_ = static_cast<size_t>(file_size.QuadPart);
+    if (size_ > 0) {
+        // The view keeps the mapping alive, so both handles can be closed.
+        HANDLE mapping = CreateFileMappingW(
+                file, nullptr, copy_on_write ? PAGE_WRITECOPY : PAGE_READONLY,
+                0, 0, nullptr);
+        if (mapping) {
+            data_ = static_cast<const char *>(MapViewOfFile(
+                    mapping, copy_on_write ? FILE_MAP_COPY : FILE_MAP_READ, 0,
+                    0, 0));
+            CloseHandle(mapping);
+        }
+        if (!data_) {
+            error_code_ = EIO;
+            size_ = 0;
+        }
+    }
+    CloseHandle(file);
+    return size_ == 0 || data_;
+#else
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        error_code_ = errno;
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        error_code_ = errno;
+        close(fd);
+        return false;
+    }
+    size_ = static_cast<size_t>(st.st_size);
+    if (size_ > 0) {
+        // The mapping stays valid after the descriptor is closed.
+        const int prot = copy_on_write ? PROT_READ | PROT_WRITE : PROT_READ;
+        void *data = mmap(nullptr, size_, prot, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED) {
+            error_code_ = errno;
+            size_ = 0;
+            close(fd);
+            return false;
+        }
+        data_ = static_cast<const char *>(data);
+    }
+    close(fd);
+    return true;
+#endif
+}
+
+std::string MappedFile::GetError() { return GetIOErrorString(error_code_); }
+
+void MappedFile::Close() {
+    if (data_) {
+#ifdef _WIN32
+        UnmapViewOfFile(data_);
+#else
+        munmap(const_cast<char *>(data_), size_);
+#endif
+        data_ = nullptr;
+    }
+    size_ = 0;
+}
+
 }  // namespace filesystem
 }  // namespace utility
 }  // namespace open3d
@@ -167,6 +167,44 @@ private:
     std::vector<char> line_buffer_;
 };
 
+/// \brief RAII wrapper for a read-only memory-mapped file.
+///
+/// The whole file is mapped into the address space, so it can be parsed (also
+/// concurrently) without copying it into an intermediate buffer. The mapping
+/// is released when the object is destroyed.
+class MappedFile {
+public:
+    MappedFile() = default;
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    /// The destructor unmaps the file automatically.
+    ~MappedFile();
+
+    /// Map a file for reading. Empty files are mapped to a null buffer.
+    ///
+    /// If \p copy_on_write is set, the mapped pages may also be written to.
+    /// Writes are private to the process and never reach the file.
+    bool Open(const std::string &filename, bool copy_on_write = false);
+
+    /// Returns the last encountered error for this file.
+    std::string GetError();
+
+    /// Unmap the file.
+    void Close();
+
+    /// Returns the mapped content of the file.
+    const char *GetData() const { return data_; }
+
+    /// Returns the file size in bytes.
+    size_t GetSize() const { return size_; }
+
+private:
+    const char *data_ = nullptr;
+    size_t size_ = 0;
+    int error_code_ = 0;
+};
+
 }  // namespace filesystem
 }  // namespace utility
 }  // namespace open3d
@@ -27,6 +27,7 @@
 #include "open3d/pipelines/registration/Feature.h"
 
 #include "open3d/geometry/PointCloud.h"
+#include "open3d/utility/Logging.h"
 #include "pybind/docstring.h"
 #include "pybind/pipelines/registration/registration.h"
 
@@ -57,6 +58,41 @@ void pybind_feature(py::module &m) {
                        std::string(" and num = ") + std::to_string(f.Num()) +
                        std::string("\nAccess its data via data member.");
             });
+
+    // open3d.registration.FeatureMatchingOption
+    py::class_<FeatureMatchingOption> matching_option(
+            m, "FeatureMatchingOption",
+            "Options for nearest neighbor matching of features.");
+    py::detail::bind_copy_functions<FeatureMatchingOption>(matching_option);
+    matching_option
+            .def(py::init([](bool approximate, int num_trees, int max_checks,
+                             utility::optional<unsigned int> seed) {
+                     return new FeatureMatchingOption(approximate, num_trees,
+                                                      max_checks, seed);
+                 }),
+                 "approximate"_a = false, "num_trees"_a = 4,
+                 "max_checks"_a = 128, "seed"_a = py::none())
+            .def_readwrite("approximate", &FeatureMatchingOption::approximate_,
+                           "bool: Search with a randomized KD-tree forest "
+                           "instead of an exact KD-tree.")
+            .def_readwrite("num_trees", &FeatureMatchingOption::num_trees_,
+                           "int: Number of trees of the forest.")
+            .def_readwrite("max_checks", &FeatureMatchingOption::max_checks_,
+                           "int: Maximum number of distance computations per "
+                           "query of the approximate search. Larger values "
+                           "increase recall and time.")
+            .def_readwrite("seed", &FeatureMatchingOption::seed_,
+                           "unsigned int: Random seed used to build the "
+                           "forest.")
+            .def("__repr__", [](const FeatureMatchingOption &c) {
+                return fmt::format(
+                        "FeatureMatchingOption class with "
+                        "\napproximate={}\nnum_trees={}\nmax_checks={}"
+                        "\nseed={}",
+                        c.approximate_, c.num_trees_, c.max_checks_,
+                        c.seed_.has_value() ? std::to_string(c.seed_.value())
+                                            : "None");
+            });
     docstring::ClassMethodDocInject(m, "Feature", "dimension");
     docstring::ClassMethodDocInject(m, "Feature", "num");
     docstring::ClassMethodDocInject(m, "Feature", "resize",
@@ -72,6 +108,18 @@ void pybind_feature_methods(py::module &m) {
             m, "compute_fpfh_feature",
             {{"input", "The Input point cloud."},
              {"search_param", "KDTree KNN search parameter."}});
+
+    m.def("find_nearest_features", &FindNearestFeatures,
+          py::call_guard<py::gil_scoped_release>(),
+          "Function to find the nearest target feature of every query "
+          "feature",
+          "query_features"_a, "target_features"_a,
+          "option"_a = FeatureMatchingOption());
+    docstring::FunctionDocInject(
+            m, "find_nearest_features",
+            {{"query_features", "Features to match."},
+             {"target_features", "Features to search in."},
+             {"option", "Matching option."}});
 }
 
 }  // namespace registration
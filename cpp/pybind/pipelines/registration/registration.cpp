@@ -469,19 +469,21 @@ must hold true for all edges.)");
                              double maximum_correspondence_distance,
                              int iteration_number, double tuple_scale,
                              int maximum_tuple_count, bool tuple_test,
-                             utility::optional<unsigned int> seed) {
+                             utility::optional<unsigned int> seed,
+                             const FeatureMatchingOption &matching_option) {
                      return new FastGlobalRegistrationOption(
                              division_factor, use_absolute_scale, decrease_mu,
                              maximum_correspondence_distance, iteration_number,
                              tuple_scale, maximum_tuple_count, tuple_test,
-                             seed);
+                             seed, matching_option);
                  }),
                  "division_factor"_a = 1.4, "use_absolute_scale"_a = false,
                  "decrease_mu"_a = false,
                  "maximum_correspondence_distance"_a = 0.025,
                  "iteration_number"_a = 64, "tuple_scale"_a = 0.95,
                  "maximum_tuple_count"_a = 1000, "tuple_test"_a = true,
-                 "seed"_a = py::none())
+                 "seed"_a = py::none(),
+                 "matching_option"_a = FeatureMatchingOption())
             .def_readwrite(
                     "division_factor",
                     &FastGlobalRegistrationOption::division_factor_,
@@ -515,6 +517,10 @@ must hold true for all edges.)");
                     "tests on initial set of correspondences.")
             .def_readwrite("seed", &FastGlobalRegistrationOption::seed_,
                            "unsigned int: Random seed.")
+            .def_readwrite("matching_option",
+                           &FastGlobalRegistrationOption::matching_option_,
+                           "FeatureMatchingOption: Option of the nearest "
+                           "neighbor search between features.")
             .def("__repr__", [](const FastGlobalRegistrationOption &c) {
                 return fmt::format(
                         ""
@@ -597,6 +603,8 @@ static const std::unordered_map<std::string, std::string>
                 {"lambda_geometric", "lambda_geometric value"},
                 {"epsilon", "epsilon value"},
                 {"kernel", "Robust Kernel used in the Optimization"},
+                {"matching_option",
+                 "Option of the nearest neighbor search between features."},
                 {"max_correspondence_distance",
                  "Maximum correspondence points-pair distance."},
                 {"mutual_filter",
@@ -679,7 +687,8 @@ void pybind_registration_methods(py::module &m) {
           "checkers"_a = std::vector<
                   std::reference_wrapper<const CorrespondenceChecker>>(),
           "criteria"_a = RANSACConvergenceCriteria(100000, 0.999),
-          "seed"_a = py::none());
+          "seed"_a = py::none(),
+          "matching_option"_a = FeatureMatchingOption());
     docstring::FunctionDocInject(
             m, "registration_ransac_based_on_feature_matching",
             map_shared_argument_docstrings);
@@ -718,10 +727,12 @@ void pybind_registration_methods(py::module &m) {
 void pybind_registration(py::module &m) {
     py::module m_submodule =
             m.def_submodule("registration", "Registration pipeline.");
+    // Feature classes are registered first since they are default arguments
+    // of the registration classes and methods.
+    pybind_feature(m_submodule);
     pybind_registration_classes(m_submodule);
     pybind_registration_methods(m_submodule);
 
-    pybind_feature(m_submodule);
     pybind_feature_methods(m_submodule);
     pybind_global_optimization(m_submodule);
     pybind_global_optimization_methods(m_submodule);
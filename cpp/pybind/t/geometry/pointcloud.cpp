@@ -183,12 +183,40 @@ The attributes of the point cloud have different levels::
 
     pointcloud.def(
             "voxel_down_sample",
-            [](const PointCloud& pointcloud, const double voxel_size) {
+            [](const PointCloud& pointcloud, const double voxel_size,
+               const std::string& reduction) {
                 return pointcloud.VoxelDownSample(
-                        voxel_size, core::HashBackendType::Default);
+                        voxel_size, core::HashBackendType::Default, reduction);
             },
-            "Downsamples a point cloud with a specified voxel size.",
-            "voxel_size"_a);
+            "Downsamples a point cloud with a specified voxel size. The "
+            "attributes of the points in a voxel are reduced with reduction, "
+            "one of 'mean', 'min', 'max' and 'first'.",
+            "voxel_size"_a, "reduction"_a = "mean");
+    pointcloud.def("select_by_mask", &PointCloud::SelectByMask,
+                   "Select points by a boolean mask. If invert is True, the "
+                   "points where the mask is False are selected.",
+                   "boolean_mask"_a, "invert"_a = false);
+    pointcloud.def("farthest_point_down_sample",
+                   &PointCloud::FarthestPointDownSample,
+                   "Downsample a point cloud with farthest point sampling, "
+                   "selecting the point farthest from the previously selected "
+                   "points iteratively.",
+                   "num_samples"_a);
+    pointcloud.def("remove_radius_outliers", &PointCloud::RemoveRadiusOutliers,
+                   py::call_guard<py::gil_scoped_release>(), "nb_points"_a,
+                   "search_radius"_a,
+                   "Remove points that have less than nb_points neighbors in "
+                   "a sphere of a given radius. Returns a tuple of the "
+                   "filtered point cloud and the boolean mask of kept "
+                   "points.");
+    pointcloud.def("remove_statistical_outliers",
+                   &PointCloud::RemoveStatisticalOutliers,
+                   py::call_guard<py::gil_scoped_release>(), "nb_neighbors"_a,
+                   "std_ratio"_a,
+                   "Remove points that are further away from their "
+                   "nb_neighbors neighbors than the average of the point "
+                   "cloud. Returns a tuple of the filtered point cloud and the "
+                   "boolean mask of kept points.");
 
     pointcloud.def("estimate_normals", &PointCloud::EstimateNormals,
                    py::call_guard<py::gil_scoped_release>(),
@@ -205,6 +233,14 @@ The attributes of the point cloud have different levels::
                    "Function to estimate point color gradients. If radius is "
                    "provided, then HybridSearch is used, otherwise KNN-Search "
                    "is used.");
+    pointcloud.def("cluster_dbscan", &PointCloud::ClusterDBSCAN,
+                   py::call_guard<py::gil_scoped_release>(), "eps"_a,
+                   "min_points"_a, "print_progress"_a = false,
+                   "Cluster PointCloud using the DBSCAN algorithm  Ester et "
+                   "al., 'A Density-Based Algorithm for Discovering Clusters "
+                   "in Large Spatial Databases with Noise', 1996. Returns a "
+                   "tensor of point labels, -1 indicates noise according to "
+                   "the algorithm.");
 
     pointcloud.def_static(
             "create_from_depth_image", &PointCloud::CreateFromDepthImage,
@@ -26,6 +26,7 @@
 
 #include "open3d/t/geometry/TriangleMesh.h"
 
+#include <limits>
 #include <string>
 #include <unordered_map>
 
@@ -155,6 +156,27 @@ The attributes of the triangle mesh have different levels::
                       "Scale points.");
     triangle_mesh.def("rotate", &TriangleMesh::Rotate, "R"_a, "center"_a,
                       "Rotate points and normals (if exist).");
+    triangle_mesh.def(
+            "simplify_vertex_clustering",
+            [](const TriangleMesh& mesh, double voxel_size) {
+                return mesh.SimplifyVertexClustering(
+                        voxel_size, core::HashBackendType::Default);
+            },
+            py::call_guard<py::gil_scoped_release>(),
+            "Simplifies the mesh by merging the vertices within each voxel "
+            "of size voxel_size. The merged vertices' attributes are "
+            "averaged.",
+            "voxel_size"_a);
+    triangle_mesh.def(
+            "simplify_quadric_decimation",
+            &TriangleMesh::SimplifyQuadricDecimation,
+            py::call_guard<py::gil_scoped_release>(),
+            "Simplifies the mesh with quadric error metric decimation, "
+            "collapsing batches of independent edges in parallel until the "
+            "mesh has at most target_number_of_triangles triangles.",
+            "target_number_of_triangles"_a,
+            "maximum_error"_a = std::numeric_limits<double>::infinity(),
+            "boundary_weight"_a = 1.0);
 
     triangle_mesh.def_static(
             "from_legacy", &TriangleMesh::FromLegacy, "mesh_legacy"_a,
@@ -208,6 +208,18 @@ void pybind_voxel_block_grid(py::module& m) {
             "file_name"_a);
     vbg.def_static("load", &VoxelBlockGrid::Load,
                    "Load a voxel block grid from a npz file.", "file_name"_a);
+    vbg.def("save_block_store", &VoxelBlockGrid::SaveBlockStore,
+            "Save the voxel block grid to a block store directory, writing "
+            "only the blocks modified since the last save to the same store.",
+            "dir_name"_a);
+    vbg.def_static("load_block_store", &VoxelBlockGrid::LoadBlockStore,
+                   "Load a voxel block grid from a block store directory. "
+                   "Optionally only load the blocks at block_coords.",
+                   "dir_name"_a, "block_coords"_a = core::Tensor());
+    vbg.def("mark_blocks_dirty", &VoxelBlockGrid::MarkBlocksDirty,
+            "Mark the blocks at the given buffer indices as modified for the "
+            "next save_block_store.",
+            "buf_indices"_a);
 }
 }  // namespace geometry
 }  // namespace t
@@ -30,6 +30,7 @@
 #include <utility>
 
 #include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/pipelines/registration/Feature.h"
 #include "open3d/t/pipelines/registration/TransformationEstimation.h"
 #include "open3d/utility/Logging.h"
 #include "pybind/docstring.h"
@@ -286,7 +287,13 @@ static const std::unordered_map<std::string, std::string>
                 {"max_correspondence_distances",
                  "o3d.utility.DoubleVector of maximum correspondence "
                  "points-pair distances for multi-scale icp."},
+                {"input", "The input point cloud with normals."},
+                {"max_nn",
+                 "Neighbor search max neighbors parameter. [Default = 100]."},
                 {"option", "Registration option"},
+                {"radius",
+                 "Neighbor search radius parameter. If not given, KNN search "
+                 "is used instead of hybrid search."},
                 {"source", "The source point cloud."},
                 {"target", "The target point cloud."},
                 {"transformation",
@@ -347,6 +354,15 @@ void pybind_registration_methods(py::module &m) {
           "transformation"_a);
     docstring::FunctionDocInject(m, "get_information_matrix",
                                  map_shared_argument_docstrings);
+
+    m.def("compute_fpfh_feature", &ComputeFPFHFeature,
+          py::call_guard<py::gil_scoped_release>(),
+          "Function to compute FPFH feature for a point cloud. Returns a "
+          "tensor of shape {N, 33} with the same dtype and device as the "
+          "input.",
+          "input"_a, "max_nn"_a = 100, "radius"_a = py::none());
+    docstring::FunctionDocInject(m, "compute_fpfh_feature",
+                                 map_shared_argument_docstrings);
 }
 
 void pybind_registration(py::module &m) {
@@ -0,0 +1,183 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/nns/DynamicGridIndex.h"
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/SizeVector.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/nns/NanoFlannIndex.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+static core::Tensor GridPoints(int64_t n, const core::Device& device) {
+    // n^3 points on a jittered grid in [0, 1)^3.
+    std::vector<double> values;
+    for (int64_t i = 0; i < n * n * n; ++i) {
+        const int64_t x = i / (n * n), y = (i / n) % n, z = i % n;
+        values.push_back((x + 0.37 * ((i * 7) % 5) / 5.0) / n);
+        values.push_back((y + 0.41 * ((i * 3) % 7) / 7.0) / n);
+        values.push_back((z + 0.29 * ((i * 11) % 3) / 3.0) / n);
+    }
+    return core::Tensor(values, {n * n * n, 3}, core::Float64, device);
+}
+
+TEST(DynamicGridIndex, SearchKnnMatchesKdTree) {
+    core::Device device("CPU:0");
+    core::Tensor dataset_points = GridPoints(8, device);
+    core::Tensor query_points = GridPoints(3, device).Add(0.013);
+
+    core::nns::DynamicGridIndex index(dataset_points, 0.1);
+    core::nns::NanoFlannIndex kdtree(dataset_points);
+
+    EXPECT_THROW(index.SearchKnn(query_points, 0), std::runtime_error);
+
+    core::Tensor indices, distances, gt_indices, gt_distances;
+    std::tie(indices, distances) = index.SearchKnn(query_points, 5);
+    std::tie(gt_indices, gt_distances) = kdtree.SearchKnn(query_points, 5);
+    EXPECT_EQ(indices.GetShape(), core::SizeVector({27, 5}));
+    EXPECT_TRUE(indices.AllEqual(gt_indices));
+    EXPECT_TRUE(distances.AllClose(gt_distances));
+
+    // More neighbors than points.
+    core::nns::DynamicGridIndex small_index(dataset_points.Slice(0, 0, 4),
+                                            0.1);
+    std::tie(indices, distances) = small_index.SearchKnn(query_points, 10);
+    EXPECT_EQ(indices.GetShape(), core::SizeVector({27, 4}));
+}
+
+TEST(DynamicGridIndex, SearchRadiusAndHybrid) {
+    core::Device device("CPU:0");
+    core::Tensor dataset_points = GridPoints(8, device);
+    core::Tensor query_points = GridPoints(3, device).Add(0.013);
+
+    core::nns::DynamicGridIndex index(dataset_points, 0.1);
+    core::nns::NanoFlannIndex kdtree(dataset_points);
+
+    for (double radius : {0.05, 0.1, 0.35}) {
+        core::Tensor indices, distances, splits;
+        core::Tensor gt_indices, gt_distances, gt_splits;
+        std::tie(indices, distances, splits) =
+                index.SearchRadius(query_points, radius);
+        std::tie(gt_indices, gt_distances, gt_splits) =
+                kdtree.SearchRadius(query_points, radius);
+        EXPECT_TRUE(splits.AllEqual(gt_splits));
+        EXPECT_TRUE(distances.AllClose(gt_distances));
+
+        std::tie(indices, distances, splits) =
+                index.SearchHybrid(query_points, radius, 3);
+        std::tie(gt_indices, gt_distances, gt_splits) =
+                kdtree.SearchHybrid(query_points, radius, 3);
+        EXPECT_TRUE(indices.AllEqual(gt_indices));
+        EXPECT_TRUE(distances.AllClose(gt_distances));
+        EXPECT_TRUE(splits.AllEqual(gt_splits));
+    }
+}
+
+TEST(DynamicGridIndex, InsertAndRemove) {
+    core::Device device("CPU:0");
+    core::Tensor dataset_points = core::Tensor::Init<float>(
+            {{0.0, 0.0, 0.0}, {0.0, 0.0, 0.1}, {0.0, 0.0, 0.2}}, device);
+    core::Tensor query_points =
+            core::Tensor::Init<float>({{0.0, 0.0, 0.09}}, device);
+
+    core::nns::DynamicGridIndex index(dataset_points, 0.05);
+    EXPECT_EQ(index.GetNumActivePoints(), 3);
+
+    core::Tensor indices, distances;
+    std::tie(indices, distances) = index.SearchKnn(query_points, 1);
+    EXPECT_EQ(indices.ToFlatVector<int32_t>(), std::vector<int32_t>({1}));
+
+    // Removed points are no longer returned, indices of others are stable.
+    index.RemovePoints(core::Tensor::Init<int64_t>({1, 1}, device));
+    EXPECT_EQ(index.GetNumActivePoints(), 2);
+    std::tie(indices, distances) = index.SearchKnn(query_points, 2);
+    EXPECT_EQ(indices.ToFlatVector<int32_t>(), std::vector<int32_t>({0, 2}));
+
+    // Inserted points reuse the indices of removed points.
+    core::Tensor new_indices = index.InsertPoints(
+            core::Tensor::Init<float>({{0.0, 0.0, 0.08}}, device));
+    EXPECT_EQ(new_indices.ToFlatVector<int32_t>(), std::vector<int32_t>({1}));
+    std::tie(indices, distances) = index.SearchKnn(query_points, 1);
+    EXPECT_EQ(indices.ToFlatVector<int32_t>(), std::vector<int32_t>({1}));
+    EXPECT_EQ(index.GetActiveIndices().ToFlatVector<int32_t>(),
+              std::vector<int32_t>({0, 1, 2}));
+    EXPECT_EQ(index.GetDatasetSize(), 3);
+
+    // Far away points are found once everything close is removed.
+    index.RemovePoints(core::Tensor::Init<int32_t>({0, 1, 2}, device));
+    new_indices = index.InsertPoints(
+            core::Tensor::Init<float>({{5.0, 5.0, 5.0}}, device));
+    std::tie(indices, distances) = index.SearchKnn(query_points, 3);
+    EXPECT_TRUE(indices.Reshape({1}).AllEqual(new_indices));
+    EXPECT_EQ(index.GetNumActivePoints(), 1);
+
+    EXPECT_THROW(index.RemovePoints(core::Tensor::Init<int32_t>({3}, device)),
+                 std::runtime_error);
+    EXPECT_THROW(index.InsertPoints(core::Tensor::Init<double>(
+                         {{0.0, 0.0, 0.0}}, device)),
+                 std::runtime_error);
+}
+
+TEST(DynamicGridIndex, StreamingUpdatesStayBounded) {
+    core::Device device("CPU:0");
+    const int64_t num_points = 512;
+    const int64_t num_changed = 64;
+    core::Tensor dataset_points = GridPoints(8, device);
+    core::nns::DynamicGridIndex index(dataset_points, 0.1);
+
+    // Replace the oldest points every frame, like a sliding sensor window.
+    // Row i of live_points is the point with index slots[i].
+    core::Tensor slots = core::Tensor::Arange(0, num_points, 1, core::Int32);
+    core::Tensor live_points = dataset_points.Clone();
+    for (int64_t frame = 0; frame < 100; ++frame) {
+        const int64_t oldest = (frame * num_changed) % num_points;
+        core::Tensor batch = slots.Slice(0, oldest, oldest + num_changed);
+        core::Tensor new_points =
+                dataset_points.Slice(0, oldest, oldest + num_changed)
+                        .Add(0.001 * frame);
+        index.RemovePoints(batch);
+        batch.AsRvalue() = index.InsertPoints(new_points);
+        live_points.Slice(0, oldest, oldest + num_changed) = new_points;
+        EXPECT_EQ(index.GetNumActivePoints(), num_points);
+        EXPECT_EQ(index.GetDatasetSize(), static_cast<size_t>(num_points));
+    }
+
+    // Searches still agree with an index built from the live points.
+    core::nns::NanoFlannIndex kdtree(live_points);
+    core::Tensor query_points = GridPoints(3, device).Add(0.013);
+    core::Tensor indices, distances, gt_indices, gt_distances;
+    std::tie(indices, distances) = index.SearchKnn(query_points, 5);
+    std::tie(gt_indices, gt_distances) = kdtree.SearchKnn(query_points, 5);
+    EXPECT_TRUE(indices.AllEqual(slots.IndexGet({gt_indices.To(core::Int64)})));
+    EXPECT_TRUE(distances.AllClose(gt_distances));
+}
+
+}  // namespace tests
+}  // namespace open3d
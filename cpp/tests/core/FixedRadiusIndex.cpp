@@ -44,6 +44,11 @@ using namespace std;
 namespace open3d {
 namespace tests {
 
+class FixedRadiusIndexPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(FixedRadiusIndex,
+                         FixedRadiusIndexPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
 // Function to find permutation to sort the given array.
 template <class T>
 std::vector<size_t> FindPermutation(T* vec, const int64_t size) {
@@ -77,9 +82,9 @@ void ApplyPermutation(T* vec, const std::vector<size_t> p) {
     }
 }
 
-TEST(FixedRadiusIndex, SearchRadius) {
+TEST_P(FixedRadiusIndexPermuteDevices, SearchRadius) {
     // Define test data.
-    core::Device device = core::Device("CUDA:0");
+    core::Device device = GetParam();
     core::Tensor dataset_points = core::Tensor::Init<float>({{0.0, 0.0, 0.0},
                                                              {0.0, 0.0, 0.1},
                                                              {0.0, 0.0, 0.2},
@@ -117,9 +122,9 @@ TEST(FixedRadiusIndex, SearchRadius) {
     EXPECT_TRUE(neighbors_row_splits.AllClose(gt_neighbors_row_splits));
 }
 
-TEST(FixedRadiusIndex, SearchRadiusBatch) {
+TEST_P(FixedRadiusIndexPermuteDevices, SearchRadiusBatch) {
     // Define test data.
-    core::Device device = core::Device("CUDA:0");
+    core::Device device = GetParam();
     core::Tensor dataset_points = core::Tensor::Init<float>(
             {{0.719, 0.128, 0.431}, {0.764, 0.970, 0.678},
              {0.692, 0.786, 0.211}, {0.692, 0.969, 0.942},
@@ -228,9 +233,9 @@ TEST(FixedRadiusIndex, SearchRadiusBatch) {
              gt_neighbors_row_splits);
 }
 
-TEST(FixedRadiusIndex, SearchHybrid) {
+TEST_P(FixedRadiusIndexPermuteDevices, SearchHybrid) {
     // Define test data.
-    core::Device device = core::Device("CUDA:0");
+    core::Device device = GetParam();
     core::Tensor dataset_points = core::Tensor::Init<float>({{0.0, 0.0, 0.0},
                                                              {0.0, 0.0, 0.1},
                                                              {0.0, 0.0, 0.2},
@@ -273,9 +278,9 @@ TEST(FixedRadiusIndex, SearchHybrid) {
     EXPECT_TRUE(counts.AllClose(gt_counts));
 }
 
-TEST(FixedRadiusIndex, SearchHybridBatch) {
+TEST_P(FixedRadiusIndexPermuteDevices, SearchHybridBatch) {
     // Define test data.
-    core::Device device = core::Device("CUDA:0");
+    core::Device device = GetParam();
     core::Tensor dataset_points = core::Tensor::Init<float>(
             {{0.719, 0.128, 0.431}, {0.764, 0.970, 0.678},
              {0.692, 0.786, 0.211}, {0.692, 0.969, 0.942},
@@ -0,0 +1,112 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/LazyTensor.h"
+
+#include "open3d/core/Tensor.h"
+#include "tests/Tests.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class LazyTensorPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(LazyTensor,
+                         LazyTensorPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(LazyTensorPermuteDevices, BinaryChain) {
+    core::Device device = GetParam();
+
+    core::Tensor a = core::Tensor::Init<float>({{1, 2, 3}, {4, 5, 6}}, device);
+    core::Tensor b = core::Tensor::Init<float>({1, 1, 1}, device);
+    core::Tensor c = core::Tensor::Init<float>({{2}, {3}}, device);
+    core::Tensor d = core::Tensor::Init<float>({{0, 1, 0}, {1, 0, 1}}, device);
+
+    core::Tensor expected = (a - b) * c + d;
+    core::LazyTensor expr = (core::LazyTensor(a) - b) * c + d;
+    EXPECT_TRUE(expr.Eval().AllClose(expected));
+    EXPECT_TRUE(expr.EvalUnfused().AllClose(expected));
+    EXPECT_EQ(expr.Eval().GetShape(), core::SizeVector({2, 3}));
+}
+
+TEST_P(LazyTensorPermuteDevices, UnaryAndScalar) {
+    core::Device device = GetParam();
+
+    core::Tensor a = core::Tensor::Init<double>({1, 4, 9, 16}, device);
+    core::Tensor b = core::Tensor::Init<double>({-1, 2, -3, 4}, device);
+
+    core::Tensor expected = (a.Sqrt() * 2.0 - b.Abs()).Neg() / 4.0 + 1.0;
+    core::LazyTensor expr =
+            -(core::LazyTensor(a).Sqrt() * 2.0 - core::LazyTensor(b).Abs()) /
+                    4.0 +
+            1.0;
+    EXPECT_TRUE(expr.Eval().AllClose(expected));
+
+    expected = 10.0 - a.Exp().Sin() - a.Cos();
+    expr = 10.0 - core::LazyTensor(a).Exp().Sin() - core::LazyTensor(a).Cos();
+    EXPECT_TRUE(expr.Eval().AllClose(expected));
+}
+
+TEST_P(LazyTensorPermuteDevices, RepeatedLeaf) {
+    core::Device device = GetParam();
+
+    core::Tensor a = core::Tensor::Init<int32_t>({1, 2, 3}, device);
+    core::LazyTensor la(a);
+
+    core::Tensor expected = a * a + a;
+    EXPECT_TRUE((la * la + la).Eval().AllClose(expected));
+    EXPECT_TRUE((la * a + a).Eval().AllClose(expected));
+}
+
+TEST_P(LazyTensorPermuteDevices, NonContiguous) {
+    core::Device device = GetParam();
+
+    core::Tensor a = core::Tensor::Init<float>({{1, 2}, {3, 4}}, device).T();
+    core::Tensor b =
+            core::Tensor::Init<float>({{5, 6, 7}, {8, 9, 10}}, device)
+                    .Slice(1, 0, 3, 2);
+
+    core::Tensor expected = a * b - b;
+    EXPECT_TRUE(((core::LazyTensor(a) * b) - b).Eval().AllClose(expected));
+}
+
+TEST_P(LazyTensorPermuteDevices, Errors) {
+    core::Device device = GetParam();
+
+    core::Tensor a = core::Tensor::Ones({2, 3}, core::Float32, device);
+    core::Tensor b = core::Tensor::Ones({4}, core::Float32, device);
+    core::Tensor c = core::Tensor::Ones({2, 3}, core::Int32, device);
+    core::Tensor i = core::Tensor::Ones({2, 3}, core::Int32, device);
+
+    EXPECT_ANY_THROW((core::LazyTensor(a) + b).Eval());
+    EXPECT_ANY_THROW((core::LazyTensor(a) + c).Eval());
+    EXPECT_ANY_THROW(core::LazyTensor(i).Sqrt().Eval());
+    EXPECT_ANY_THROW((core::LazyTensor::Constant(1) + 2).Eval());
+}
+
+}  // namespace tests
+}  // namespace open3d
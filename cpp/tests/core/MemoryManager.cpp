@@ -29,6 +29,7 @@
 #include <map>
 
 #include "open3d/core/Device.h"
+#include "open3d/core/MemoryManagerStatistic.h"
 #include "tests/Tests.h"
 #include "tests/core/CoreTest.h"
 
@@ -540,6 +541,128 @@ TEST(MemoryManagerPermuteDevices, CachedTooLargeAutoReleaseAll) {
     ExpectStatistic(dummy_mm, 3, 3, 0);
 }
 
+/// Host memory manager which counts the forwarded allocations.
+class CountingCPUMemoryManager : public core::CPUMemoryManager {
+public:
+    void* Malloc(size_t byte_size, const core::Device& device) override {
+        ++count_malloc_;
+        return core::CPUMemoryManager::Malloc(byte_size, device);
+    }
+
+    void Free(void* ptr, const core::Device& device) override {
+        ++count_free_;
+        core::CPUMemoryManager::Free(ptr, device);
+    }
+
+    int64_t count_malloc_ = 0;
+    int64_t count_free_ = 0;
+};
+
+TEST(MemoryManagerPermuteDevices, NestedPooledMemoryManager) {
+    auto cpu_mm = std::make_shared<core::CPUMemoryManager>();
+    auto pooled_mm = std::make_shared<core::PooledMemoryManager>(cpu_mm);
+
+    EXPECT_THROW(std::make_shared<core::PooledMemoryManager>(pooled_mm),
+                 std::runtime_error);
+    EXPECT_THROW(std::make_shared<core::PooledMemoryManager>(
+                         std::make_shared<core::CachedMemoryManager>(cpu_mm)),
+                 std::runtime_error);
+}
+
+TEST(MemoryManagerPermuteDevices, PooledReuse) {
+    core::Device device("CPU:0");
+    auto counting_mm = std::make_shared<CountingCPUMemoryManager>();
+    auto pooled_mm = std::make_shared<core::PooledMemoryManager>(counting_mm);
+
+    for (int i = 0; i < 5; ++i) {
+        void* ptr = pooled_mm->Malloc(100, device);
+        std::memset(ptr, 0, 100);
+        pooled_mm->Free(ptr, device);
+    }
+    EXPECT_EQ(counting_mm->count_malloc_, 1);
+    EXPECT_EQ(counting_mm->count_free_, 0);
+
+    // Requests of the same size class share blocks.
+    void* ptr = pooled_mm->Malloc(64, device);
+    EXPECT_EQ(counting_mm->count_malloc_, 1);
+    pooled_mm->Free(ptr, device);
+
+    pooled_mm->ReleasePool();
+    EXPECT_EQ(counting_mm->count_malloc_, 1);
+    EXPECT_EQ(counting_mm->count_free_, 1);
+}
+
+TEST(MemoryManagerPermuteDevices, PooledLarge) {
+    core::Device device("CPU:0");
+    auto counting_mm = std::make_shared<CountingCPUMemoryManager>();
+    auto pooled_mm = std::make_shared<core::PooledMemoryManager>(counting_mm);
+
+    size_t byte_size = core::PooledMemoryManager::kMaxPooledByteSize;
+    for (int i = 0; i < 3; ++i) {
+        void* ptr = pooled_mm->Malloc(byte_size, device);
+        pooled_mm->Free(ptr, device);
+    }
+    EXPECT_EQ(counting_mm->count_malloc_, 3);
+    EXPECT_EQ(counting_mm->count_free_, 3);
+}
+
+TEST(MemoryManagerPermuteDevices, PooledToggle) {
+    core::Device device("CPU:0");
+    auto counting_mm = std::make_shared<CountingCPUMemoryManager>();
+    auto pooled_mm =
+            std::make_shared<core::PooledMemoryManager>(counting_mm, false);
+    EXPECT_FALSE(pooled_mm->IsEnabled());
+
+    void* ptr = pooled_mm->Malloc(100, device);
+    pooled_mm->SetEnabled(true);
+    void* ptr2 = pooled_mm->Malloc(100, device);
+
+    // Blocks allocated while disabled are freed directly.
+    pooled_mm->Free(ptr, device);
+    EXPECT_EQ(counting_mm->count_free_, 1);
+    pooled_mm->Free(ptr2, device);
+    EXPECT_EQ(counting_mm->count_free_, 1);
+
+    // Disabling releases the pooled blocks.
+    pooled_mm->SetEnabled(false);
+    EXPECT_EQ(counting_mm->count_malloc_, 2);
+    EXPECT_EQ(counting_mm->count_free_, 2);
+}
+
+TEST(MemoryManagerPermuteDevices, PooledStatistic) {
+    core::Device device("CPU:0");
+    auto pooled_mm = std::make_shared<core::PooledMemoryManager>(
+            std::make_shared<core::CPUMemoryManager>());
+    auto& statistic = core::MemoryManagerStatistic::GetInstance();
+    int64_t hits = statistic.GetPoolHitCount(device);
+    int64_t misses = statistic.GetPoolMissCount(device);
+
+    void* ptr = pooled_mm->Malloc(1000, device);
+    pooled_mm->Free(ptr, device);
+    ptr = pooled_mm->Malloc(1000, device);
+    pooled_mm->Free(ptr, device);
+
+    EXPECT_EQ(statistic.GetPoolHitCount(device), hits + 1);
+    EXPECT_EQ(statistic.GetPoolMissCount(device), misses + 1);
+    pooled_mm->ReleasePool();
+}
+
+TEST(MemoryManagerPermuteDevices, CPUMemoryPool) {
+    core::Device device("CPU:0");
+    bool enabled = core::MemoryManager::IsCPUMemoryPoolEnabled();
+
+    core::MemoryManager::SetCPUMemoryPoolEnabled(false);
+    void* ptr = core::MemoryManager::Malloc(10, device);
+    core::MemoryManager::SetCPUMemoryPoolEnabled(true);
+    EXPECT_TRUE(core::MemoryManager::IsCPUMemoryPoolEnabled());
+    void* ptr2 = core::MemoryManager::Malloc(10, device);
+    core::MemoryManager::Free(ptr, device);
+    core::MemoryManager::Free(ptr2, device);
+
+    core::MemoryManager::ReleaseCPUMemoryPool();
+    core::MemoryManager::SetCPUMemoryPoolEnabled(enabled);
+}
+
 // This must be the last test for core::CachedMemoryManager.
 TEST(MemoryManagerPermuteDevices, CachedFreeOnProgramEnd) {
     core::Device device = MakeDummyDevice();
@@ -99,6 +99,122 @@ TEST(NanoFlannIndex, SearchKnn) {
     EXPECT_TRUE(distances.AllClose(gt_distances));
 }
 
+TEST(NanoFlannIndex, SearchKnnBatch) {
+    // Define test data.
+    core::Device device = core::Device("CPU:0");
+    core::Tensor dataset_points = core::Tensor::Init<float>(
+            {{0.719, 0.128, 0.431}, {0.764, 0.970, 0.678},
+             {0.692, 0.786, 0.211}, {0.692, 0.969, 0.942},
+             {0.803, 0.416, 0.863}, {0.285, 0.235, 0.058},
+             {0.576, 0.759, 0.718}, {0.419, 0.183, 0.601},
+             {0.221, 0.781, 0.229}, {0.492, 0.882, 0.958},
+             {0.787, 0.585, 0.662}, {0.630, 0.846, 0.006},
+             {0.863, 0.892, 0.848}, {0.809, 0.418, 0.544},
+             {0.283, 0.054, 0.391}, {0.043, 0.589, 0.478},
+             {0.824, 0.629, 0.629}, {0.074, 0.315, 0.639},
+             {0.170, 0.545, 0.767}, {0.140, 0.912, 0.459}},
+            device);
+    core::Tensor points_row_splits = core::Tensor::Init<int64_t>({0, 10, 20});
+    core::Tensor query_points = core::Tensor::Init<float>(
+            {{0.982, 0.974, 0.936}, {0.225, 0.345, 0.679},
+             {0.747, 0.779, 0.056}, {0.261, 0.955, 0.034},
+             {0.255, 0.003, 0.849}, {0.821, 0.475, 0.149},
+             {0.112, 0.228, 0.129}, {0.751, 0.174, 0.068},
+             {0.738, 0.345, 0.695}, {0.343, 0.273, 0.450},
+             {0.069, 0.720, 0.619}, {0.352, 0.947, 0.759},
+             {0.424, 0.756, 0.403}, {0.422, 0.179, 0.769},
+             {0.027, 0.831, 0.765}, {0.294, 0.300, 0.245},
+             {0.011, 0.409, 0.045}, {0.277, 0.310, 0.172},
+             {0.264, 0.483, 0.190}, {0.610, 0.623, 0.839},
+             {0.500, 0.063, 0.602}, {0.150, 0.145, 0.272},
+             {0.695, 0.501, 0.067}, {0.556, 0.775, 0.474},
+             {0.766, 0.954, 0.898}},
+            device);
+    core::Tensor queries_row_splits = core::Tensor::Init<int64_t>({0, 15, 25});
+
+    // Set up index.
+    core::nns::NanoFlannIndex index;
+    index.SetTensorData(dataset_points, points_row_splits);
+
+    // Single point cloud search is not available on a batched index.
+    EXPECT_THROW(index.SearchKnn(query_points, 3), std::runtime_error);
+    EXPECT_THROW(index.SearchKnn(query_points, core::Tensor::Init<int64_t>(
+                                                       {0, 10, 20, 25}),
+                                 3),
+                 std::runtime_error);
+
+    // If k == 3.
+    core::Tensor indices, distances, neighbors_row_splits;
+    core::Tensor gt_indices =
+            core::Tensor::Init<int32_t>(
+                    {{3, 1, 9}, {7, 6, 0}, {2, 8, 1}, {8, 2, 5}, {7, 0, 4},
+                     {2, 0, 5}, {5, 7, 8}, {0, 5, 7}, {4, 0, 7}, {7, 5, 0},
+                     {8, 6, 9}, {9, 6, 3}, {8, 2, 6}, {7, 0, 4}, {9, 6, 8},
+                     {4, 5, 7}, {5, 4, 7}, {4, 5, 7}, {5, 4, 7}, {0, 6, 2},
+                     {4, 3, 7}, {4, 7, 5}, {1, 3, 6}, {6, 0, 9}, {2, 6, 0}},
+                    device)
+                    .Reshape({-1});
+    core::Tensor gt_distances =
+            core::Tensor::Init<float>(
+                    {{0.084, 0.114, 0.249}, {0.070, 0.296, 0.353},
+                     {0.027, 0.307, 0.424}, {0.070, 0.246, 0.520},
+                     {0.121, 0.406, 0.471}, {0.117, 0.210, 0.353},
+                     {0.035, 0.319, 0.328}, {0.135, 0.221, 0.394},
+                     {0.037, 0.117, 0.137}, {0.037, 0.158, 0.163},
+                     {0.179, 0.268, 0.320}, {0.063, 0.087, 0.150},
+                     {0.072, 0.110, 0.122}, {0.028, 0.205, 0.210},
+                     {0.256, 0.309, 0.327}, {0.082, 0.201, 0.204},
+                     {0.221, 0.320, 0.366}, {0.114, 0.226, 0.259},
+                     {0.143, 0.225, 0.266}, {0.064, 0.090, 0.136},
+                     {0.092, 0.225, 0.246}, {0.040, 0.169, 0.251},
+                     {0.127, 0.247, 0.349}, {0.117, 0.125, 0.192},
+                     {0.016, 0.181, 0.192}},
+                    device)
+                    .Reshape({-1});
+    core::Tensor gt_row_splits = core::Tensor::Arange(0, 76, 3, core::Int64);
+
+    std::tie(indices, distances, neighbors_row_splits) =
+            index.SearchKnn(query_points, queries_row_splits, 3);
+    EXPECT_EQ(indices.GetShape(), core::SizeVector{75});
+    EXPECT_EQ(distances.GetShape(), core::SizeVector{75});
+    EXPECT_TRUE(indices.AllClose(gt_indices));
+    EXPECT_TRUE(distances.AllClose(gt_distances, 1e-5, 1e-3));
+    EXPECT_TRUE(neighbors_row_splits.AllClose(gt_row_splits));
+
+    // If k > size, each batch item returns all of its points, in the same
+    // order as a search on the point cloud of the batch item alone.
+    std::tie(indices, distances, neighbors_row_splits) =
+            index.SearchKnn(query_points, queries_row_splits, 12);
+    EXPECT_EQ(indices.GetShape(), core::SizeVector{250});
+    EXPECT_TRUE(neighbors_row_splits.AllClose(
+            core::Tensor::Arange(0, 251, 10, core::Int64)));
+    for (int64_t b = 0; b < 2; ++b) {
+        const int64_t p0 = points_row_splits[b].Item<int64_t>();
+        const int64_t p1 = points_row_splits[b + 1].Item<int64_t>();
+        const int64_t q0 = queries_row_splits[b].Item<int64_t>();
+        const int64_t q1 = queries_row_splits[b + 1].Item<int64_t>();
+        core::nns::NanoFlannIndex single_index(
+                dataset_points.Slice(0, p0, p1));
+        core::Tensor single_indices, single_distances;
+        std::tie(single_indices, single_distances) =
+                single_index.SearchKnn(query_points.Slice(0, q0, q1), 12);
+        EXPECT_TRUE(indices.Slice(0, q0 * 10, q1 * 10)
+                            .AllClose(single_indices.Reshape({-1})));
+        EXPECT_TRUE(distances.Slice(0, q0 * 10, q1 * 10)
+                            .AllClose(single_distances.Reshape({-1})));
+    }
+
+    // An empty batch item returns no neighbors for its queries.
+    index.SetTensorData(dataset_points.Slice(0, 0, 10),
+                        core::Tensor::Init<int64_t>({0, 10, 10}));
+    std::tie(indices, distances, neighbors_row_splits) =
+            index.SearchKnn(query_points, queries_row_splits, 3);
+    EXPECT_EQ(indices.GetShape(), core::SizeVector{45});
+    EXPECT_EQ(neighbors_row_splits[15].Item<int64_t>(), 45);
+    EXPECT_EQ(neighbors_row_splits[25].Item<int64_t>(), 45);
+    EXPECT_TRUE(indices.AllClose(gt_indices.Slice(0, 0, 45)));
+}
+
 TEST(NanoFlannIndex, SearchRadius) {
     // Define test data.
     core::Device device = core::Device("CPU:0");
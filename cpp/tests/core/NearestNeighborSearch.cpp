@@ -28,11 +28,15 @@
 
 #include <cmath>
 #include <limits>
+#include <random>
+#include <tuple>
+#include <vector>
 
 #include "open3d/core/Device.h"
 #include "open3d/core/Dtype.h"
 #include "open3d/core/SizeVector.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/nns/NanoFlannIndex.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/utility/Helper.h"
 #include "tests/Tests.h"
@@ -198,6 +202,50 @@ TEST_P(NNSPermuteDevices, FixedRadiusSearch) {
     EXPECT_TRUE(distances.AllClose(gt_distances));
 }
 
+TEST(NearestNeighborSearch, FixedRadiusIndexOtherRadius) {
+    // Distinct random coordinates, so that no two neighbors are tied.
+    std::mt19937 generator(0);
+    std::vector<double> points_data(3000);
+    for (double &value : points_data) {
+        value = generator() / double(std::mt19937::max());
+    }
+    core::Tensor dataset_points(points_data, {1000, 3}, core::Float64);
+    core::Tensor query_points = dataset_points.Slice(0, 0, 100);
+    core::nns::NanoFlannIndex nanoflann_index(dataset_points);
+
+    // The index is built for radius 0.2 and queried with other radii.
+    const double radius = 0.2;
+    core::nns::NearestNeighborSearch nns(dataset_points);
+    nns.FixedRadiusIndex(radius);
+    for (const double query_radius : {radius / 2, radius, radius * 2}) {
+        core::Tensor indices, distances, row_splits;
+        std::tie(indices, distances, row_splits) =
+                nns.FixedRadiusSearch(query_points, query_radius);
+        core::Tensor gt_indices, gt_distances, gt_row_splits;
+        std::tie(gt_indices, gt_distances, gt_row_splits) =
+                nanoflann_index.SearchRadius(query_points, query_radius);
+        EXPECT_TRUE(row_splits.AllClose(gt_row_splits));
+        EXPECT_TRUE(indices.AllClose(gt_indices));
+        EXPECT_TRUE(distances.AllClose(gt_distances));
+
+        std::tie(indices, distances, row_splits) =
+                nns.HybridSearch(query_points, query_radius, 10);
+        std::tie(gt_indices, gt_distances, gt_row_splits) =
+                nanoflann_index.SearchHybrid(query_points, query_radius, 10);
+        EXPECT_TRUE(row_splits.AllClose(gt_row_splits));
+        EXPECT_TRUE(indices.AllClose(gt_indices));
+        EXPECT_TRUE(distances.AllClose(gt_distances));
+    }
+
+    // Knn search still works after building the index for radius search.
+    core::Tensor indices, distances, gt_indices, gt_distances;
+    std::tie(indices, distances) = nns.KnnSearch(query_points, 5);
+    std::tie(gt_indices, gt_distances) =
+            nanoflann_index.SearchKnn(query_points, 5);
+    EXPECT_TRUE(indices.AllClose(gt_indices));
+    EXPECT_TRUE(distances.AllClose(gt_distances));
+}
+
 TEST(NearestNeighborSearch, MultiRadiusSearch) {
     // Define test data.
     core::Tensor dataset_points = core::Tensor::Init<double>({{0.0, 0.0, 0.0},
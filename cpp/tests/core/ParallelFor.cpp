@@ -56,6 +56,49 @@ TEST(ParallelFor, LambdaCPU) {
     }
 }
 
+TEST(ParallelFor, LambdaCPUTBB) {
+    const core::Device device("CPU:0");
+    const core::ParallelForBackend backend = core::GetParallelForBackend();
+    const int64_t grain_size = core::GetParallelForGrainSize();
+    core::SetParallelForBackend(core::ParallelForBackend::TBB);
+
+    for (int64_t grain : {0, 1, 1000}) {
+        core::SetParallelForGrainSize(grain);
+        const size_t N = 1000000;
+        core::Tensor tensor({N, 1}, core::Int64, device);
+        core::ParallelFor(device, tensor.NumElements(), [&](int64_t idx) {
+            tensor.GetDataPtr<int64_t>()[idx] = idx;
+        });
+        for (int64_t i = 0; i < tensor.NumElements(); ++i) {
+            ASSERT_EQ(tensor.GetDataPtr<int64_t>()[i], i);
+        }
+    }
+    EXPECT_ANY_THROW(core::SetParallelForGrainSize(-1));
+
+    core::SetParallelForBackend(backend);
+    core::SetParallelForGrainSize(grain_size);
+}
+
+TEST(ParallelFor, NestedTBB) {
+    const core::Device device("CPU:0");
+    const core::ParallelForBackend backend = core::GetParallelForBackend();
+    core::SetParallelForBackend(core::ParallelForBackend::TBB);
+
+    const int64_t rows = 100;
+    const int64_t cols = 1000;
+    std::vector<int64_t> v(rows * cols, 0);
+    core::ParallelFor(device, rows, [&](int64_t row) {
+        core::ParallelFor(device, cols, [&](int64_t col) {
+            v[row * cols + col] = row * cols + col;
+        });
+    });
+    for (int64_t i = 0; i < rows * cols; ++i) {
+        ASSERT_EQ(v[i], i);
+    }
+
+    core::SetParallelForBackend(backend);
+}
+
 TEST(ParallelFor, VectorizedLambda1) {
     const size_t N = 10000000;
     std::vector<int64_t> v(N);
@@ -0,0 +1,127 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/ScopedArena.h"
+
+#include "open3d/core/Blob.h"
+#include "open3d/core/Device.h"
+#include "open3d/core/Tensor.h"
+#include "tests/Tests.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class ScopedArenaPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(ScopedArena,
+                         ScopedArenaPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(ScopedArenaPermuteDevices, BumpAllocation) {
+    core::Device device = GetParam();
+
+    core::ScopedArena arena(device, 1024);
+    EXPECT_EQ(arena.GetUsedByteSize(), 0);
+    EXPECT_GE(arena.GetByteSize(), 1024);
+
+    core::Blob b0(10, device);
+    core::Blob b1(100, device);
+    EXPECT_EQ(arena.GetUsedByteSize(), 64 + 128);
+    EXPECT_EQ(static_cast<char*>(b1.GetDataPtr()) -
+                      static_cast<char*>(b0.GetDataPtr()),
+              64);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(b0.GetDataPtr()) % 64, 0u);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(b1.GetDataPtr()) % 64, 0u);
+
+    // Exhausted arenas fall back to the memory manager.
+    core::Blob b2(2048, device);
+    EXPECT_EQ(arena.GetUsedByteSize(), 64 + 128);
+}
+
+TEST_P(ScopedArenaPermuteDevices, RegionReuse) {
+    core::Device device = GetParam();
+    core::ScopedArena::ReleaseCache();
+
+    void* first_ptr = nullptr;
+    for (int i = 0; i < 3; ++i) {
+        core::ScopedArena arena(device, 1 << 16);
+        core::Tensor t = core::Tensor::Ones({10, 3}, core::Float32, device);
+        if (i == 0) {
+            first_ptr = t.GetDataPtr();
+        }
+        EXPECT_EQ(t.GetDataPtr(), first_ptr);
+    }
+
+    core::ScopedArena::ReleaseCache();
+}
+
+TEST_P(ScopedArenaPermuteDevices, EscapingTensor) {
+    core::Device device = GetParam();
+
+    core::Tensor escaped;
+    {
+        core::ScopedArena arena(device, 1 << 16);
+        escaped = core::Tensor::Full({4}, 3.f, core::Float32, device);
+    }
+
+    // A new arena must not reuse the region held by the escaped tensor.
+    {
+        core::ScopedArena arena(device, 1 << 16);
+        core::Tensor t = core::Tensor::Zeros({4}, core::Float32, device);
+        EXPECT_NE(t.GetDataPtr(), escaped.GetDataPtr());
+    }
+    EXPECT_TRUE(escaped.AllClose(
+            core::Tensor::Full({4}, 3.f, core::Float32, device)));
+
+    core::ScopedArena::ReleaseCache();
+}
+
+TEST_P(ScopedArenaPermuteDevices, Nested) {
+    core::Device device = GetParam();
+
+    core::ScopedArena outer(device, 1024);
+    core::Blob b0(64, device);
+    {
+        core::ScopedArena inner(device, 1024);
+        core::Blob b1(64, device);
+        EXPECT_EQ(outer.GetUsedByteSize(), 64);
+        EXPECT_EQ(inner.GetUsedByteSize(), 64);
+    }
+    core::Blob b2(64, device);
+    EXPECT_EQ(outer.GetUsedByteSize(), 128);
+}
+
+TEST(ScopedArena, OtherDevice) {
+    core::ScopedArena arena(core::Device("CPU:0"), 1024);
+
+    std::function<void(void*)> deleter;
+    EXPECT_EQ(core::ScopedArena::Malloc(64, core::Device("CUDA:0"), deleter),
+              nullptr);
+    EXPECT_EQ(arena.GetUsedByteSize(), 0);
+}
+
+}  // namespace tests
+}  // namespace open3d
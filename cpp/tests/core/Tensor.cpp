@@ -2257,6 +2257,52 @@ TEST_P(TensorPermuteDevices, ReduceArgMax) {
               std::vector<int64_t>({1, 2, 2, 1, 3, 2}));
 }
 
+TEST_P(TensorPermuteDevices, ReduceLargePointCloudShape) {
+    core::Device device = GetParam();
+
+    // Large enough to split the reduction dimension across threads. Values
+    // repeat so that arg-reductions must return the first occurrence.
+    const int64_t num_points = 100003;
+    std::vector<int> vals(num_points * 3);
+    for (int64_t i = 0; i < num_points * 3; ++i) {
+        vals[i] = static_cast<int>((i * 7919) % 1000);
+    }
+    core::Tensor src(vals, {num_points, 3}, core::Int32, device);
+
+    std::vector<int> ref_sum(3, 0);
+    std::vector<int> ref_min(3, std::numeric_limits<int>::max());
+    std::vector<int64_t> ref_argmax(3, 0);
+    int64_t ref_flat_argmin = 0;
+    for (int64_t i = 0; i < num_points; ++i) {
+        for (int64_t j = 0; j < 3; ++j) {
+            int val = vals[i * 3 + j];
+            ref_sum[j] += val;
+            ref_min[j] = std::min(ref_min[j], val);
+            if (val > vals[ref_argmax[j] * 3 + j]) {
+                ref_argmax[j] = i;
+            }
+            if (val < vals[ref_flat_argmin]) {
+                ref_flat_argmin = i * 3 + j;
+            }
+        }
+    }
+
+    EXPECT_EQ(src.Sum({0}).ToFlatVector<int>(), ref_sum);
+    EXPECT_EQ(src.Min({0}).ToFlatVector<int>(), ref_min);
+    EXPECT_EQ(src.ArgMax({0}).ToFlatVector<int64_t>(), ref_argmax);
+    EXPECT_EQ(src.ArgMin({0, 1}).ToFlatVector<int64_t>(),
+              std::vector<int64_t>({ref_flat_argmin}));
+    EXPECT_EQ(src.Sum({0, 1}).ToFlatVector<int>(),
+              std::vector<int>(
+                      {std::accumulate(vals.begin(), vals.end(), 0)}));
+
+    core::Tensor row_sum = src.Sum({1});
+    EXPECT_EQ(row_sum.GetShape(), core::SizeVector({num_points}));
+    EXPECT_EQ(row_sum[num_points - 1].Item<int>(),
+              vals[num_points * 3 - 3] + vals[num_points * 3 - 2] +
+                      vals[num_points * 3 - 1]);
+}
+
 TEST_P(TensorPermuteDevices, Sqrt) {
     core::Device device = GetParam();
     core::Tensor src =
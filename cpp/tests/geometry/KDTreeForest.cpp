@@ -0,0 +1,124 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/KDTreeForest.h"
+
+#include <random>
+
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+static Eigen::MatrixXd RandomMatrix(int rows, int cols, unsigned int seed) {
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<double> distribution(0.0, 10.0);
+    Eigen::MatrixXd matrix(rows, cols);
+    for (int c = 0; c < cols; ++c) {
+        for (int r = 0; r < rows; ++r) {
+            matrix(r, c) = distribution(generator);
+        }
+    }
+    return matrix;
+}
+
+static std::vector<int> BruteForceKNN(const Eigen::MatrixXd &data,
+                                      const Eigen::VectorXd &query,
+                                      int knn) {
+    std::vector<std::pair<double, int>> distances;
+    for (int i = 0; i < data.cols(); ++i) {
+        distances.emplace_back((data.col(i) - query).squaredNorm(), i);
+    }
+    std::sort(distances.begin(), distances.end());
+    std::vector<int> indices;
+    for (int i = 0; i < knn; ++i) indices.push_back(distances[i].second);
+    return indices;
+}
+
+TEST(KDTreeForest, SearchKNN) {
+    const Eigen::MatrixXd data = RandomMatrix(3, 1000, 0);
+    const Eigen::MatrixXd queries = RandomMatrix(3, 50, 1);
+    geometry::KDTreeForest forest(data, 4, 42);
+
+    std::vector<int> indices;
+    std::vector<double> distance2;
+    for (int i = 0; i < queries.cols(); ++i) {
+        const Eigen::Vector3d query = queries.col(i);
+        // An unlimited budget explores every branch that may hold a closer
+        // point.
+        EXPECT_EQ(forest.SearchKNN(query, 10, 0, indices, distance2), 10);
+        ExpectEQ(indices, BruteForceKNN(data, query, 10));
+        EXPECT_TRUE(std::is_sorted(distance2.begin(), distance2.end()));
+        for (int k = 0; k < 10; ++k) {
+            EXPECT_NEAR(distance2[k],
+                        (data.col(indices[k]) - queries.col(i)).squaredNorm(),
+                        1e-10);
+        }
+    }
+
+    // knn larger than the dataset returns every point once.
+    geometry::KDTreeForest small_forest(RandomMatrix(3, 5, 2), 4, 42);
+    EXPECT_EQ(small_forest.SearchKNN(Eigen::Vector3d(1.0, 2.0, 3.0), 10, 0,
+                                     indices, distance2),
+              5);
+    std::sort(indices.begin(), indices.end());
+    ExpectEQ(indices, std::vector<int>({0, 1, 2, 3, 4}));
+
+    // Invalid queries.
+    EXPECT_EQ(forest.SearchKNN(Eigen::VectorXd(Eigen::VectorXd::Zero(4)), 1, 0,
+                               indices, distance2),
+              -1);
+    EXPECT_EQ(geometry::KDTreeForest().SearchKNN(Eigen::Vector3d(0, 0, 0), 1,
+                                                 0, indices, distance2),
+              -1);
+}
+
+TEST(KDTreeForest, Recall) {
+    const int dimension = 33;
+    const Eigen::MatrixXd data = RandomMatrix(dimension, 2000, 0);
+    const Eigen::MatrixXd queries = RandomMatrix(dimension, 100, 1);
+    geometry::KDTreeForest forest(data, 4, 42);
+
+    auto recall = [&](int max_checks) {
+        int num_hits = 0;
+        std::vector<int> indices;
+        std::vector<double> distance2;
+        for (int i = 0; i < queries.cols(); ++i) {
+            const Eigen::VectorXd query = queries.col(i);
+            forest.SearchKNN(query, 1, max_checks, indices, distance2);
+            num_hits += indices[0] == BruteForceKNN(data, query, 1)[0];
+        }
+        return num_hits / double(queries.cols());
+    };
+    const double low_recall = recall(32);
+    const double high_recall = recall(2048);
+    EXPECT_GT(high_recall, 0.5);
+    EXPECT_GE(high_recall, low_recall);
+    EXPECT_EQ(recall(0), 1.0);
+}
+
+}  // namespace tests
+}  // namespace open3d
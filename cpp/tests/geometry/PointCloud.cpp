@@ -27,6 +27,7 @@
 #include "open3d/geometry/PointCloud.h"
 
 #include <algorithm>
+#include <limits>
 
 #include "open3d/camera/PinholeCameraIntrinsic.h"
 #include "open3d/data/Dataset.h"
@@ -825,6 +826,47 @@ TEST(PointCloud, FarthestPointDownSample) {
                                                               {0, 1.0, 1.0}}));
 }  // namespace tests
 
+TEST(PointCloud, FarthestPointDownSampleLarge) {
+    // Enough points to split the parallel search into several chunks.
+    geometry::PointCloud pcd;
+    pcd.points_.resize(50000);
+    Rand(pcd.points_, Eigen::Vector3d(-1, -1, -1), Eigen::Vector3d(1, 1, 1),
+         0);
+    // Duplicates tie with their originals and must resolve to the lowest
+    // index, as in a serial scan.
+    std::vector<Eigen::Vector3d> duplicates(pcd.points_.begin(),
+                                            pcd.points_.begin() + 1000);
+    pcd.points_.insert(pcd.points_.end(), duplicates.begin(),
+                       duplicates.end());
+
+    const size_t num_samples = 64;
+    std::vector<size_t> expected_indices;
+    std::vector<double> distances(pcd.points_.size(),
+                                  std::numeric_limits<double>::infinity());
+    size_t farthest_index = 0;
+    for (size_t i = 0; i < num_samples; i++) {
+        expected_indices.push_back(farthest_index);
+        const Eigen::Vector3d selected = pcd.points_[farthest_index];
+        double max_dist = 0;
+        for (size_t j = 0; j < pcd.points_.size(); j++) {
+            distances[j] = std::min(distances[j],
+                                    (pcd.points_[j] - selected).squaredNorm());
+            if (distances[j] > max_dist) {
+                max_dist = distances[j];
+                farthest_index = j;
+            }
+        }
+    }
+
+    // The samples keep the order of the input points.
+    std::sort(expected_indices.begin(), expected_indices.end());
+    std::vector<Eigen::Vector3d> expected;
+    for (size_t index : expected_indices) {
+        expected.push_back(pcd.points_[index]);
+    }
+    ExpectEQ(pcd.FarthestPointDownSample(num_samples)->points_, expected);
+}
+
 TEST(PointCloud, Crop_AxisAlignedBoundingBox) {
     geometry::AxisAlignedBoundingBox aabb({0, 0, 0}, {2, 2, 2});
     geometry::PointCloud pcd({{0, 0, 0},
@@ -0,0 +1,169 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/ASCIIParser.h"
+
+#include <algorithm>
+#include <clocale>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+static const char *ParseDouble(const std::string &text, double &value) {
+    return io::ParseDouble(text.data(), text.data() + text.size(), value);
+}
+
+TEST(ASCIIParser, ParseDouble) {
+    for (const std::string text :
+         {"0", "-0", "1", "-1", "+7", "3.14159", "-.5", "5.", "1e10",
+          "1E-10", "-2.5e+3", "0.0000000001", "123456789.0123456789",
+          "4500000.1234567890", "1.7976931348623157e308", "4.9e-324",
+          "1e400", "1e-400", "12345678901234567890123"}) {
+        SCOPED_TRACE(text);
+        double value;
+        const char *end = ParseDouble(text, value);
+        ASSERT_NE(end, nullptr);
+        EXPECT_EQ(end, text.data() + text.size());
+        EXPECT_EQ(value, std::strtod(text.c_str(), nullptr));
+    }
+
+    // Leading blanks are skipped and parsing stops at the first character
+    // that is not part of the number.
+    std::string text = " \t1.5 2";
+    double value;
+    EXPECT_EQ(ParseDouble(text, value), text.data() + 5);
+    EXPECT_EQ(value, 1.5);
+    text = "1e";
+    EXPECT_EQ(ParseDouble(text, value), text.data() + 1);
+    EXPECT_EQ(value, 1.0);
+
+    EXPECT_NE(ParseDouble("nan", value), nullptr);
+    EXPECT_TRUE(std::isnan(value));
+    EXPECT_NE(ParseDouble("-Infinity", value), nullptr);
+    EXPECT_EQ(value, -INFINITY);
+
+    EXPECT_EQ(ParseDouble("", value), nullptr);
+    EXPECT_EQ(ParseDouble("   ", value), nullptr);
+    EXPECT_EQ(ParseDouble(".", value), nullptr);
+    EXPECT_EQ(ParseDouble("-", value), nullptr);
+    EXPECT_EQ(ParseDouble("x1", value), nullptr);
+}
+
+TEST(ASCIIParser, ParseDoubleRoundTrip) {
+    char buffer[64];
+    for (int i = 0; i < 10000; ++i) {
+        const double x = std::ldexp(std::sin(i + 1.0), i % 80 - 40);
+        for (const char *format : {"%.10f", "%.17g", "%e"}) {
+            snprintf(buffer, sizeof(buffer), format, x);
+            double value;
+            ASSERT_NE(io::ParseDouble(buffer, buffer + strlen(buffer), value),
+                      nullptr);
+            EXPECT_EQ(value, std::strtod(buffer, nullptr)) << buffer;
+        }
+    }
+}
+
+TEST(ASCIIParser, ParseASCIIRows) {
+    // Blank, short and malformed lines are skipped, extra values are ignored.
+    const std::string text =
+            "1 2 3\r\n"
+            "\n"
+            "4 5\n"
+            "x 1 2\n"
+            "7\t8 9 10\n"
+            "-1e2 .5 3";
+    std::vector<double> values;
+    int64_t max_rows = 0;
+    const int64_t num_rows = io::ParseASCIIRows(
+            text.data(), text.size(), 3, [&](int64_t num_rows) {
+                max_rows = num_rows;
+                values.resize(num_rows * 3);
+                return values.data();
+            });
+    EXPECT_EQ(max_rows, 6);
+    ASSERT_EQ(num_rows, 3);
+    values.resize(num_rows * 3);
+    EXPECT_EQ(values, std::vector<double>({1, 2, 3, 7, 8, 9, -100, 0.5, 3}));
+
+    EXPECT_EQ(io::ParseASCIIRows(nullptr, 0, 3,
+                                 [&](int64_t num_rows) {
+                                     values.resize(num_rows * 3);
+                                     return values.data();
+                                 }),
+              0);
+}
+
+TEST(ASCIIParser, ParseASCIIRowsLarge) {
+    // Large enough to be split into several chunks.
+    const int64_t num_lines = 200000;
+    std::string text;
+    char line[128];
+    for (int64_t i = 0; i < num_lines; ++i) {
+        if (i % 1000 == 7) {
+            text += "# comment\n";
+        } else {
+            snprintf(line, sizeof(line), "%.10f %.10f %.10f %.10f\n", i * 1e-3,
+                     i * -2e-3, i * 1.5, static_cast<double>(i % 256));
+            text += line;
+        }
+    }
+
+    std::vector<double> values;
+    std::vector<int64_t> progress;
+    const int64_t num_rows = io::ParseASCIIRows(
+            text.data(), text.size(), 4,
+            [&](int64_t num_rows) {
+                values.resize(num_rows * 4);
+                return values.data();
+            },
+            [&](int64_t num_bytes) { progress.push_back(num_bytes); });
+    ASSERT_EQ(num_rows, num_lines - num_lines / 1000);
+
+    // Progress is reported in increasing steps up to the whole text.
+    EXPECT_GT(progress.size(), 10u);
+    EXPECT_TRUE(std::is_sorted(progress.begin(), progress.end()));
+    EXPECT_EQ(progress.back(), static_cast<int64_t>(text.size()));
+
+    int64_t row = 0;
+    for (int64_t i = 0; i < num_lines; ++i) {
+        if (i % 1000 == 7) continue;
+        snprintf(line, sizeof(line), "%.10f", i * 1.5);
+        ASSERT_EQ(values[4 * row + 2], std::strtod(line, nullptr));
+        ASSERT_EQ(values[4 * row + 3], static_cast<double>(i % 256));
+        ++row;
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
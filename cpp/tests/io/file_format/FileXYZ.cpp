@@ -24,6 +24,10 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cstdio>
+
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/io/PointCloudIO.h"
 #include "tests/Tests.h"
 
 namespace open3d {
@@ -33,5 +37,18 @@ TEST(FileXYZ, DISABLED_ReadPointCloudFromXYZ) { NotImplemented(); }
 
 TEST(FileXYZ, DISABLED_WritePointCloudToXYZ) { NotImplemented(); }
 
+TEST(FileXYZ, ReadEmptyPointCloudFromXYZ) {
+    const std::string filename = "test_empty.xyz";
+    FILE *file = fopen(filename.c_str(), "w");
+    ASSERT_NE(file, nullptr);
+    fclose(file);
+
+    geometry::PointCloud pcd;
+    pcd.points_.emplace_back(1, 2, 3);
+    EXPECT_TRUE(io::ReadPointCloud(filename, pcd));
+    EXPECT_TRUE(pcd.points_.empty());
+    std::remove(filename.c_str());
+}
+
 }  // namespace tests
 }  // namespace open3d
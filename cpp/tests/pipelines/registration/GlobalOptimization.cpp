@@ -24,17 +24,113 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/pipelines/registration/GlobalOptimization.h"
+
+#include <Eigen/Dense>
+#include <random>
+
+#include "open3d/pipelines/registration/GlobalOptimizationConvergenceCriteria.h"
+#include "open3d/pipelines/registration/GlobalOptimizationMethod.h"
+#include "open3d/pipelines/registration/PoseGraph.h"
+#include "open3d/utility/Eigen.h"
 #include "tests/Tests.h"
 
 namespace open3d {
 namespace tests {
 
+using namespace pipelines::registration;
+
+// A trajectory with a constant motion per step. The node poses are perturbed
+// with accumulated drift, while odometry and loop closure edges are exact.
+static PoseGraph CreateDriftingPoseGraph(int num_nodes, Eigen::Matrix4d &step) {
+    Eigen::Vector6d motion;
+    motion << 0.02, -0.01, 0.03, 0.1, 0.05, 0.02;
+    step = utility::TransformVector6dToMatrix4d(motion);
+    const Eigen::Matrix6d information = Eigen::Matrix6d::Identity() * 100.0;
+
+    std::mt19937 rng(0);
+    std::normal_distribution<double> noise(0.0, 0.01);
+    PoseGraph pose_graph;
+    Eigen::Matrix4d drift = Eigen::Matrix4d::Identity();
+    Eigen::Matrix4d pose = Eigen::Matrix4d::Identity();
+    for (int i = 0; i < num_nodes; i++) {
+        pose_graph.nodes_.push_back(PoseGraphNode(drift * pose));
+        Eigen::Vector6d perturbation;
+        for (int k = 0; k < 6; k++) perturbation(k) = noise(rng);
+        drift = utility::TransformVector6dToMatrix4d(perturbation) * drift;
+        pose = step * pose;
+    }
+    for (int i = 0; i + 1 < num_nodes; i++) {
+        pose_graph.edges_.push_back(PoseGraphEdge(i, i + 1, step.inverse(),
+                                                  information, false));
+    }
+    Eigen::Matrix4d loop = Eigen::Matrix4d::Identity();
+    for (int k = 0; k < 10; k++) loop = step * loop;
+    for (int i = 0; i + 10 < num_nodes; i += 5) {
+        pose_graph.edges_.push_back(PoseGraphEdge(i, i + 10, loop.inverse(),
+                                                  information, true));
+    }
+    return pose_graph;
+}
+
+static void ExpectConsistentPoseGraph(const PoseGraph &pose_graph,
+                                      const Eigen::Matrix4d &step) {
+    const Eigen::Matrix4d reference_pose = pose_graph.nodes_[0].pose_;
+    ExpectEQ(reference_pose, Eigen::Matrix4d(Eigen::Matrix4d::Identity()));
+    for (size_t i = 0; i + 1 < pose_graph.nodes_.size(); i++) {
+        const Eigen::Matrix4d relative_pose =
+                pose_graph.nodes_[i + 1].pose_ *
+                pose_graph.nodes_[i].pose_.inverse();
+        ExpectEQ(relative_pose, step, 1e-4);
+    }
+}
+
 TEST(GlobalOptimization, DISABLED_Constructor) { NotImplemented(); }
 
 TEST(GlobalOptimization, DISABLED_MemberData) { NotImplemented(); }
 
-TEST(GlobalOptimization, DISABLED_GlobalOptimizationLevenbergMarquardt) {
-    NotImplemented();
+TEST(GlobalOptimization, GlobalOptimizationLevenbergMarquardt) {
+    Eigen::Matrix4d step;
+    PoseGraph pose_graph = CreateDriftingPoseGraph(60, step);
+    GlobalOptimization(pose_graph, GlobalOptimizationLevenbergMarquardt(),
+                       GlobalOptimizationConvergenceCriteria(),
+                       GlobalOptimizationOption(0.075, 0.25, 1.0, 0));
+
+    EXPECT_EQ(pose_graph.nodes_.size(), 60u);
+    EXPECT_EQ(pose_graph.edges_.size(), 69u);
+    ExpectConsistentPoseGraph(pose_graph, step);
+}
+
+TEST(GlobalOptimization, GlobalOptimizationGaussNewton) {
+    Eigen::Matrix4d step;
+    PoseGraph pose_graph = CreateDriftingPoseGraph(60, step);
+    GlobalOptimization(pose_graph, GlobalOptimizationGaussNewton(),
+                       GlobalOptimizationConvergenceCriteria(),
+                       GlobalOptimizationOption(0.075, 0.25, 1.0, 0));
+
+    EXPECT_EQ(pose_graph.nodes_.size(), 60u);
+    EXPECT_EQ(pose_graph.edges_.size(), 69u);
+    ExpectConsistentPoseGraph(pose_graph, step);
+}
+
+TEST(GlobalOptimization, GlobalOptimizationSingularSystem) {
+    Eigen::Matrix4d step;
+    PoseGraph pose_graph = CreateDriftingPoseGraph(60, step);
+    // A node that is only attached by an edge without information makes the
+    // linear system singular. The sparse solver regularizes it instead of
+    // failing, and the rest of the graph is still optimized.
+    pose_graph.nodes_.push_back(
+            PoseGraphNode(step * pose_graph.nodes_.back().pose_));
+    pose_graph.edges_.push_back(PoseGraphEdge(59, 60, step.inverse(),
+                                              Eigen::Matrix6d::Zero(), false));
+    GlobalOptimization(pose_graph, GlobalOptimizationGaussNewton(),
+                       GlobalOptimizationConvergenceCriteria(),
+                       GlobalOptimizationOption(0.075, 0.25, 1.0, 0));
+
+    EXPECT_EQ(pose_graph.nodes_.size(), 61u);
+    EXPECT_TRUE(pose_graph.nodes_.back().pose_.allFinite());
+    pose_graph.nodes_.pop_back();
+    ExpectConsistentPoseGraph(pose_graph, step);
 }
 
 TEST(GlobalOptimization, DISABLED_GlobalOptimizationConvergenceCriteria) {
@@ -28,6 +28,9 @@
 
 #include <gmock/gmock.h>
 
+#include <algorithm>
+#include <random>
+
 #include "core/CoreTest.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/data/Dataset.h"
@@ -293,6 +296,50 @@ TEST_P(PointCloudPermuteDevices, EstimateNormals) {
     EXPECT_TRUE(pcd.GetPointNormals().AllClose(normals, 1e-4, 1e-4));
 }
 
+TEST_P(PointCloudPermuteDevices, ClusterDBSCAN) {
+    core::Device device = GetParam();
+
+    // Two clusters with border points at their ends, and one noise point.
+    t::geometry::PointCloud pcd(core::Tensor::Init<float>({{0, 0, 0},
+                                                           {0.1, 0, 0},
+                                                           {0.2, 0, 0},
+                                                           {0.3, 0, 0},
+                                                           {1.0, 0, 0},
+                                                           {1.1, 0, 0},
+                                                           {1.2, 0, 0},
+                                                           {3.0, 0, 0}},
+                                                          device));
+    core::Tensor labels = pcd.ClusterDBSCAN(0.15, 3);
+    EXPECT_EQ(labels.GetDtype(), core::Int32);
+    EXPECT_EQ(labels.ToFlatVector<int32_t>(),
+              std::vector<int32_t>({0, 0, 0, 0, 1, 1, 1, -1}));
+    EXPECT_EQ(pcd.ClusterDBSCAN(0.15, 1).ToFlatVector<int32_t>(),
+              std::vector<int32_t>({0, 0, 0, 0, 1, 1, 1, 2}));
+    EXPECT_ANY_THROW(pcd.ClusterDBSCAN(0, 3));
+
+    // Random blobs with noise match the legacy implementation.
+    std::mt19937 rng(0);
+    std::normal_distribution<double> normal(0.0, 0.05);
+    std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+    geometry::PointCloud legacy_pcd;
+    for (int i = 0; i < 6000; ++i) {
+        const Eigen::Vector3d center(0.5 * (i % 3) - 0.5, 0, 0);
+        legacy_pcd.points_.push_back(
+                i % 5 == 0 ? Eigen::Vector3d(uniform(rng), uniform(rng),
+                                             uniform(rng))
+                           : Eigen::Vector3d(center.x() + normal(rng),
+                                             normal(rng), normal(rng)));
+    }
+    std::vector<int> legacy_labels = legacy_pcd.ClusterDBSCAN(0.03, 10);
+    core::Tensor random_labels =
+            t::geometry::PointCloud::FromLegacy(legacy_pcd, core::Float64,
+                                                device)
+                    .ClusterDBSCAN(0.03, 10);
+    EXPECT_EQ(random_labels.ToFlatVector<int32_t>(),
+              std::vector<int32_t>(legacy_labels.begin(),
+                                   legacy_labels.end()));
+}
+
 TEST_P(PointCloudPermuteDevices, FromLegacy) {
     core::Device device = GetParam();
     geometry::PointCloud legacy_pcd;
@@ -692,7 +739,253 @@ TEST_P(PointCloudPermuteDevices, VoxelDownSample) {
                                       device));
     auto pcd_small_down = pcd_small.VoxelDownSample(1);
     EXPECT_TRUE(pcd_small_down.GetPointPositions().AllClose(
-            core::Tensor::Init<float>({{0, 0, 0}}, device)));
+            core::Tensor::Init<float>({{0.375, 0.375, 0.575}}, device)));
+}
+
+TEST_P(PointCloudPermuteDevices, SelectByMask) {
+    core::Device device = GetParam();
+
+    t::geometry::PointCloud pcd(core::Tensor::Init<float>(
+            {{0, 0, 0}, {1, 1, 1}, {2, 2, 2}, {3, 3, 3}}, device));
+    pcd.SetPointColors(core::Tensor::Init<float>(
+            {{0, 0, 0}, {0.1, 0.1, 0.1}, {0.2, 0.2, 0.2}, {0.3, 0.3, 0.3}},
+            device));
+    core::Tensor mask =
+            core::Tensor::Init<bool>({true, false, false, true}, device);
+
+    t::geometry::PointCloud pcd_select = pcd.SelectByMask(mask);
+    EXPECT_TRUE(pcd_select.GetPointPositions().AllClose(
+            core::Tensor::Init<float>({{0, 0, 0}, {3, 3, 3}}, device)));
+    EXPECT_TRUE(pcd_select.GetPointColors().AllClose(
+            core::Tensor::Init<float>({{0, 0, 0}, {0.3, 0.3, 0.3}}, device)));
+
+    t::geometry::PointCloud pcd_invert = pcd.SelectByMask(mask, true);
+    EXPECT_TRUE(pcd_invert.GetPointPositions().AllClose(
+            core::Tensor::Init<float>({{1, 1, 1}, {2, 2, 2}}, device)));
+
+    EXPECT_ANY_THROW(pcd.SelectByMask(
+            core::Tensor::Init<bool>({true, false}, device)));
+}
+
+TEST_P(PointCloudPermuteDevices, RemoveOutliers) {
+    core::Device device = GetParam();
+
+    // A dense blob with sparse noise around it.
+    std::mt19937 rng(0);
+    std::normal_distribution<double> normal(0.0, 0.1);
+    std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+    geometry::PointCloud legacy_pcd;
+    for (int i = 0; i < 3000; ++i) {
+        legacy_pcd.points_.push_back(
+                i % 10 == 0 ? Eigen::Vector3d(uniform(rng), uniform(rng),
+                                              uniform(rng))
+                            : Eigen::Vector3d(normal(rng), normal(rng),
+                                              normal(rng)));
+    }
+    // Duplicates with a zero mean neighbor distance, which the statistical
+    // filter leaves out of its statistics and removes.
+    for (int i = 0; i < 30; ++i) {
+        legacy_pcd.points_.push_back(Eigen::Vector3d(0.05, 0.05, 0.05));
+    }
+    t::geometry::PointCloud pcd = t::geometry::PointCloud::FromLegacy(
+            legacy_pcd, core::Float64, device);
+    auto indices_to_mask = [&](const std::vector<size_t> &indices) {
+        std::vector<bool> mask(legacy_pcd.points_.size(), false);
+        for (size_t index : indices) {
+            mask[index] = true;
+        }
+        return mask;
+    };
+    auto tensor_to_mask = [](const core::Tensor &mask) {
+        std::vector<bool> mask_vector;
+        for (bool value : mask.ToFlatVector<bool>()) {
+            mask_vector.push_back(value);
+        }
+        return mask_vector;
+    };
+
+    t::geometry::PointCloud pcd_radius;
+    core::Tensor radius_mask;
+    std::tie(pcd_radius, radius_mask) = pcd.RemoveRadiusOutliers(10, 0.1);
+    std::vector<size_t> radius_indices;
+    std::tie(std::ignore, radius_indices) =
+            legacy_pcd.RemoveRadiusOutliers(10, 0.1);
+    EXPECT_EQ(radius_mask.GetDtype(), core::Bool);
+    EXPECT_EQ(tensor_to_mask(radius_mask), indices_to_mask(radius_indices));
+    EXPECT_EQ(pcd_radius.GetPointPositions().GetLength(),
+              static_cast<int64_t>(radius_indices.size()));
+    EXPECT_LT(radius_indices.size(), legacy_pcd.points_.size());
+    EXPECT_ANY_THROW(pcd.RemoveRadiusOutliers(0, 0.1));
+
+    t::geometry::PointCloud pcd_statistical;
+    core::Tensor statistical_mask;
+    std::tie(pcd_statistical, statistical_mask) =
+            pcd.RemoveStatisticalOutliers(20, 2.0);
+    std::vector<size_t> statistical_indices;
+    std::tie(std::ignore, statistical_indices) =
+            legacy_pcd.RemoveStatisticalOutliers(20, 2.0);
+    EXPECT_EQ(tensor_to_mask(statistical_mask),
+              indices_to_mask(statistical_indices));
+    EXPECT_EQ(pcd_statistical.GetPointPositions().GetLength(),
+              static_cast<int64_t>(statistical_indices.size()));
+    EXPECT_LT(statistical_indices.size(), legacy_pcd.points_.size());
+    EXPECT_ANY_THROW(pcd.RemoveStatisticalOutliers(20, 0));
+}
+
+TEST_P(PointCloudPermuteDevices, VoxelDownSampleReduction) {
+    core::Device device = GetParam();
+
+    t::geometry::PointCloud pcd(
+            core::Tensor::Init<float>({{0.1, 0.3, 0.9},
+                                       {0.9, 0.2, 0.4},
+                                       {0.3, 0.6, 0.8},
+                                       {0.2, 0.4, 0.2}},
+                                      device));
+    pcd.SetPointColors(core::Tensor::Init<uint8_t>(
+            {{10, 20, 60}, {20, 30, 50}, {30, 40, 40}, {41, 50, 30}}, device));
+
+    auto pcd_mean = pcd.VoxelDownSample(1, core::HashBackendType::Default,
+                                        "mean");
+    EXPECT_TRUE(pcd_mean.GetPointPositions().AllClose(
+            core::Tensor::Init<float>({{0.375, 0.375, 0.575}}, device)));
+    EXPECT_TRUE(pcd_mean.GetPointColors().AllEqual(
+            core::Tensor::Init<uint8_t>({{25, 35, 45}}, device)));
+
+    auto pcd_min = pcd.VoxelDownSample(1, core::HashBackendType::Default,
+                                       "min");
+    EXPECT_TRUE(pcd_min.GetPointPositions().AllClose(
+            core::Tensor::Init<float>({{0.1, 0.2, 0.2}}, device)));
+    EXPECT_TRUE(pcd_min.GetPointColors().AllEqual(
+            core::Tensor::Init<uint8_t>({{10, 20, 30}}, device)));
+
+    auto pcd_max = pcd.VoxelDownSample(1, core::HashBackendType::Default,
+                                       "max");
+    EXPECT_TRUE(pcd_max.GetPointPositions().AllClose(
+            core::Tensor::Init<float>({{0.9, 0.6, 0.9}}, device)));
+    EXPECT_TRUE(pcd_max.GetPointColors().AllEqual(
+            core::Tensor::Init<uint8_t>({{41, 50, 60}}, device)));
+
+    auto pcd_first = pcd.VoxelDownSample(1, core::HashBackendType::Default,
+                                         "first");
+    EXPECT_TRUE(pcd_first.GetPointPositions().AllClose(
+            core::Tensor::Init<float>({{0.1, 0.3, 0.9}}, device)));
+    EXPECT_TRUE(pcd_first.GetPointColors().AllEqual(
+            core::Tensor::Init<uint8_t>({{10, 20, 60}}, device)));
+
+    // Bool attributes, and integers that are not exact in Float64.
+    const int64_t big = (int64_t(1) << 60) + 1;
+    pcd.SetPointAttr("flags", core::Tensor::Init<bool>(
+                                      {true, false, true, true}, device));
+    pcd.SetPointAttr("ids", core::Tensor::Init<int64_t>(
+                                    {big + 2, big, big + 3, big + 1}, device));
+    for (const std::string reduction : {"first", "min", "max", "mean"}) {
+        auto pcd_down = pcd.VoxelDownSample(
+                1, core::HashBackendType::Default, reduction);
+        EXPECT_EQ(pcd_down.GetPointAttr("flags").GetDtype(), core::Bool);
+        EXPECT_EQ(pcd_down.GetPointAttr("flags").ToFlatVector<bool>(),
+                  std::vector<bool>({reduction != "min"}));
+        if (reduction == "min") {
+            EXPECT_EQ(pcd_down.GetPointAttr("ids").ToFlatVector<int64_t>(),
+                      std::vector<int64_t>({big}));
+        } else if (reduction == "max") {
+            EXPECT_EQ(pcd_down.GetPointAttr("ids").ToFlatVector<int64_t>(),
+                      std::vector<int64_t>({big + 3}));
+        } else if (reduction == "first") {
+            EXPECT_EQ(pcd_down.GetPointAttr("ids").ToFlatVector<int64_t>(),
+                      std::vector<int64_t>({big + 2}));
+        }
+    }
+
+    EXPECT_ANY_THROW(
+            pcd.VoxelDownSample(1, core::HashBackendType::Default, "sum"));
+    EXPECT_ANY_THROW(pcd.VoxelDownSample(0));
+
+    // Averaged points and normals match the legacy implementation. The legacy
+    // voxel grid starts half a voxel below the minimum bound, which is placed
+    // so that both grids align.
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> uniform(-0.9, 0.9);
+    geometry::PointCloud legacy_pcd;
+    legacy_pcd.points_.emplace_back(-0.95, -0.95, -0.95);
+    legacy_pcd.normals_.emplace_back(0, 0, 1);
+    for (int i = 0; i < 20000; ++i) {
+        legacy_pcd.points_.emplace_back(uniform(rng), uniform(rng),
+                                        uniform(rng));
+        legacy_pcd.normals_.emplace_back(uniform(rng), uniform(rng),
+                                         uniform(rng));
+    }
+    auto pcd_random_down =
+            t::geometry::PointCloud::FromLegacy(legacy_pcd, core::Float64,
+                                                device)
+                    .VoxelDownSample(0.1)
+                    .ToLegacy();
+    auto legacy_pcd_down = legacy_pcd.VoxelDownSample(0.1);
+    auto sorted_points_normals = [](const geometry::PointCloud &pcd) {
+        std::vector<Eigen::Matrix<double, 6, 1>> points_normals;
+        for (size_t i = 0; i < pcd.points_.size(); ++i) {
+            Eigen::Matrix<double, 6, 1> point_normal;
+            point_normal << pcd.points_[i], pcd.normals_[i];
+            points_normals.push_back(point_normal);
+        }
+        std::sort(points_normals.begin(), points_normals.end(),
+                  EigenLess<Eigen::Matrix<double, 6, 1>>());
+        return points_normals;
+    };
+    ExpectEQ(sorted_points_normals(pcd_random_down),
+             sorted_points_normals(*legacy_pcd_down));
+}
+
+TEST_P(PointCloudPermuteDevices, FarthestPointDownSample) {
+    core::Device device = GetParam();
+
+    t::geometry::PointCloud pcd(
+            core::Tensor::Init<float>({{0, 2.0, 0},
+                                       {1.0, 1.5, 0},
+                                       {0, 1.0, 0},
+                                       {1.0, 1.0, 0},
+                                       {0, 0, 1.0},
+                                       {1.0, 0, 1.0},
+                                       {0, 1.0, 1.0},
+                                       {1.0, 1.0, 1.5}},
+                                      device));
+    pcd.SetPointColors(core::Tensor::Arange(0, 24, 1, core::Float32, device)
+                               .Reshape({8, 3}));
+    // Samples are returned in the order they are selected.
+    auto pcd_down = pcd.FarthestPointDownSample(4);
+    EXPECT_TRUE(pcd_down.GetPointPositions().AllClose(
+            core::Tensor::Init<float>({{0, 2.0, 0},
+                                       {1.0, 0, 1.0},
+                                       {1.0, 1.0, 0},
+                                       {0, 1.0, 1.0}},
+                                      device)));
+    EXPECT_TRUE(pcd_down.GetPointColors().AllClose(core::Tensor::Init<float>(
+            {{0, 1, 2}, {15, 16, 17}, {9, 10, 11}, {18, 19, 20}}, device)));
+
+    EXPECT_EQ(pcd.FarthestPointDownSample(0).GetPointAttr().size(), 0);
+    EXPECT_ANY_THROW(pcd.FarthestPointDownSample(9));
+
+    // Random points, split into several chunks on CPU, match the legacy
+    // implementation.
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+    geometry::PointCloud legacy_pcd;
+    legacy_pcd.points_.resize(20000);
+    for (Eigen::Vector3d &point : legacy_pcd.points_) {
+        point = Eigen::Vector3d(uniform(rng), uniform(rng), uniform(rng));
+    }
+    auto sorted_points = [](std::vector<Eigen::Vector3d> points) {
+        std::sort(points.begin(), points.end(),
+                  [](const Eigen::Vector3d &a, const Eigen::Vector3d &b) {
+                      return std::lexicographical_compare(
+                              a.data(), a.data() + 3, b.data(), b.data() + 3);
+                  });
+        return points;
+    };
+    auto pcd_random = t::geometry::PointCloud::FromLegacy(
+            legacy_pcd, core::Float64, device);
+    auto pcd_random_down = pcd_random.FarthestPointDownSample(100);
+    ExpectEQ(sorted_points(pcd_random_down.ToLegacy().points_),
+             sorted_points(legacy_pcd.FarthestPointDownSample(100)->points_));
 }
 
 }  // namespace tests
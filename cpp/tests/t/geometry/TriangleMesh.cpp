@@ -453,5 +453,85 @@ TEST_P(TriangleMeshPermuteDevices, ToLegacy) {
                                   Pointwise(FloatEq(), {1.0, 1.1})}));
 }
 
+TEST_P(TriangleMeshPermuteDevices, SimplifyVertexClustering) {
+    core::Device device = GetParam();
+
+    std::shared_ptr<geometry::TriangleMesh> mesh_legacy =
+            geometry::TriangleMesh::CreateSphere(1.0, 20);
+    mesh_legacy->ComputeVertexNormals();
+    t::geometry::TriangleMesh mesh = t::geometry::TriangleMesh::FromLegacy(
+            *mesh_legacy, core::Float64, core::Int64, device);
+
+    const double voxel_size = 0.3;
+    geometry::TriangleMesh simple =
+            mesh.SimplifyVertexClustering(voxel_size).ToLegacy();
+    std::shared_ptr<geometry::TriangleMesh> simple_legacy =
+            mesh_legacy->SimplifyVertexClustering(voxel_size);
+
+    // The vertices are numbered differently, so the triangles are compared
+    // in the legacy numbering with their smallest index first.
+    std::vector<size_t> indices =
+            GetIndicesAToB(simple_legacy->vertices_, simple.vertices_);
+    std::vector<Eigen::Vector3i> triangles;
+    for (const Eigen::Vector3i &triangle : simple.triangles_) {
+        Eigen::Vector3i mapped(int(indices[triangle(0)]),
+                               int(indices[triangle(1)]),
+                               int(indices[triangle(2)]));
+        int first;
+        mapped.minCoeff(&first);
+        triangles.emplace_back(mapped((first + 0) % 3), mapped((first + 1) % 3),
+                               mapped((first + 2) % 3));
+    }
+    EXPECT_EQ(Sort(triangles), Sort(simple_legacy->triangles_));
+    ExpectEQ(ApplyIndices(simple_legacy->vertex_normals_, indices),
+             simple.vertex_normals_);
+}
+
+TEST_P(TriangleMeshPermuteDevices, SimplifyQuadricDecimation) {
+    core::Device device = GetParam();
+
+    std::shared_ptr<geometry::TriangleMesh> mesh_legacy =
+            geometry::TriangleMesh::CreateSphere(1.0, 20);
+    mesh_legacy->ComputeTriangleNormals();
+    t::geometry::TriangleMesh mesh =
+            t::geometry::TriangleMesh::FromLegacy(*mesh_legacy);
+    mesh.SetVertexColors(core::Tensor::Ones(
+            {mesh.GetVertexPositions().GetLength(), 3}, core::Float32));
+    mesh = mesh.To(device);
+
+    const int64_t target_number_of_triangles = 200;
+    t::geometry::TriangleMesh simple =
+            mesh.SimplifyQuadricDecimation(target_number_of_triangles);
+    std::shared_ptr<geometry::TriangleMesh> simple_legacy =
+            mesh_legacy->SimplifyQuadricDecimation(
+                    target_number_of_triangles,
+                    std::numeric_limits<double>::infinity(), 1.0);
+
+    // The sphere stays closed, so the collapses remove two triangles each.
+    EXPECT_EQ(simple.GetDevice(), device);
+    EXPECT_EQ(simple.GetTriangleIndices().GetLength(),
+              int64_t(simple_legacy->triangles_.size()));
+    EXPECT_EQ(simple.GetVertexPositions().GetLength(),
+              int64_t(simple_legacy->vertices_.size()));
+    EXPECT_TRUE(simple.GetVertexColors().AllClose(core::Tensor::Ones(
+            {simple.GetVertexPositions().GetLength(), 3}, core::Float32,
+            device)));
+
+    // The remaining vertices stay close to the sphere, and the triangle
+    // normals are recomputed.
+    const core::Tensor radii = (simple.GetVertexPositions() *
+                                simple.GetVertexPositions())
+                                       .Sum({1})
+                                       .Sqrt();
+    EXPECT_LT((radii - 1).Abs().Max({0}).Item<float>(), 0.1);
+    const core::Tensor normal_norms = (simple.GetTriangleNormals() *
+                                       simple.GetTriangleNormals())
+                                              .Sum({1})
+                                              .Sqrt();
+    EXPECT_TRUE(normal_norms.AllClose(core::Tensor::Ones(
+            {simple.GetTriangleIndices().GetLength()}, core::Float32,
+            device)));
+}
+
 }  // namespace tests
 }  // namespace open3d
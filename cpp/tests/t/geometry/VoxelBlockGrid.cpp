@@ -303,6 +303,97 @@ TEST_P(VoxelBlockGridPermuteDevices, IO) {
     }
 }
 
+static void FillBlockTSDF(VoxelBlockGrid &vbg,
+                          const core::Tensor &keys,
+                          float value) {
+    core::Tensor buf_indices, masks;
+    vbg.GetHashMap().Find(keys, buf_indices, masks);
+    core::Tensor indices = buf_indices.To(core::Int64);
+    core::Tensor tsdf = vbg.GetAttribute("tsdf");
+    core::SizeVector shape = tsdf.GetShape();
+    shape[0] = indices.GetLength();
+    tsdf.IndexSet({indices}, core::Tensor::Full(shape, value, core::Float32,
+                                                tsdf.GetDevice()));
+    vbg.MarkBlocksDirty(buf_indices);
+}
+
+static core::Tensor GetBlockTSDF(VoxelBlockGrid &vbg,
+                                 const core::Tensor &keys) {
+    core::Tensor buf_indices, masks;
+    vbg.GetHashMap().Find(keys, buf_indices, masks);
+    EXPECT_TRUE(masks.All());
+    return vbg.GetAttribute("tsdf").IndexGet({buf_indices.To(core::Int64)});
+}
+
+TEST_P(VoxelBlockGridPermuteDevices, BlockStoreIO) {
+    core::Device device = GetParam();
+    std::vector<core::HashBackendType> backends = EnumerateBackends(device);
+
+    const std::string dir_name = "tmp_block_store";
+    auto segment_exists = [&](int segment) {
+        return utility::filesystem::FileExists(
+                fmt::format("{}/blocks_{:06d}.npz", dir_name, segment));
+    };
+    auto expect_tsdf = [](const core::Tensor &tsdf, float value) {
+        EXPECT_TRUE(tsdf.AllClose(core::Tensor::Full(
+                tsdf.GetShape(), value, core::Float32, tsdf.GetDevice())));
+    };
+
+    for (auto backend : backends) {
+        utility::filesystem::DeleteDirectory(dir_name);
+        auto vbg = VoxelBlockGrid({"tsdf", "weight"},
+                                  {core::Float32, core::UInt16}, {{1}, {1}},
+                                  0.01, 4, 16, device, backend);
+        core::Tensor keys = core::Tensor::Arange(0, 24, 1, core::Int32, device)
+                                    .Reshape({8, 3});
+        core::Tensor buf_indices, masks;
+        vbg.GetHashMap().Activate(keys, buf_indices, masks);
+
+        // The first save writes all blocks, the second only modified ones.
+        FillBlockTSDF(vbg, keys, 1);
+        vbg.SaveBlockStore(dir_name);
+        EXPECT_TRUE(segment_exists(0));
+        FillBlockTSDF(vbg, keys.Slice(0, 0, 2), 2);
+        vbg.SaveBlockStore(dir_name);
+        EXPECT_TRUE(segment_exists(0));
+        EXPECT_TRUE(segment_exists(1));
+        vbg.SaveBlockStore(dir_name);
+        EXPECT_FALSE(segment_exists(2));
+
+        auto vbg_loaded = VoxelBlockGrid::LoadBlockStore(dir_name);
+        EXPECT_EQ(vbg_loaded.GetHashMap().Size(), 8);
+        expect_tsdf(GetBlockTSDF(vbg_loaded, keys.Slice(0, 0, 2)), 2);
+        expect_tsdf(GetBlockTSDF(vbg_loaded, keys.Slice(0, 2, 8)), 1);
+
+        // Load one block and a missing one, then save back to the store.
+        core::Tensor coords =
+                core::Tensor::Init<int>({{0, 1, 2}, {100, 100, 100}});
+        auto vbg_partial = VoxelBlockGrid::LoadBlockStore(dir_name, coords);
+        EXPECT_EQ(vbg_partial.GetHashMap().Size(), 1);
+        expect_tsdf(GetBlockTSDF(vbg_partial, keys.Slice(0, 0, 1)), 2);
+        FillBlockTSDF(vbg_partial, keys.Slice(0, 0, 1), 3);
+        vbg_partial.SaveBlockStore(dir_name);
+
+        vbg_loaded = VoxelBlockGrid::LoadBlockStore(dir_name);
+        EXPECT_EQ(vbg_loaded.GetHashMap().Size(), 8);
+        expect_tsdf(GetBlockTSDF(vbg_loaded, keys.Slice(0, 0, 1)), 3);
+        expect_tsdf(GetBlockTSDF(vbg_loaded, keys.Slice(0, 1, 2)), 2);
+        expect_tsdf(GetBlockTSDF(vbg_loaded, keys.Slice(0, 2, 8)), 1);
+
+        // Rewriting all blocks drops the old segments.
+        FillBlockTSDF(vbg_loaded, keys, 4);
+        vbg_loaded.SaveBlockStore(dir_name);
+        EXPECT_FALSE(segment_exists(0));
+        EXPECT_FALSE(segment_exists(1));
+        EXPECT_FALSE(segment_exists(2));
+        EXPECT_TRUE(segment_exists(3));
+        vbg_loaded = VoxelBlockGrid::LoadBlockStore(dir_name);
+        expect_tsdf(GetBlockTSDF(vbg_loaded, keys), 4);
+
+        utility::filesystem::DeleteDirectory(dir_name);
+    }
+}
+
 TEST_P(VoxelBlockGridPermuteDevices, RayCasting) {
     core::Device device = GetParam();
     std::vector<core::HashBackendType> backends =
@@ -0,0 +1,243 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/ColumnarIO.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/geometry/TriangleMesh.h"
+#include "open3d/t/io/PointCloudIO.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+static t::geometry::PointCloud CreateRandomPointCloud(int64_t num_points) {
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<float> dist(-10.f, 10.f);
+    std::vector<float> positions(num_points * 3);
+    for (float &value : positions) {
+        value = dist(rng);
+    }
+    t::geometry::PointCloud pcd(
+            core::Tensor(positions, {num_points, 3}, core::Float32));
+    pcd.SetPointColors(pcd.GetPointPositions().Add(10).Mul(12).To(core::UInt8));
+    pcd.SetPointAttr("labels", core::Tensor::Arange(0, num_points, 1,
+                                                     core::Int32)
+                                       .Reshape({num_points, 1}));
+    return pcd;
+}
+
+// Returns the points of \p pcd sorted by label, to compare point clouds that
+// were reordered on write.
+static t::geometry::PointCloud SortByLabel(const t::geometry::PointCloud &pcd) {
+    const core::Tensor labels = pcd.GetPointAttr("labels")
+                                        .Reshape({-1})
+                                        .To(core::Int64)
+                                        .Contiguous();
+    const int64_t *label_ptr = labels.GetDataPtr<int64_t>();
+    std::vector<int64_t> order(labels.GetLength());
+    std::iota(order.begin(), order.end(), int64_t(0));
+    std::sort(order.begin(), order.end(), [&](int64_t a, int64_t b) {
+        return label_ptr[a] < label_ptr[b];
+    });
+    const core::Tensor index(order, {int64_t(order.size())}, core::Int64);
+    t::geometry::PointCloud sorted;
+    for (const auto &kv : pcd.GetPointAttr()) {
+        sorted.SetPointAttr(kv.first, kv.second.IndexGet({index}));
+    }
+    return sorted;
+}
+
+TEST(ColumnarIO, ReadWritePointCloud) {
+    const t::geometry::PointCloud pcd = CreateRandomPointCloud(10000);
+    const std::string filename = "test_columnar.o3dc";
+    for (auto compression :
+         {t::io::ColumnCompression::None, t::io::ColumnCompression::LZF,
+          t::io::ColumnCompression::Deflate}) {
+        for (bool spatial_sort : {false, true}) {
+            t::io::WriteColumnarOption option;
+            option.compression = compression;
+            option.chunk_size = 1000;
+            option.spatial_sort = spatial_sort;
+            EXPECT_TRUE(t::io::WritePointCloudToColumnar(filename, pcd,
+                                                         option));
+
+            t::geometry::PointCloud pcd_read;
+            EXPECT_TRUE(t::io::ReadPointCloudFromColumnar(filename, pcd_read));
+            if (spatial_sort) {
+                pcd_read = SortByLabel(pcd_read);
+            }
+            EXPECT_EQ(pcd_read.GetPointAttr().size(), 3);
+            for (const auto &kv : pcd.GetPointAttr()) {
+                EXPECT_TRUE(
+                        kv.second.AllEqual(pcd_read.GetPointAttr(kv.first)));
+            }
+        }
+    }
+
+    // Only the requested columns are read.
+    t::geometry::PointCloud pcd_read;
+    EXPECT_TRUE(t::io::ReadPointCloudFromColumnar(filename, pcd_read,
+                                                  {"labels"}));
+    EXPECT_EQ(pcd_read.GetPointAttr().size(), 1);
+    EXPECT_TRUE(pcd_read.GetPointAttr().Contains("labels"));
+    EXPECT_FALSE(t::io::ReadPointCloudFromColumnar(filename, pcd_read,
+                                                   {"normals"}));
+
+    // The generic IO functions keep the point order.
+    EXPECT_TRUE(t::io::WritePointCloud(filename, pcd));
+    EXPECT_TRUE(t::io::ReadPointCloud(filename, pcd_read));
+    for (const auto &kv : pcd.GetPointAttr()) {
+        EXPECT_TRUE(kv.second.AllEqual(pcd_read.GetPointAttr(kv.first)));
+    }
+    std::remove(filename.c_str());
+}
+
+TEST(ColumnarIO, ReadMemoryMappedPointCloud) {
+    const t::geometry::PointCloud pcd = CreateRandomPointCloud(10000);
+    const std::string filename = "test_columnar_mapped.o3dc";
+    for (auto compression :
+         {t::io::ColumnCompression::None, t::io::ColumnCompression::LZF}) {
+        // Chunks of 1024 points are back to back for all columns.
+        t::io::WriteColumnarOption option;
+        option.compression = compression;
+        option.chunk_size = 1024;
+        option.spatial_sort = false;
+        EXPECT_TRUE(t::io::WritePointCloudToColumnar(filename, pcd, option));
+
+        t::geometry::PointCloud pcd_read;
+        EXPECT_TRUE(t::io::ReadPointCloudFromColumnar(filename, pcd_read, {},
+                                                      true));
+        for (const auto &kv : pcd.GetPointAttr()) {
+            const core::Tensor &column = pcd_read.GetPointAttr(kv.first);
+            EXPECT_TRUE(kv.second.AllEqual(column));
+            if (compression == t::io::ColumnCompression::None) {
+                // Views start at a chunk, which is 64-byte aligned.
+                EXPECT_EQ(reinterpret_cast<uintptr_t>(column.GetDataPtr()) %
+                                  64,
+                          0u);
+            }
+        }
+
+        // Writes to the mapped tensors do not reach the file.
+        pcd_read.GetPointPositions().Fill(0);
+        t::geometry::PointCloud pcd_reread;
+        EXPECT_TRUE(t::io::ReadPointCloudFromColumnar(filename, pcd_reread));
+        EXPECT_TRUE(pcd.GetPointPositions().AllEqual(
+                pcd_reread.GetPointPositions()));
+        EXPECT_TRUE(pcd_read.GetPointPositions().AllEqual(
+                core::Tensor::Zeros({10000, 3}, core::Float32)));
+    }
+    std::remove(filename.c_str());
+}
+
+TEST(ColumnarIO, ReadPointCloudRegion) {
+    const t::geometry::PointCloud pcd = CreateRandomPointCloud(20000);
+    const std::string filename = "test_columnar_region.o3dc";
+    t::io::WriteColumnarOption option;
+    option.chunk_size = 512;
+    EXPECT_TRUE(t::io::WritePointCloudToColumnar(filename, pcd, option));
+
+    const core::Tensor min_bound =
+            core::Tensor::Init<double>({-2.0, 1.0, -10.0});
+    const core::Tensor max_bound = core::Tensor::Init<double>({3.0, 4.0, 0.0});
+    t::geometry::PointCloud region;
+    EXPECT_TRUE(t::io::ReadPointCloudRegionFromColumnar(
+            filename, min_bound, max_bound, region, {"positions", "labels"}));
+    EXPECT_EQ(region.GetPointAttr().size(), 2);
+
+    // Compares with a brute force selection.
+    const core::Tensor positions = pcd.GetPointPositions().To(core::Float64);
+    const core::Tensor mask = positions.Ge(min_bound.Reshape({1, 3}))
+                                      .LogicalAnd(positions.Le(
+                                              max_bound.Reshape({1, 3})))
+                                      .To(core::Int64)
+                                      .Sum({1})
+                                      .Eq(3);
+    const core::Tensor expected = pcd.GetPointAttr("labels").IndexGet({mask});
+    EXPECT_GT(expected.GetLength(), 0);
+    EXPECT_TRUE(SortByLabel(region).GetPointAttr("labels").AllEqual(expected));
+    std::remove(filename.c_str());
+}
+
+TEST(ColumnarIO, DetectCorruption) {
+    const t::geometry::PointCloud pcd = CreateRandomPointCloud(1000);
+    const std::string filename = "test_columnar_corrupted.o3dc";
+    t::io::WriteColumnarOption option;
+    option.compression = t::io::ColumnCompression::None;
+    option.spatial_sort = false;
+    EXPECT_TRUE(t::io::WritePointCloudToColumnar(filename, pcd, option));
+    {
+        // Flips a byte of the first chunk.
+        std::fstream file(filename,
+                          std::ios::in | std::ios::out | std::ios::binary);
+        file.seekg(64);
+        const char byte = static_cast<char>(file.get() ^ 0xff);
+        file.seekp(64);
+        file.put(byte);
+    }
+    t::geometry::PointCloud pcd_read;
+    EXPECT_FALSE(t::io::ReadPointCloudFromColumnar(filename, pcd_read));
+    std::remove(filename.c_str());
+}
+
+TEST(ColumnarIO, ReadWriteTriangleMesh) {
+    t::geometry::TriangleMesh mesh;
+    mesh.SetVertexPositions(core::Tensor::Init<float>(
+            {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {1, 1, 0}}));
+    mesh.SetTriangleIndices(
+            core::Tensor::Init<int64_t>({{0, 1, 2}, {1, 3, 2}}));
+    mesh.SetTriangleNormals(
+            core::Tensor::Init<float>({{0, 0, 1}, {0, 0, 1}}));
+
+    const std::string filename = "test_columnar_mesh.o3dc";
+    EXPECT_TRUE(t::io::WriteTriangleMeshToColumnar(filename, mesh));
+    t::geometry::TriangleMesh mesh_read;
+    EXPECT_TRUE(t::io::ReadTriangleMeshFromColumnar(filename, mesh_read));
+    EXPECT_TRUE(mesh.GetVertexPositions().AllEqual(
+            mesh_read.GetVertexPositions()));
+    EXPECT_TRUE(mesh.GetTriangleIndices().AllEqual(
+            mesh_read.GetTriangleIndices()));
+    EXPECT_TRUE(mesh.GetTriangleNormals().AllEqual(
+            mesh_read.GetTriangleNormals()));
+
+    // A mesh file is not a point cloud file.
+    t::geometry::PointCloud pcd;
+    EXPECT_FALSE(t::io::ReadPointCloudFromColumnar(filename, pcd));
+    std::remove(filename.c_str());
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -28,6 +28,9 @@
 
 #include <gtest/gtest.h>
 
+#include <string>
+#include <vector>
+
 #include "open3d/core/Device.h"
 #include "open3d/core/Dtype.h"
 #include "open3d/core/SizeVector.h"
@@ -124,6 +127,31 @@ TEST(ImageIO, ReadImage) {
     RemoveTestImage("test_imageio.png");
 }
 
+TEST(ImageIO, ReadImages) {
+    WriteTestImage(CreateTestImage());
+    const std::vector<std::string> filenames = {
+            "test_imageio.png", "test_imageio.jpg", "test_imageio.png",
+            "test_imageio.jpg", "test_imageio.png"};
+    std::vector<t::geometry::Image> images;
+    EXPECT_TRUE(t::io::ReadImages(filenames, images));
+    ASSERT_EQ(images.size(), filenames.size());
+    for (size_t i = 0; i < filenames.size(); ++i) {
+        t::geometry::Image img;
+        EXPECT_TRUE(t::io::ReadImage(filenames[i], img));
+        EXPECT_TRUE(images[i].AsTensor().AllEqual(img.AsTensor()));
+    }
+
+    // A missing file is left empty, the others are still read.
+    EXPECT_FALSE(t::io::ReadImages(
+            {"test_imageio.png", "test_imageio_missing.png"}, images, 2));
+    ASSERT_EQ(images.size(), 2);
+    EXPECT_FALSE(images[0].IsEmpty());
+    EXPECT_TRUE(images[1].IsEmpty());
+
+    RemoveTestImage("test_imageio.jpg");
+    RemoveTestImage("test_imageio.png");
+}
+
 TEST(ImageIO, ReadImageFromPNG) {
     WriteTestImage(CreateTestImage());
     t::geometry::Image img;
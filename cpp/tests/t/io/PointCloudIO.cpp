@@ -85,6 +85,10 @@ const std::vector<ReadWritePCArgs> pcArgs({
          IsAscii::ASCII,
          Compressed::UNCOMPRESSED,
          {{"positions", 1e-5}, {"intensities", 1e-5}}},  // 1
+        {"test_binary.ply",
+         IsAscii::BINARY,
+         Compressed::UNCOMPRESSED,
+         {{"positions", 0}, {"intensities", 0}}},  // 2
 });
 
 class ReadWriteTPC : public testing::TestWithParam<ReadWritePCArgs> {};
@@ -492,5 +496,38 @@ TEST(TPointCloudIO, ReadWritePointCloudAsPCD) {
     std::remove(filename_ascii_uint32.c_str());
 }
 
+TEST(TPointCloudIO, ReadWriteLargeBinaryPCD) {
+    // Compressed data spans several compression blocks, which are
+    // concatenated into a single LZF stream.
+    const int64_t num_points = 300000;
+    t::geometry::PointCloud pcd(
+            core::Tensor::Arange(0, num_points * 3, 1, core::Float32)
+                    .Reshape({num_points, 3})
+                    .Div(7));
+    pcd.SetPointNormals(pcd.GetPointPositions().Neg());
+    pcd.SetPointColors(core::Tensor::Arange(0, num_points * 3, 1, core::Int32)
+                               .Reshape({num_points, 3})
+                               .To(core::UInt8));
+    pcd.SetPointAttr("labels", core::Tensor::Arange(0, num_points, 1,
+                                                     core::Int32)
+                                       .Reshape({num_points, 1}));
+
+    for (bool compressed : {false, true}) {
+        SCOPED_TRACE(compressed);
+        const std::string filename = "test_pcd_large_binary.pcd";
+        EXPECT_TRUE(t::io::WritePointCloud(
+                filename, pcd,
+                open3d::io::WritePointCloudOption(
+                        /*ascii*/ false, compressed, false, {})));
+
+        t::geometry::PointCloud pcd_read;
+        EXPECT_TRUE(t::io::ReadPointCloud(filename, pcd_read));
+        for (auto &kv : pcd.GetPointAttr()) {
+            EXPECT_TRUE(kv.second.AllEqual(pcd_read.GetPointAttr(kv.first)));
+        }
+        std::remove(filename.c_str());
+    }
+}
+
 }  // namespace tests
 }  // namespace open3d
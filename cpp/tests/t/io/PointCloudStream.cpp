@@ -0,0 +1,163 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/PointCloudStream.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/io/PointCloudIO.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+namespace {
+
+struct PointCloudStreamArgs {
+    std::string filename;
+    bool write_ascii;
+    std::vector<std::string> attributes;
+};
+
+const std::vector<PointCloudStreamArgs> stream_args({
+        {"test_stream.xyz", true, {"positions"}},
+        {"test_stream.xyzi", true, {"positions", "intensities"}},
+        {"test_stream.pts", true, {"positions", "intensities", "colors"}},
+        {"test_stream.pcd", true, {"positions", "intensities", "colors"}},
+        {"test_stream_binary.pcd",
+         false,
+         {"positions", "intensities", "colors"}},
+        {"test_stream.ply", true, {"positions", "intensities", "colors"}},
+        {"test_stream_binary.ply",
+         false,
+         {"positions", "intensities", "colors"}},
+});
+
+}  // namespace
+
+class PointCloudStream
+    : public testing::TestWithParam<PointCloudStreamArgs> {};
+INSTANTIATE_TEST_SUITE_P(PointCloudStream,
+                         PointCloudStream,
+                         testing::ValuesIn(stream_args));
+
+TEST_P(PointCloudStream, ChunkedReadWrite) {
+    const PointCloudStreamArgs args = GetParam();
+    const int64_t num_points = 1000;
+    t::geometry::PointCloud pcd;
+    for (const std::string &attr : args.attributes) {
+        if (attr == "positions") {
+            pcd.SetPointPositions(
+                    core::Tensor::Arange(0, num_points * 3, 1, core::Float64)
+                            .Reshape({num_points, 3})
+                            .Div(8));
+        } else if (attr == "intensities") {
+            pcd.SetPointAttr("intensities",
+                             core::Tensor::Arange(0, num_points, 1,
+                                                  core::Float64)
+                                     .Reshape({num_points, 1})
+                                     .Div(4));
+        } else if (attr == "colors") {
+            pcd.SetPointColors(
+                    core::Tensor::Arange(0, num_points * 3, 1, core::Int64)
+                            .Reshape({num_points, 3})
+                            .To(core::UInt8));
+        }
+    }
+
+    t::io::PointCloudWriter writer;
+    EXPECT_TRUE(writer.Open(args.filename, "auto", args.write_ascii));
+    for (int64_t i = 0; i < num_points; i += 300) {
+        const int64_t end = std::min(i + 300, num_points);
+        t::geometry::PointCloud chunk;
+        for (const auto &kv : pcd.GetPointAttr()) {
+            chunk.SetPointAttr(kv.first, kv.second.Slice(0, i, end));
+        }
+        EXPECT_TRUE(writer.Write(chunk));
+    }
+    EXPECT_EQ(writer.GetNumPoints(), num_points);
+    EXPECT_TRUE(writer.Close());
+
+    // The file can be read as a whole by the regular reader.
+    t::geometry::PointCloud pcd_read;
+    EXPECT_TRUE(t::io::ReadPointCloud(args.filename, pcd_read));
+    for (const std::string &attr : args.attributes) {
+        SCOPED_TRACE(attr);
+        const core::Tensor &expected = pcd.GetPointAttr(attr);
+        EXPECT_TRUE(expected.AllClose(
+                pcd_read.GetPointAttr(attr).To(expected.GetDtype())));
+    }
+
+    t::io::PointCloudReader reader;
+    EXPECT_TRUE(reader.Open(args.filename));
+    EXPECT_EQ(reader.GetNumPoints(), num_points);
+    while (!reader.IsEOF()) {
+        const int64_t position = reader.GetPosition();
+        t::geometry::PointCloud chunk = reader.Read(256);
+        EXPECT_EQ(chunk.GetPointPositions().GetLength(),
+                  std::min<int64_t>(256, num_points - position));
+        for (const std::string &attr : args.attributes) {
+            SCOPED_TRACE(attr);
+            const core::Tensor expected = pcd.GetPointAttr(attr).Slice(
+                    0, position, position + 256);
+            EXPECT_TRUE(expected.AllClose(
+                    chunk.GetPointAttr(attr).To(expected.GetDtype())));
+        }
+    }
+    EXPECT_TRUE(reader.Read(256).IsEmpty());
+
+    EXPECT_TRUE(reader.Seek(10));
+    t::geometry::PointCloud chunk = reader.Read(5);
+    EXPECT_TRUE(chunk.GetPointPositions().AllClose(
+            pcd.GetPointPositions().Slice(0, 10, 15)));
+    EXPECT_FALSE(reader.Seek(num_points + 1));
+    reader.Close();
+
+    std::remove(args.filename.c_str());
+}
+
+TEST(PointCloudStream, WriteEmpty) {
+    const std::string filename = "test_stream_empty.ply";
+    t::io::PointCloudWriter writer;
+    EXPECT_TRUE(writer.Open(filename));
+    EXPECT_TRUE(writer.Close());
+
+    t::io::PointCloudReader reader;
+    EXPECT_TRUE(reader.Open(filename));
+    EXPECT_EQ(reader.GetNumPoints(), 0);
+    EXPECT_TRUE(reader.IsEOF());
+    EXPECT_TRUE(reader.Read(10).IsEmpty());
+
+    std::remove(filename.c_str());
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,117 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/sensor/PrefetchingRGBDReader.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/Image.h"
+#include "open3d/t/geometry/RGBDImage.h"
+#include "open3d/t/io/ImageIO.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+namespace {
+
+// Writes num_frames small color and depth images with per-frame values.
+void WriteTestSequence(int num_frames,
+                       std::vector<std::string> &color_files,
+                       std::vector<std::string> &depth_files) {
+    color_files.clear();
+    depth_files.clear();
+    for (int i = 0; i < num_frames; ++i) {
+        core::Tensor color = core::Tensor::Full({24, 32, 3}, 10 * i + 1,
+                                                core::UInt8);
+        core::Tensor depth = core::Tensor::Full({24, 32, 1}, 1000 + 100 * i,
+                                                core::UInt16);
+        color_files.push_back("test_prefetch_color_" + std::to_string(i) +
+                              ".png");
+        depth_files.push_back("test_prefetch_depth_" + std::to_string(i) +
+                              ".png");
+        t::io::WriteImage(color_files.back(), t::geometry::Image(color));
+        t::io::WriteImage(depth_files.back(), t::geometry::Image(depth));
+    }
+}
+
+void RemoveTestSequence(const std::vector<std::string> &color_files,
+                        const std::vector<std::string> &depth_files) {
+    for (const std::string &filename : color_files) {
+        std::remove(filename.c_str());
+    }
+    for (const std::string &filename : depth_files) {
+        std::remove(filename.c_str());
+    }
+}
+
+}  // namespace
+
+TEST(PrefetchingRGBDReader, ImageSequence) {
+    std::vector<std::string> color_files, depth_files;
+    WriteTestSequence(7, color_files, depth_files);
+
+    t::io::PrefetchingRGBDReader reader(color_files, depth_files,
+                                        core::Device("CPU:0"), 2, 3);
+    for (size_t i = 0; i < color_files.size(); ++i) {
+        EXPECT_FALSE(reader.IsEOF());
+        EXPECT_EQ(reader.GetFrameIndex(), static_cast<int64_t>(i));
+        t::geometry::RGBDImage frame = reader.NextFrame();
+        ASSERT_FALSE(frame.IsEmpty());
+
+        t::geometry::Image color, depth;
+        ASSERT_TRUE(t::io::ReadImage(color_files[i], color));
+        ASSERT_TRUE(t::io::ReadImage(depth_files[i], depth));
+        EXPECT_TRUE(frame.color_.AsTensor().AllEqual(color.AsTensor()));
+        EXPECT_TRUE(frame.depth_.AsTensor().AllEqual(depth.AsTensor()));
+    }
+    EXPECT_TRUE(reader.IsEOF());
+    EXPECT_TRUE(reader.NextFrame().IsEmpty());
+
+    RemoveTestSequence(color_files, depth_files);
+}
+
+TEST(PrefetchingRGBDReader, StopEarly) {
+    std::vector<std::string> color_files, depth_files;
+    WriteTestSequence(5, color_files, depth_files);
+    {
+        t::io::PrefetchingRGBDReader reader(color_files, depth_files,
+                                            core::Device("CPU:0"), 1);
+        EXPECT_FALSE(reader.NextFrame().IsEmpty());
+    }
+    RemoveTestSequence(color_files, depth_files);
+}
+
+TEST(PrefetchingRGBDReader, MismatchedFiles) {
+    EXPECT_ANY_THROW(t::io::PrefetchingRGBDReader({"a.png", "b.png"},
+                                                  {"a_depth.png"}));
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,129 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/registration/Feature.h"
+
+#include "core/CoreTest.h"
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/data/Dataset.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/io/PointCloudIO.h"
+#include "open3d/pipelines/registration/Feature.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "tests/Tests.h"
+
+namespace t_reg = open3d::t::pipelines::registration;
+namespace l_reg = open3d::pipelines::registration;
+
+namespace open3d {
+namespace tests {
+
+class FeaturePermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(Feature,
+                         FeaturePermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(FeaturePermuteDevices, ComputeFPFHFeature) {
+    core::Device device = GetParam();
+
+    data::PCDPointCloud pcd_fragment;
+    geometry::PointCloud pcd_legacy;
+    io::ReadPointCloud(pcd_fragment.GetPath(), pcd_legacy);
+    pcd_legacy = *pcd_legacy.VoxelDownSample(0.05);
+    pcd_legacy.EstimateNormals();
+
+    const double radius = 0.25;
+    const int max_nn = 100;
+
+    const auto fpfh_legacy = l_reg::ComputeFPFHFeature(
+            pcd_legacy, geometry::KDTreeSearchParamHybrid(radius, max_nn));
+    const core::Tensor fpfh_legacy_t =
+            core::eigen_converter::EigenMatrixToTensor(fpfh_legacy->data_)
+                    .T()
+                    .Contiguous();
+
+    for (const core::Dtype dtype : {core::Float32, core::Float64}) {
+        t::geometry::PointCloud pcd =
+                t::geometry::PointCloud::FromLegacy(pcd_legacy, dtype, device);
+
+        const core::Tensor fpfh =
+                t_reg::ComputeFPFHFeature(pcd, max_nn, radius);
+        EXPECT_EQ(fpfh.GetShape(),
+                  core::SizeVector({pcd.GetPointPositions().GetLength(), 33}));
+        EXPECT_EQ(fpfh.GetDtype(), dtype);
+        EXPECT_EQ(fpfh.GetDevice(), device);
+
+        const core::Tensor fpfh_cpu =
+                fpfh.To(core::Device("CPU:0"), core::Float64);
+        if (dtype == core::Float64) {
+            EXPECT_TRUE(fpfh_cpu.AllClose(fpfh_legacy_t, 1e-4, 1e-4));
+        } else {
+            // Rounding may move a few pair features to a neighboring bin.
+            const double mean_abs_diff = (fpfh_cpu - fpfh_legacy_t)
+                                                 .Abs()
+                                                 .Mean({0, 1})
+                                                 .Item<double>();
+            EXPECT_LT(mean_abs_diff, 0.1);
+        }
+    }
+}
+
+TEST_P(FeaturePermuteDevices, ComputeFPFHFeatureKNN) {
+    core::Device device = GetParam();
+
+    data::PCDPointCloud pcd_fragment;
+    geometry::PointCloud pcd_legacy;
+    io::ReadPointCloud(pcd_fragment.GetPath(), pcd_legacy);
+    pcd_legacy = *pcd_legacy.VoxelDownSample(0.05);
+    pcd_legacy.EstimateNormals();
+
+    const int max_nn = 30;
+    const auto fpfh_legacy = l_reg::ComputeFPFHFeature(
+            pcd_legacy, geometry::KDTreeSearchParamKNN(max_nn));
+    const core::Tensor fpfh_legacy_t =
+            core::eigen_converter::EigenMatrixToTensor(fpfh_legacy->data_)
+                    .T()
+                    .Contiguous();
+
+    t::geometry::PointCloud pcd = t::geometry::PointCloud::FromLegacy(
+            pcd_legacy, core::Float64, device);
+    const core::Tensor fpfh = t_reg::ComputeFPFHFeature(pcd, max_nn);
+    EXPECT_TRUE(fpfh.To(core::Device("CPU:0"))
+                        .AllClose(fpfh_legacy_t, 1e-4, 1e-4));
+}
+
+TEST_P(FeaturePermuteDevices, ComputeFPFHFeatureNoNormals) {
+    core::Device device = GetParam();
+
+    t::geometry::PointCloud pcd(
+            core::Tensor::Init<double>({{0, 0, 0}, {1, 0, 0}, {0, 1, 0}},
+                                       device));
+    EXPECT_ANY_THROW(t_reg::ComputeFPFHFeature(pcd));
+}
+
+}  // namespace tests
+}  // namespace open3d
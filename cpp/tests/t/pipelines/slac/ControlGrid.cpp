@@ -26,10 +26,15 @@
 
 #include "open3d/t/pipelines/slac/ControlGrid.h"
 
+#include <random>
+#include <vector>
+
 #include "core/CoreTest.h"
+#include "open3d/core/EigenConverter.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/data/Dataset.h"
 #include "open3d/t/io/PointCloudIO.h"
+#include "open3d/t/pipelines/slac/FillInLinearSystemImpl.h"
 #include "open3d/t/pipelines/slac/Visualization.h"
 #include "tests/Tests.h"
 
@@ -43,6 +48,17 @@ static t::geometry::PointCloud CreateTPCDFromFile(
     return t::geometry::PointCloud::FromLegacy(*pcd, core::Float32, device);
 }
 
+// Assembles the dense AtA of shape {num_params, num_params} from its
+// triplets.
+static core::Tensor SparseTripletsToTensor(
+        const t::pipelines::slac::SparseTriplets& AtA_triplets,
+        int64_t num_params) {
+    Eigen::SparseMatrix<double> AtA(num_params, num_params);
+    AtA.setFromTriplets(AtA_triplets.begin(), AtA_triplets.end());
+    return core::eigen_converter::EigenMatrixToTensor(
+            Eigen::MatrixXf(Eigen::MatrixXd(AtA).cast<float>()));
+}
+
 class ControlGridPermuteDevices : public PermuteDevices {};
 INSTANTIATE_TEST_SUITE_P(ControlGrid,
                          ControlGridPermuteDevices,
@@ -96,5 +112,125 @@ TEST_P(ControlGridPermuteDevices, Regularizer) {
     curr[2][1] += 0.2;
 }
 
+TEST_P(ControlGridPermuteDevices, SparseRegularizer) {
+    core::Device device = GetParam();
+    if (device.GetType() != core::Device::DeviceType::CPU) {
+        GTEST_SKIP() << "Sparse linear system is only supported on CPU.";
+    }
+    t::pipelines::slac::ControlGrid cgrid(0.5, 1000, device);
+
+    data::PCDPointCloud sample_pcd;
+    t::geometry::PointCloud pcd =
+            CreateTPCDFromFile(sample_pcd.GetPath(), device);
+    cgrid.Touch(pcd);
+    cgrid.Compactify();
+    core::Tensor curr = cgrid.GetCurrPositions();
+    curr[0][0] += 0.2;
+    curr[1][2] -= 0.2;
+    curr[2][1] += 0.2;
+
+    const int n_frags = 2;
+    const int64_t num_params = 6 * n_frags + 3 * cgrid.Size();
+    t::pipelines::slac::SLACOptimizerParams params;
+    t::pipelines::slac::SLACDebugOption debug_option;
+
+    core::Tensor AtA = core::Tensor::Zeros({num_params, num_params},
+                                           core::Float32, device);
+    core::Tensor Atb = core::Tensor::Zeros({num_params, 1}, core::Float32,
+                                           device);
+    core::Tensor residual = core::Tensor::Zeros({1}, core::Float32, device);
+    t::pipelines::slac::FillInSLACRegularizerTerm(
+            AtA, Atb, residual, cgrid, n_frags, params, debug_option);
+
+    t::pipelines::slac::SparseTriplets AtA_triplets;
+    core::Tensor Atb_sparse = core::Tensor::Zeros({num_params, 1},
+                                                  core::Float32, device);
+    core::Tensor residual_sparse =
+            core::Tensor::Zeros({1}, core::Float32, device);
+    t::pipelines::slac::FillInSLACRegularizerTerm(
+            AtA_triplets, Atb_sparse, residual_sparse, cgrid, n_frags, params,
+            debug_option);
+
+    EXPECT_TRUE(Atb_sparse.AllClose(Atb, 1e-4, 1e-4));
+    EXPECT_TRUE(residual_sparse.AllClose(residual, 1e-4, 1e-4));
+    EXPECT_TRUE(SparseTripletsToTensor(AtA_triplets, num_params)
+                        .AllClose(AtA, 1e-4, 1e-4));
+}
+
+TEST_P(ControlGridPermuteDevices, SparseAlignment) {
+    core::Device device = GetParam();
+    if (device.GetType() != core::Device::DeviceType::CPU) {
+        GTEST_SKIP() << "Sparse linear system is only supported on CPU.";
+    }
+
+    // Two noisy copies of a random point cloud with random normals.
+    const int64_t n_points = 200;
+    std::mt19937 generator(0);
+    std::uniform_real_distribution<float> uniform(0.0f, 1.5f);
+    std::normal_distribution<float> normal(0.0f, 1.0f);
+    std::vector<float> positions_i, positions_j, normals;
+    for (int64_t k = 0; k < n_points; ++k) {
+        Eigen::Vector3f n(normal(generator), normal(generator),
+                          normal(generator));
+        n.normalize();
+        for (int axis = 0; axis < 3; ++axis) {
+            const float p = uniform(generator);
+            positions_i.push_back(p);
+            positions_j.push_back(p + 0.01f * normal(generator));
+            normals.push_back(n(axis));
+        }
+    }
+    t::geometry::PointCloud pcd_i(
+            core::Tensor(positions_i, {n_points, 3}, core::Float32, device));
+    pcd_i.SetPointNormals(
+            core::Tensor(normals, {n_points, 3}, core::Float32, device));
+    t::geometry::PointCloud pcd_j(
+            core::Tensor(positions_j, {n_points, 3}, core::Float32, device));
+    pcd_j.SetPointNormals(
+            core::Tensor(normals, {n_points, 3}, core::Float32, device));
+
+    t::pipelines::slac::ControlGrid cgrid(0.5, 1000, device);
+    cgrid.Touch(pcd_i);
+    cgrid.Touch(pcd_j);
+    cgrid.Compactify();
+    core::Tensor curr = cgrid.GetCurrPositions();
+    curr[0][0] += 0.02;
+    curr[1][2] -= 0.02;
+    t::geometry::PointCloud pcd_param_i = cgrid.Parameterize(pcd_i);
+    t::geometry::PointCloud pcd_param_j = cgrid.Parameterize(pcd_j);
+
+    core::Tensor Ti = core::Tensor::Eye(4, core::Float32, device);
+    core::Tensor Tj = core::Tensor::Eye(4, core::Float32, device);
+    Tj[0][3] = 0.01;
+
+    const int n_frags = 2;
+    const float threshold = 0.1;
+    const int64_t num_params = 6 * n_frags + 3 * cgrid.Size();
+
+    core::Tensor AtA = core::Tensor::Zeros({num_params, num_params},
+                                           core::Float32, device);
+    core::Tensor Atb = core::Tensor::Zeros({num_params, 1}, core::Float32,
+                                           device);
+    core::Tensor residual = core::Tensor::Zeros({1}, core::Float32, device);
+    t::pipelines::slac::FillInSLACAlignmentTerm(
+            AtA, Atb, residual, cgrid, pcd_param_i, pcd_param_j, Ti, Tj, 0, 1,
+            n_frags, threshold);
+
+    t::pipelines::slac::SparseTriplets AtA_triplets;
+    core::Tensor Atb_sparse = core::Tensor::Zeros({num_params, 1},
+                                                  core::Float32, device);
+    core::Tensor residual_sparse =
+            core::Tensor::Zeros({1}, core::Float32, device);
+    t::pipelines::slac::FillInSLACAlignmentTerm(
+            AtA_triplets, Atb_sparse, residual_sparse, cgrid, pcd_param_i,
+            pcd_param_j, Ti, Tj, 0, 1, n_frags, threshold);
+
+    EXPECT_GT(residual[0].Item<float>(), 0);
+    EXPECT_TRUE(Atb_sparse.AllClose(Atb, 1e-4, 1e-4));
+    EXPECT_TRUE(residual_sparse.AllClose(residual, 1e-4, 1e-4));
+    EXPECT_TRUE(SparseTripletsToTensor(AtA_triplets, num_params)
+                        .AllClose(AtA, 1e-4, 1e-4));
+}
+
 }  // namespace tests
 }  // namespace open3d
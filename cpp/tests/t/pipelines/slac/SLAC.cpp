@@ -24,6 +24,7 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <random>
 #include <string>
 #include <vector>
 
@@ -38,6 +39,7 @@
 #include "open3d/t/io/ImageIO.h"
 #include "open3d/t/io/PointCloudIO.h"
 #include "open3d/t/pipelines/registration/Registration.h"
+#include "open3d/t/pipelines/slac/FillInLinearSystemImpl.h"
 #include "open3d/t/pipelines/slac/SLACOptimizer.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Timer.h"
@@ -68,6 +70,44 @@ static bool IsPointCloudSimilar(t::geometry::PointCloud source,
     return false;
 }
 
+TEST_P(SLACPermuteDevices, SolveSparseLinearSystem) {
+    core::Device device = GetParam();
+    if (device.GetType() != core::Device::DeviceType::CPU) {
+        GTEST_SKIP() << "Sparse linear system is only supported on CPU.";
+    }
+
+    // A diagonally dominant system with the neighbor coupling of the SLAC
+    // regularizer. Every off-diagonal entry is split into two triplets to
+    // check that duplicates are summed up.
+    const int64_t num_params = 60;
+    std::mt19937 generator(0);
+    std::uniform_real_distribution<float> uniform(-1.0f, 1.0f);
+    t::pipelines::slac::SparseTriplets AtA_triplets;
+    core::Tensor AtA = core::Tensor::Zeros({num_params, num_params},
+                                           core::Float32, device);
+    std::vector<float> Atb_data(num_params);
+    for (int64_t i = 0; i < num_params; ++i) {
+        AtA_triplets.emplace_back(i, i, 4.0);
+        AtA[i][i] = 4.0;
+        for (int64_t j : {i + 1, i + 3}) {
+            if (j >= num_params) continue;
+            for (int k = 0; k < 2; ++k) {
+                AtA_triplets.emplace_back(i, j, -0.5);
+                AtA_triplets.emplace_back(j, i, -0.5);
+            }
+            AtA[i][j] = -1.0;
+            AtA[j][i] = -1.0;
+        }
+        Atb_data[i] = uniform(generator);
+    }
+    core::Tensor Atb(Atb_data, {num_params, 1}, core::Float32, device);
+
+    core::Tensor delta = t::pipelines::slac::SolveSparseLinearSystem(
+            AtA_triplets, Atb, num_params);
+    core::Tensor delta_dense = AtA.Solve(Atb.Neg());
+    EXPECT_TRUE(delta.AllClose(delta_dense, 1e-4, 1e-4));
+}
+
 TEST_P(SLACPermuteDevices, DISABLED_RunSLACOptimizerForFragments) {
     core::Device device = GetParam();
 
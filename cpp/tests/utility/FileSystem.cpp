@@ -560,5 +560,34 @@ TEST(FileSystem, GetPathComponents) {
     EXPECT_EQ(result, expected);
 }
 
+// ----------------------------------------------------------------------------
+// Map a file into memory for reading.
+// ----------------------------------------------------------------------------
+TEST(FileSystem, MappedFile) {
+    const std::string file_name = "test_mapped_file.txt";
+    const std::string content = "1 2 3\n4 5 6\n";
+    FILE *file = utility::filesystem::FOpen(file_name, "wb");
+    fwrite(content.data(), 1, content.size(), file);
+    fclose(file);
+
+    utility::filesystem::MappedFile mapped_file;
+    EXPECT_TRUE(mapped_file.Open(file_name));
+    ASSERT_EQ(mapped_file.GetSize(), content.size());
+    EXPECT_EQ(std::string(mapped_file.GetData(), mapped_file.GetSize()),
+              content);
+    mapped_file.Close();
+    EXPECT_EQ(mapped_file.GetData(), nullptr);
+    EXPECT_EQ(mapped_file.GetSize(), 0);
+
+    // Empty files are mapped to a null buffer.
+    file = utility::filesystem::FOpen(file_name, "wb");
+    fclose(file);
+    EXPECT_TRUE(mapped_file.Open(file_name));
+    EXPECT_EQ(mapped_file.GetSize(), 0);
+    EXPECT_TRUE(utility::filesystem::RemoveFile(file_name));
+
+    EXPECT_FALSE(mapped_file.Open(file_name));
+}
+
 }  // namespace tests
 }  // namespace open3d